@@ -27,7 +27,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 typedef enum {
     CONVOLUTION,
-    ACTIVATION
+    ACTIVATION,
+    POOLING
 } LayerType;
 
 typedef struct Layer {
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CONVOLUTION_ENGINE_H
+#define CONVOLUTION_ENGINE_H
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Tensor/tensor.h"
+
+/**
+ * Values, that a convolution reads outside of the tensor. The padding is
+ * virtual, the padded tensor is never materialized.
+ * 
+ * <ul>
+ * <li>`CONVOLUTION_PADDING_VALID` - No padding, the kernel stays inside the tensor.</li>
+ * <li>`CONVOLUTION_PADDING_ZERO` - Zeros outside of the tensor.</li>
+ * <li>`CONVOLUTION_PADDING_REFLECT` - The tensor mirrored at its border,
+ * without repeating the border (`[c, b | a, b, c | b, a]`).</li>
+ * <li>`CONVOLUTION_PADDING_REPLICATE` - The border value repeated (`[a, a | a, b, c | c, c]`).</li>
+ * </ul>
+ */
+typedef enum {
+    CONVOLUTION_PADDING_VALID,
+    CONVOLUTION_PADDING_ZERO,
+    CONVOLUTION_PADDING_REFLECT,
+    CONVOLUTION_PADDING_REPLICATE
+} ConvolutionPadding;
+
+/**
+ * A validated convolution, that is handed to the convolution engines.
+ * The outputs are written dense in row-major order of the output shape.
+ * Output `o` of a dimension starts at `o * strides[dim] - paddingBefore`
+ * in the tensor and tap `k` reads `k * dilations[dim]` elements further.
+ * When `padding` is `CONVOLUTION_PADDING_VALID` no output reaches outside
+ * of the tensor and `paddingBefore` is zero. `stride` is the stride of all
+ * dimensions, when they share it and no dimension is dilated, otherwise
+ * it is `0` and only the direct and the GEMM engine apply.
+ */
+typedef struct {
+    const void* tensor;
+    const void* kernel;
+    const void* dest;
+    const Tensor* tensorBase;
+    const Tensor* kernelBase;
+    const Tensor* destBase;
+    TensorType tensorType;
+    int stride;
+    const int* outputShape;
+    size_t outputs;
+    ConvolutionPadding padding;
+    const int* paddingBefore;
+    const int* strides;
+    const int* dilations;
+} ConvolutionProblem;
+
+/**
+ * Kernel of a Winograd convolution, that is transformed into the Winograd
+ * domain once. Every 3x3 slice of the kernel is stored with `4x4` values
+ * for F(2x2,3x3) and with `6x6` values for F(4x4,3x3).
+ */
+typedef struct {
+    TensorType tensorType;
+    int slices;
+    void* weights2;
+    void* weights4;
+} WinogradKernel;
+
+/**
+ * Rank-1 kernel, that is decomposed into one 1D kernel per dimension. The
+ * factors of all dimensions are stored one after another, the factor of a
+ * dimension has `sizes[dim]` values.
+ */
+typedef struct {
+    TensorType tensorType;
+    int dimensions;
+    int* sizes;
+    void* factors;
+} SeparableKernel;
+
+/**
+ * A validated convolution of 8-bit activations with signed 8-bit filters.
+ * The outputs of filter `f` are written dense to the `outputs` values from
+ * `f * outputs` on, either as the exact 32-bit accumulations of
+ * `(value - tensorZeroPoint) * weight` or requantized to 8 bits with the
+ * multiplier of the filter.
+ */
+typedef struct {
+    const Tensor* tensorBase;
+    const uint8_t* tensor;
+    int tensorZeroPoint;
+    const int* kernelShape;
+    const int8_t* weights;
+    int filters;
+    int stride;
+    const int* outputShape;
+    size_t outputs;
+    int* accumulators;
+    uint8_t* requantized;
+    const float* multipliers;
+    int requantizedZeroPoint;
+} QuantizedConvolution;
+
+int resolvePaddedIndex(const int index, const int size, const ConvolutionPadding padding);
+void getInteriorOutputRange(const ConvolutionProblem* problem, const int dim, int* first, int* end);
+ptrdiff_t getPaddedTapOffset(const ConvolutionProblem* problem, const size_t position, const size_t tap);
+
+int isDirectFixedKernel(const Tensor* kernelBase);
+void convolveDirect(const ConvolutionProblem* problem);
+void convolveDepthwise(const ConvolutionProblem* problem, const void* pointwise, const int filters);
+
+void convolveGemm(const ConvolutionProblem* problem);
+void convolveGemmWithWeights(const ConvolutionProblem* problem, const void* weights, const int filters);
+
+int isWinogradApplicable(const Tensor* kernelBase, const TensorType tensorType, const int stride);
+WinogradKernel* createWinogradKernel(const void* kernel, const TensorType tensorType);
+void convolveWinograd(const ConvolutionProblem* problem, const WinogradKernel* kernel);
+void freeWinogradKernel(WinogradKernel* kernel);
+
+SeparableKernel* createSeparableKernel(const void* kernel, const TensorType tensorType);
+void convolveSeparable(const ConvolutionProblem* problem, const SeparableKernel* kernel);
+void freeSeparableKernel(SeparableKernel* kernel);
+
+void computeIntegralImage(const void* tensor, const void* dest, const TensorType tensorType);
+int isConstantKernel(const void* kernel, const TensorType tensorType);
+void convolveBox(const ConvolutionProblem* problem);
+
+int isFftApplicable(const TensorType tensorType);
+void convolveFft(const ConvolutionProblem* problem);
+
+void convolveWeightGradient(const ConvolutionProblem* problem);
+
+void convolveQuantized(const QuantizedConvolution* convolution);
+
+int getTunedAlgorithm(const ConvolutionProblem* problem);
+void setTunedAlgorithm(const ConvolutionProblem* problem, const int algorithm);
+size_t getTuningTableSize();
+void clearTuningTable();
+int saveTuningTable(const char* path);
+int loadTuningTable(const char* path);
+
+#endif
\ No newline at end of file
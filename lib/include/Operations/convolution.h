@@ -23,14 +23,139 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define CONVOLUTION_H
 
 #include "Tensor/tensor.h"
+#include "Tensor/quantized.h"
 #include "Network/layer.h"
+#include "Operations/Convolution/engine.h"
+
+/**
+ * Engines that can execute a convolution.
+ * 
+ * <ul>
+ * <li>`CONVOLUTION_ALGORITHM_AUTO` - Chooses the engine by the type and size of the problem.</li>
+ * <li>`CONVOLUTION_ALGORITHM_DIRECT` - Moves the kernel over the tensor, every output is
+ * computed independently from its coordinates.</li>
+ * <li>`CONVOLUTION_ALGORITHM_GEMM` - Lowers blocks of the tensor into a patch matrix
+ * (im2col) and multiplies it with the kernel in a cache-blocked GEMM.</li>
+ * <li>`CONVOLUTION_ALGORITHM_WINOGRAD` - Winograd F(4x4,3x3) / F(2x2,3x3) for FLOAT and DOUBLE
+ * kernels ending in 3x3 with stride 1. Other convolutions fall back to `AUTO`.</li>
+ * <li>`CONVOLUTION_ALGORITHM_FFT` - Overlap-add FFT convolution for FLOAT and DOUBLE tensors,
+ * suited for large kernels. Other types fall back to `AUTO`.</li>
+ * <li>`CONVOLUTION_ALGORITHM_SEPARABLE` - Decomposes a rank-1 kernel (e.g. Gaussian, Sobel, box)
+ * into one 1D kernel per dimension and convolves them one after another. Other kernels fall
+ * back to `AUTO`.</li>
+ * <li>`CONVOLUTION_ALGORITHM_BOX` - Answers every output of a constant kernel (box or mean filter)
+ * from a summed-area table in constant time, independent of the kernel size. Other kernels and
+ * the reflect and replicate paddings fall back to `AUTO`.</li>
+ * <li>`CONVOLUTION_ALGORITHM_TUNED` - Measures all applicable engines on the first convolution of a
+ * problem (shapes, stride, padding and type) and uses the fastest one for it from then on. The
+ * choices can be saved to and loaded from a file, `AUTO` uses them as well.</li>
+ * </ul>
+ */
+typedef enum {
+    CONVOLUTION_ALGORITHM_AUTO,
+    CONVOLUTION_ALGORITHM_DIRECT,
+    CONVOLUTION_ALGORITHM_GEMM,
+    CONVOLUTION_ALGORITHM_WINOGRAD,
+    CONVOLUTION_ALGORITHM_FFT,
+    CONVOLUTION_ALGORITHM_SEPARABLE,
+    CONVOLUTION_ALGORITHM_BOX,
+    CONVOLUTION_ALGORITHM_TUNED
+} ConvolutionAlgorithm;
+
+/**
+ * Padding size, that pads every dimension so far, that the output has
+ * `ceil(size / stride)` elements ("same" convolution). When the padding is
+ * odd, the additional element is padded after the tensor.
+ */
+#define CONVOLUTION_PADDING_SAME -1
+
+/**
+ * Parameters of a single convolution call.
+ */
+typedef struct {
+    /**
+     * Stride of the kernel in every dimension.
+     */
+    int stride;
+
+    /**
+     * Engine that executes the convolution.
+     */
+    ConvolutionAlgorithm algorithm;
+
+    /**
+     * Values, that are read outside of the tensor.
+     */
+    ConvolutionPadding padding;
+
+    /**
+     * Number of padded elements before and after every dimension or
+     * `CONVOLUTION_PADDING_SAME`. Ignored with `CONVOLUTION_PADDING_VALID`.
+     */
+    int paddingSize;
+
+    /**
+     * Optional stride of every dimension of the kernel, that replaces
+     * `stride`. `NULL` uses `stride` in every dimension. The entries of
+     * the channel dimension of filter banks and of depthwise convolutions
+     * are ignored, the filters always span all channels.
+     */
+    const int* strides;
+
+    /**
+     * Optional dilation of every dimension of the kernel, neighbouring taps
+     * read elements `dilations[dim]` apart. `NULL` does not dilate. The
+     * channel dimension is never dilated, as for `strides`.
+     */
+    const int* dilations;
+} ConvolutionSettings;
+
+/**
+ * Box of a tensor, whose values changed since its last convolution.
+ */
+typedef struct {
+    /**
+     * First changed index in every dimension.
+     */
+    const int* start;
+
+    /**
+     * End of the changed indices in every dimension (exclusive).
+     */
+    const int* end;
+} ConvolutionRegion;
 
 typedef struct {
     Layer* base;
     const void* kernel;
     int stride;
+    ConvolutionAlgorithm algorithm;
+    ConvolutionPadding padding;
+    int paddingSize;
+    int isFilterBank;
+    int isDepthwise;
+    const void* pointwise;
+    WinogradKernel* winograd;
+    SeparableKernel* separable;
+    int* strides;
+    int* dilations;
 } ConvolutionLayer;
 
+ConvolutionSettings getDefaultConvolutionSettings(const int stride);
+ConvolutionSettings getPaddedConvolutionSettings(const int stride,
+    const ConvolutionPadding padding, const int paddingSize);
+ConvolutionSettings getDilatedConvolutionSettings(const int* strides, const int* dilations,
+    const ConvolutionPadding padding, const int paddingSize);
+
+void IntegerTensor_convolveWithSettings(const IntegerTensor* tensor,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const ConvolutionSettings* settings);
+
+void FloatTensor_convolveWithSettings(const FloatTensor* tensor,
+    const FloatTensor* kernel, const FloatTensor* dest, const ConvolutionSettings* settings);
+
+void DoubleTensor_convolveWithSettings(const DoubleTensor* tensor,
+    const DoubleTensor* kernel, const DoubleTensor* dest, const ConvolutionSettings* settings);
+
 void IntegerTensor_convolve(const IntegerTensor* tensor,
     const IntegerTensor* kernel, const IntegerTensor* dest, const int stride);
 
@@ -40,6 +165,84 @@ void FloatTensor_convolve(const FloatTensor* tensor,
 void DoubleTensor_convolve(const DoubleTensor* tensor,
     const DoubleTensor* kernel, const DoubleTensor* dest, const int stride);
 
+void IntegerTensor_convolveFilters(const IntegerTensor* tensor,
+    const IntegerTensor* filters, const IntegerTensor* dest, const ConvolutionSettings* settings);
+
+void FloatTensor_convolveFilters(const FloatTensor* tensor,
+    const FloatTensor* filters, const FloatTensor* dest, const ConvolutionSettings* settings);
+
+void DoubleTensor_convolveFilters(const DoubleTensor* tensor,
+    const DoubleTensor* filters, const DoubleTensor* dest, const ConvolutionSettings* settings);
+
+void IntegerTensor_convolveDepthwise(const IntegerTensor* tensor,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const ConvolutionSettings* settings);
+
+void FloatTensor_convolveDepthwise(const FloatTensor* tensor,
+    const FloatTensor* kernel, const FloatTensor* dest, const ConvolutionSettings* settings);
+
+void DoubleTensor_convolveDepthwise(const DoubleTensor* tensor,
+    const DoubleTensor* kernel, const DoubleTensor* dest, const ConvolutionSettings* settings);
+
+void IntegerTensor_convolveDepthwiseSeparable(const IntegerTensor* tensor, const IntegerTensor* depthwise,
+    const IntegerTensor* pointwise, const IntegerTensor* dest, const ConvolutionSettings* settings);
+
+void FloatTensor_convolveDepthwiseSeparable(const FloatTensor* tensor, const FloatTensor* depthwise,
+    const FloatTensor* pointwise, const FloatTensor* dest, const ConvolutionSettings* settings);
+
+void DoubleTensor_convolveDepthwiseSeparable(const DoubleTensor* tensor, const DoubleTensor* depthwise,
+    const DoubleTensor* pointwise, const DoubleTensor* dest, const ConvolutionSettings* settings);
+
+void IntegerTensor_convolveBackwardData(const IntegerTensor* gradient,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const ConvolutionSettings* settings);
+
+void FloatTensor_convolveBackwardData(const FloatTensor* gradient,
+    const FloatTensor* kernel, const FloatTensor* dest, const ConvolutionSettings* settings);
+
+void DoubleTensor_convolveBackwardData(const DoubleTensor* gradient,
+    const DoubleTensor* kernel, const DoubleTensor* dest, const ConvolutionSettings* settings);
+
+void IntegerTensor_convolveBackwardWeights(const IntegerTensor* tensor,
+    const IntegerTensor* gradient, const IntegerTensor* dest, const ConvolutionSettings* settings);
+
+void FloatTensor_convolveBackwardWeights(const FloatTensor* tensor,
+    const FloatTensor* gradient, const FloatTensor* dest, const ConvolutionSettings* settings);
+
+void DoubleTensor_convolveBackwardWeights(const DoubleTensor* tensor,
+    const DoubleTensor* gradient, const DoubleTensor* dest, const ConvolutionSettings* settings);
+
+void IntegerTensor_convolveRegions(const IntegerTensor* tensor, const IntegerTensor* kernel, const IntegerTensor* dest,
+    const ConvolutionSettings* settings, const ConvolutionRegion* regions, const int count);
+
+void FloatTensor_convolveRegions(const FloatTensor* tensor, const FloatTensor* kernel, const FloatTensor* dest,
+    const ConvolutionSettings* settings, const ConvolutionRegion* regions, const int count);
+
+void DoubleTensor_convolveRegions(const DoubleTensor* tensor, const DoubleTensor* kernel, const DoubleTensor* dest,
+    const ConvolutionSettings* settings, const ConvolutionRegion* regions, const int count);
+
+int IntegerTensor_convolveChanges(const IntegerTensor* tensor, const IntegerTensor* previous, const IntegerTensor* kernel,
+    const IntegerTensor* dest, const ConvolutionSettings* settings);
+
+int FloatTensor_convolveChanges(const FloatTensor* tensor, const FloatTensor* previous, const FloatTensor* kernel,
+    const FloatTensor* dest, const ConvolutionSettings* settings);
+
+int DoubleTensor_convolveChanges(const DoubleTensor* tensor, const DoubleTensor* previous, const DoubleTensor* kernel,
+    const DoubleTensor* dest, const ConvolutionSettings* settings);
+
+void Uint8Tensor_convolveInt8(const Uint8Tensor* tensor, const Int8Tensor* kernel,
+    const IntegerTensor* dest, const int stride);
+
+void Uint8Tensor_convolveRequantized(const Uint8Tensor* tensor, const Int8Tensor* kernel,
+    const Uint8Tensor* dest, const int stride);
+
+int saveConvolutionTuning(const char* path);
+int loadConvolutionTuning(const char* path);
+void clearConvolutionTuning();
+size_t getConvolutionTuningSize();
+
+void IntegerTensor_integralImage(const IntegerTensor* tensor, const IntegerTensor* dest);
+void FloatTensor_integralImage(const FloatTensor* tensor, const FloatTensor* dest);
+void DoubleTensor_integralImage(const DoubleTensor* tensor, const DoubleTensor* dest);
+
 ConvolutionLayer* Integer_createConvolutionLayer(const IntegerTensor* kernel,
     const IntegerTensor* destination, const int stride);
 
@@ -48,8 +251,41 @@ ConvolutionLayer* Float_createConvolutionLayer(const FloatTensor* kernel,
 
 ConvolutionLayer* Double_createConvolutionLayer(const DoubleTensor* kernel,
     const DoubleTensor* destination, const int stride);
+
+ConvolutionLayer* Integer_createFilterConvolutionLayer(const IntegerTensor* filters,
+    const IntegerTensor* destination, const int stride);
+
+ConvolutionLayer* Float_createFilterConvolutionLayer(const FloatTensor* filters,
+    const FloatTensor* destination, const int stride);
+
+ConvolutionLayer* Double_createFilterConvolutionLayer(const DoubleTensor* filters,
+    const DoubleTensor* destination, const int stride);
+
+ConvolutionLayer* Integer_createDepthwiseConvolutionLayer(const IntegerTensor* kernel,
+    const IntegerTensor* destination, const int stride);
+
+ConvolutionLayer* Float_createDepthwiseConvolutionLayer(const FloatTensor* kernel,
+    const FloatTensor* destination, const int stride);
+
+ConvolutionLayer* Double_createDepthwiseConvolutionLayer(const DoubleTensor* kernel,
+    const DoubleTensor* destination, const int stride);
+
+ConvolutionLayer* Integer_createDepthwiseSeparableLayer(const IntegerTensor* depthwise,
+    const IntegerTensor* pointwise, const IntegerTensor* destination, const int stride);
+
+ConvolutionLayer* Float_createDepthwiseSeparableLayer(const FloatTensor* depthwise,
+    const FloatTensor* pointwise, const FloatTensor* destination, const int stride);
+
+ConvolutionLayer* Double_createDepthwiseSeparableLayer(const DoubleTensor* depthwise,
+    const DoubleTensor* pointwise, const DoubleTensor* destination, const int stride);
     
+void ConvolutionLayer_setAlgorithm(ConvolutionLayer* layer, const ConvolutionAlgorithm algorithm);
+void ConvolutionLayer_setPadding(ConvolutionLayer* layer, const ConvolutionPadding padding, const int paddingSize);
+void ConvolutionLayer_setStrides(ConvolutionLayer* layer, const int* strides, const int* dilations);
 void ConvolutionLayer_forward(const ConvolutionLayer* layer, const void* input);
+void ConvolutionLayer_forwardRegions(const ConvolutionLayer* layer, const void* input,
+    const ConvolutionRegion* regions, const int count);
+int ConvolutionLayer_forwardChanges(const ConvolutionLayer* layer, const void* input, const void* previous);
 
 void ConvolutionLayer_free(ConvolutionLayer* layer);
 
@@ -0,0 +1,92 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CONVOLUTION_STREAM_H
+#define CONVOLUTION_STREAM_H
+
+#include <stdlib.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/convolution.h"
+
+/**
+ * State of a convolution over an unbounded leading (time) axis. The slices
+ * of the stream are pushed in chunks, every push emits the outputs, whose
+ * window became complete. Only the last slices, that later outputs still
+ * need, are kept in a ring buffer.
+ */
+typedef struct {
+    /**
+     * Type of the kernel, the slices and the outputs.
+     */
+    TensorType tensorType;
+
+    /**
+     * The kernel, its leading size is the number of slices of a window.
+     * It is not copied and must stay valid while the stream is used.
+     */
+    const void* kernel;
+
+    /**
+     * Stride of the kernel in every dimension (including time).
+     */
+    int stride;
+
+    /**
+     * Number of slices the ring buffer holds.
+     */
+    int capacity;
+
+    /**
+     * Ring buffer (`2 * capacity x slice shape`), every slice is stored at
+     * `t % capacity` and `t % capacity + capacity`, so the last `capacity`
+     * slices are always contiguous. `NULL` until the first push.
+     */
+    void* buffer;
+
+    /**
+     * Number of slices pushed since the creation or the last reset.
+     */
+    size_t slices;
+
+    /**
+     * Number of outputs emitted since the creation or the last reset.
+     */
+    size_t outputs;
+} ConvolutionStream;
+
+ConvolutionStream* Integer_createConvolutionStream(const IntegerTensor* kernel, const int stride);
+ConvolutionStream* Float_createConvolutionStream(const FloatTensor* kernel, const int stride);
+ConvolutionStream* Double_createConvolutionStream(const DoubleTensor* kernel, const int stride);
+
+int ConvolutionStream_getReadyOutputs(const ConvolutionStream* stream, const int slices);
+
+int Integer_ConvolutionStream_push(ConvolutionStream* stream, const IntegerTensor* slices,
+    const IntegerTensor* dest);
+int Float_ConvolutionStream_push(ConvolutionStream* stream, const FloatTensor* slices,
+    const FloatTensor* dest);
+int Double_ConvolutionStream_push(ConvolutionStream* stream, const DoubleTensor* slices,
+    const DoubleTensor* dest);
+
+void ConvolutionStream_reset(ConvolutionStream* stream);
+void ConvolutionStream_free(ConvolutionStream* stream);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef POOLING_H
+#define POOLING_H
+
+#include "Tensor/tensor.h"
+#include "Network/layer.h"
+
+/**
+ * Reductions of a pooling layer.
+ * 
+ * <ul>
+ * <li>`POOLING_MAX` - Maximum of every window.</li>
+ * <li>`POOLING_AVERAGE` - Mean of every window (truncated for INTEGER tensors).</li>
+ * <li>`POOLING_GLOBAL_AVERAGE` - Mean over all but the leading (kept) dimensions.</li>
+ * </ul>
+ */
+typedef enum {
+    POOLING_MAX,
+    POOLING_AVERAGE,
+    POOLING_GLOBAL_AVERAGE
+} PoolingType;
+
+typedef struct {
+    Layer* base;
+    PoolingType type;
+    int dimensions;
+    int* kernelShape;
+    int* strides;
+} PoolingLayer;
+
+void IntegerTensor_maxPool(const IntegerTensor* tensor, const IntegerTensor* dest,
+    const int* kernelShape, const int* strides);
+void FloatTensor_maxPool(const FloatTensor* tensor, const FloatTensor* dest,
+    const int* kernelShape, const int* strides);
+void DoubleTensor_maxPool(const DoubleTensor* tensor, const DoubleTensor* dest,
+    const int* kernelShape, const int* strides);
+
+void IntegerTensor_averagePool(const IntegerTensor* tensor, const IntegerTensor* dest,
+    const int* kernelShape, const int* strides);
+void FloatTensor_averagePool(const FloatTensor* tensor, const FloatTensor* dest,
+    const int* kernelShape, const int* strides);
+void DoubleTensor_averagePool(const DoubleTensor* tensor, const DoubleTensor* dest,
+    const int* kernelShape, const int* strides);
+
+void IntegerTensor_globalAveragePool(const IntegerTensor* tensor, const IntegerTensor* dest,
+    const int keptDimensions);
+void FloatTensor_globalAveragePool(const FloatTensor* tensor, const FloatTensor* dest,
+    const int keptDimensions);
+void DoubleTensor_globalAveragePool(const DoubleTensor* tensor, const DoubleTensor* dest,
+    const int keptDimensions);
+
+PoolingLayer* Integer_createPoolingLayer(const PoolingType type, const int dimensions,
+    const int* kernelShape, const int* strides, const IntegerTensor* destination);
+
+PoolingLayer* Float_createPoolingLayer(const PoolingType type, const int dimensions,
+    const int* kernelShape, const int* strides, const FloatTensor* destination);
+
+PoolingLayer* Double_createPoolingLayer(const PoolingType type, const int dimensions,
+    const int* kernelShape, const int* strides, const DoubleTensor* destination);
+
+PoolingLayer* Integer_createGlobalPoolingLayer(const int keptDimensions, const IntegerTensor* destination);
+PoolingLayer* Float_createGlobalPoolingLayer(const int keptDimensions, const FloatTensor* destination);
+PoolingLayer* Double_createGlobalPoolingLayer(const int keptDimensions, const DoubleTensor* destination);
+
+void PoolingLayer_forward(const PoolingLayer* layer, const void* input);
+
+void PoolingLayer_free(PoolingLayer* layer);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <stdlib.h>
+
+#include "Utils/cpu.h"
+
+/**
+ * Elementwise operations that have vectorized kernels.
+ */
+typedef enum {
+    ELEMENTWISE_ADD,
+    ELEMENTWISE_SUBTRACT,
+    ELEMENTWISE_MULTIPLY,
+    ELEMENTWISE_DIVIDE
+} ElementwiseOperation;
+
+typedef void (*Integer_ElementwiseKernel)(const int*, const int*, int*, const size_t);
+typedef void (*Float_ElementwiseKernel)(const float*, const float*, float*, const size_t);
+typedef void (*Double_ElementwiseKernel)(const double*, const double*, double*, const size_t);
+
+typedef void (*Integer_ScalarKernel)(const int*, const int, int*, const size_t);
+typedef void (*Float_ScalarKernel)(const float*, const float, float*, const size_t);
+typedef void (*Double_ScalarKernel)(const double*, const double, double*, const size_t);
+
+SimdLevel getSimdLevel();
+void setSimdLevel(const SimdLevel level);
+
+Integer_ElementwiseKernel getIntegerElementwiseKernel(const ElementwiseOperation operation);
+Float_ElementwiseKernel getFloatElementwiseKernel(const ElementwiseOperation operation);
+Double_ElementwiseKernel getDoubleElementwiseKernel(const ElementwiseOperation operation);
+
+Integer_ScalarKernel getIntegerScalarMultiplyKernel();
+Float_ScalarKernel getFloatScalarMultiplyKernel();
+Double_ScalarKernel getDoubleScalarMultiplyKernel();
+
+#endif
\ No newline at end of file
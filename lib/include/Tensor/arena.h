@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TENSOR_ARENA_H
+#define TENSOR_ARENA_H
+
+#include <stdlib.h>
+
+#include "Tensor/tensor.h"
+
+/**
+ * A bump allocator for tensors with a fixed byte budget. All tensors of
+ * the arena are released at once by resetting it.
+ * 
+ * <p><b>Note:</b><br>
+ * An arena is not synchronized, use one arena per thread (e.g. per worker
+ * or request).
+ * </p>
+ */
+typedef struct {
+    /**
+     * Memory of the arena, aligned to `TENSOR_DATA_ALIGNMENT`.
+     */
+    char* memory;
+
+    /**
+     * Number of bytes in the memory.
+     */
+    size_t capacity;
+
+    /**
+     * Number of bytes that are in use.
+     */
+    size_t used;
+
+    /**
+     * Highest number of bytes that were in use at the same time.
+     */
+    size_t peak;
+} TensorArena;
+
+TensorArena* createTensorArena(const size_t capacity);
+void TensorArena_reset(TensorArena* arena);
+size_t TensorArena_getUsedBytes(const TensorArena* arena);
+size_t TensorArena_getPeakBytes(const TensorArena* arena);
+void TensorArena_free(TensorArena* arena);
+
+IntegerTensor* IntegerTensor_arenaZeros(TensorArena* arena, const int dimensions, const int *shape);
+FloatTensor* FloatTensor_arenaZeros(TensorArena* arena, const int dimensions, const int *shape);
+DoubleTensor* DoubleTensor_arenaZeros(TensorArena* arena, const int dimensions, const int *shape);
+
+#endif
\ No newline at end of file
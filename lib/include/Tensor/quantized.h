@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef QUANTIZED_H
+#define QUANTIZED_H
+
+#include <stdint.h>
+
+#include "Tensor/tensor.h"
+
+/**
+ * Affine mapping between the stored 8-bit values and real values:
+ * `real = (stored - zeroPoint) * scale`. The parameters hold either for the
+ * whole tensor (`channels == 1`) or per index of the first dimension
+ * (`channels == shape[0]`, e.g. one scale per filter of a filter bank).
+ */
+typedef struct {
+    /**
+     * Number of scales and zero points.
+     */
+    int channels;
+
+    /**
+     * Scale of every channel.
+     */
+    float* scales;
+
+    /**
+     * Stored value of a real zero of every channel.
+     */
+    int* zeroPoints;
+} QuantizationParameters;
+
+/**
+ * A Tensor with signed 8-bit data, used for symmetric quantized weights
+ * (all zero points are `0`).
+ */
+typedef struct {
+    /**
+     * Metadata of the tensor.
+     */
+    Tensor* base;
+
+    /**
+     * Data of the tensor.
+     */
+    int8_t* data;
+
+    /**
+     * Mapping of the data to real values.
+     */
+    QuantizationParameters quantization;
+} Int8Tensor;
+
+/**
+ * A Tensor with unsigned 8-bit data, used for asymmetric quantized
+ * activations (e.g. pixels).
+ */
+typedef struct {
+    /**
+     * Metadata of the tensor.
+     */
+    Tensor* base;
+
+    /**
+     * Data of the tensor.
+     */
+    uint8_t* data;
+
+    /**
+     * Mapping of the data to real values.
+     */
+    QuantizationParameters quantization;
+} Uint8Tensor;
+
+Uint8Tensor* Uint8Tensor_zeros(const int dimensions, const int* shape, const float scale, const int zeroPoint);
+
+Int8Tensor* Int8Tensor_quantize(const FloatTensor* tensor, const int perChannel);
+Uint8Tensor* Uint8Tensor_quantize(const FloatTensor* tensor, const int perChannel);
+void Uint8Tensor_quantizeInto(const FloatTensor* tensor, const Uint8Tensor* dest);
+
+void Int8Tensor_dequantize(const Int8Tensor* tensor, const FloatTensor* dest);
+void Uint8Tensor_dequantize(const Uint8Tensor* tensor, const FloatTensor* dest);
+
+void freeInt8Tensor(Int8Tensor* tensor);
+void freeUint8Tensor(Uint8Tensor* tensor);
+
+#endif
\ No newline at end of file
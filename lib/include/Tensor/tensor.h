@@ -31,6 +31,30 @@ typedef enum TensorType {
     _TENSOR_TYPE_DOUBLE_
 } TensorType;
 
+/**
+ * Alignment in bytes of the data of tensors, that are allocated as a
+ * single block. It matches the cache line and AVX-512 register size.
+ */
+#define TENSOR_DATA_ALIGNMENT 64
+
+/**
+ * Memory layouts of a tensor.
+ * 
+ * <ul>
+ * <li>`TENSOR_ALLOCATION_SEPARATE` - The tensor, the base with its shape and
+ * the data are allocated separately.</li>
+ * <li>`TENSOR_ALLOCATION_SINGLE_BLOCK` - The tensor, base, shape and data live
+ * in a single block, with the data aligned to `TENSOR_DATA_ALIGNMENT`.</li>
+ * <li>`TENSOR_ALLOCATION_ARENA` - Same layout as a single block, but the block
+ * belongs to a TensorArena and is released when the arena is reset.</li>
+ * </ul>
+ */
+typedef enum {
+    TENSOR_ALLOCATION_SEPARATE,
+    TENSOR_ALLOCATION_SINGLE_BLOCK,
+    TENSOR_ALLOCATION_ARENA
+} TensorAllocation;
+
 /**
  * The base of all tensor subtypes with the datatypes
  * all tensors need to identify. It contains the following
@@ -40,6 +64,9 @@ typedef enum TensorType {
  * <li>Dimensions of the tensor.</li>
  * <li>Shape of each dimensions.</li>
  * <li>Number of elements / datapoints in the tensor.</li>
+ * <li>Memory layout of the tensor.</li>
+ * <li>Strides of each dimension and the offset into the data.</li>
+ * <li>Whether the tensor owns its data or is a view.</li>
  * </ul>
  */
 typedef struct {
@@ -57,6 +84,29 @@ typedef struct {
      * Number of datapoints / elements in the tensor.
      */
     size_t dataPoints;
+
+    /**
+     * How the tensor was allocated (determines how it is freed).
+     */
+    TensorAllocation allocation;
+
+    /**
+     * Array with the number of elements to skip in the data, to get to the
+     * next index of each dimension. It shares the allocation of the shape.
+     */
+    int* strides;
+
+    /**
+     * Offset of the first element from the start of the storage the data
+     * belongs to. It is `0` for tensors, that own their data.
+     */
+    size_t offset;
+
+    /**
+     * Whether the tensor owns its data. Views share the data of the tensor
+     * they were created from and do not free it.
+     */
+    int ownsData;
 } Tensor;
 
 /**
@@ -111,11 +161,25 @@ typedef struct {
     int applyGradient;
 } IntegerGradientTensor;
 
+void freeTensor(Tensor* tensor);
 void freeIntegerTensor(IntegerTensor* tensor);
 void freeFloatTensor(FloatTensor* tensor);
 void freeDoubleTensor(DoubleTensor* tensor);
 
+void checkDimensionAndShape(const int dimensions, const int *shape);
 size_t countNumberOfDataIndexes(const int dimensions, const int *shape);
+Tensor* createTensorBase(const int dimensions, const int *shape);
+
+void setTensorAllocationMode(const TensorAllocation allocation);
+TensorAllocation getTensorAllocationMode();
+void Tensor_setShape(Tensor* tensor, const int dimensions, const int *shape);
+size_t getTensorBlockSize(const int dimensions, const int *shape, const TensorType tensorType);
+void* initTensorBlock(void* block, const int dimensions, const int *shape,
+    const TensorType tensorType, const TensorAllocation allocation);
+
+int Tensor_isContiguous(const Tensor* tensor);
+size_t Tensor_getContiguousLength(const Tensor* tensor);
+size_t Tensor_getElementOffset(const Tensor* tensor, const size_t index);
 
 IntegerTensor* IntegerTensor_zeros(const int dimensions, const int *shape);
 FloatTensor* FloatTensor_zeros(const int dimensions, const int *shape);
@@ -131,5 +195,7 @@ void FloatTensor_print(const FloatTensor* tensor);
 void DoubleTensor_print(const DoubleTensor* tensor);
 
 Tensor* getTensorBaseByType(const void* tensor, const TensorType type);
+void* getTensorDataByType(const void* tensor, const TensorType type);
+void freeTensorByType(void* tensor, const TensorType type);
 
 #endif
\ No newline at end of file
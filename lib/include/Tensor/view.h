@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TENSOR_VIEW_H
+#define TENSOR_VIEW_H
+
+#include "Tensor/tensor.h"
+
+void* createTensorView(const void* tensor, const int dimensions, const int* shape,
+    const int* strides, const size_t offset, const TensorType tensorType);
+
+IntegerTensor* IntegerTensor_slice(const IntegerTensor* tensor, const int dim, const int start, const int end, const int step);
+IntegerTensor* IntegerTensor_narrow(const IntegerTensor* tensor, const int dim, const int start, const int length);
+IntegerTensor* IntegerTensor_select(const IntegerTensor* tensor, const int dim, const int index);
+IntegerTensor* IntegerTensor_transpose(const IntegerTensor* tensor, const int dim0, const int dim1);
+IntegerTensor* IntegerTensor_contiguous(const IntegerTensor* tensor);
+
+FloatTensor* FloatTensor_slice(const FloatTensor* tensor, const int dim, const int start, const int end, const int step);
+FloatTensor* FloatTensor_narrow(const FloatTensor* tensor, const int dim, const int start, const int length);
+FloatTensor* FloatTensor_select(const FloatTensor* tensor, const int dim, const int index);
+FloatTensor* FloatTensor_transpose(const FloatTensor* tensor, const int dim0, const int dim1);
+FloatTensor* FloatTensor_contiguous(const FloatTensor* tensor);
+
+DoubleTensor* DoubleTensor_slice(const DoubleTensor* tensor, const int dim, const int start, const int end, const int step);
+DoubleTensor* DoubleTensor_narrow(const DoubleTensor* tensor, const int dim, const int start, const int length);
+DoubleTensor* DoubleTensor_select(const DoubleTensor* tensor, const int dim, const int index);
+DoubleTensor* DoubleTensor_transpose(const DoubleTensor* tensor, const int dim0, const int dim1);
+DoubleTensor* DoubleTensor_contiguous(const DoubleTensor* tensor);
+
+#endif
\ No newline at end of file
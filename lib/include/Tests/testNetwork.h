@@ -28,4 +28,6 @@ void test_SN_Convolution_002();
 void test_SN_Activation_001();
 void test_SN_Activation_002();
 
+void test_SN_Pooling_001();
+
 #endif
\ No newline at end of file
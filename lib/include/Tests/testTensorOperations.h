@@ -33,6 +33,12 @@ void testTensorMultiply_002();
 void testTensorAdd_001();
 void testTensorDivide_001();
 void testTensorSubtract_001();
+void testTensorSimdKernels_001();
+void testTensorSimdKernels_002();
+void testTensorAllocation_001();
+void testTensorArena_001();
+void testTensorView_001();
+void testTensorView_002();
 
 void testTensorMean_001();
 void testTensorMean_002();
@@ -52,8 +58,31 @@ void testTensorConvole1D_002();
 void testTensorConvolve2D_001();
 void testTensorConvolve3D_001();
 void testTensorConvolve3D_002();
+void testTensorConvolveDirect_001();
+void testTensorConvolveDirect_002();
+void testTensorConvolveGemm_001();
+void testTensorConvolveWinograd_001();
+void testTensorConvolveFft_001();
+void testTensorConvolvePadding_001();
+void testTensorConvolveFilters_001();
+void testTensorConvolveFixed_001();
+void testTensorConvolveSeparable_001();
+void testTensorConvolveBox_001();
+void testTensorConvolveBatch_001();
+void testTensorConvolveTuned_001();
+void testTensorConvolveBackward_001();
+void testTensorPool_001();
+void testTensorConvolveQuantized_001();
+void testTensorConvolveStream_001();
+void testTensorConvolveChanges_001();
+void testTensorConvolveDilated_001();
+void testTensorConvolveDilated_002();
+void testTensorConvolveDepthwise_001();
+void testTensorConvolveDepthwise_002();
+void testTensorConvolveTiled_001();
 
 void profileTensorConvolve3D_001();
+void profileTensorConvolveTiled_001();
 
 
 
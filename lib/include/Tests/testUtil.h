@@ -24,4 +24,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 void testList_001();
 
+void testThreadPool_001();
+void testThreadPool_002();
+
+void testFft_001();
+
 #endif
\ No newline at end of file
@@ -0,0 +1,64 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdlib.h>
+
+/**
+ * Instruction set levels the SIMD kernels are available for.
+ * A higher level always implies the support of the lower ones.
+ */
+typedef enum {
+    SIMD_LEVEL_SCALAR,
+    SIMD_LEVEL_SSE2,
+    SIMD_LEVEL_AVX2,
+    SIMD_LEVEL_AVX512
+} SimdLevel;
+
+/**
+ * Features of the executing CPU, that are relevant for the kernels.
+ */
+typedef struct {
+    int sse2;
+    int avx2;
+    int avx512f;
+    int avx512bw;
+    int avx512vnni;
+} CpuFeatures;
+
+/**
+ * Sizes of the data caches of a core in bytes.
+ */
+typedef struct {
+    size_t l1d;
+    size_t l2;
+    size_t l3;
+} CacheSizes;
+
+const CpuFeatures* getCpuFeatures();
+SimdLevel detectSimdLevel();
+const char* getSimdLevelName(const SimdLevel level);
+const CacheSizes* getCacheSizes();
+void configureCacheSizes(const size_t l1d, const size_t l2, const size_t l3);
+
+#endif
\ No newline at end of file
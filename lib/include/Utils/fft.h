@@ -0,0 +1,41 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdlib.h>
+
+/**
+ * Precomputed twiddle factors and bit reversal tables of a radix-2 FFT
+ * with a fixed power of two length.
+ */
+typedef struct FftPlan FftPlan;
+
+FftPlan* createFftPlan(const size_t length);
+size_t FftPlan_getLength(const FftPlan* plan);
+void FftPlan_free(FftPlan* plan);
+
+void Fft_complex(const FftPlan* plan, double* data, const int inverse);
+void Fft_realForward(const FftPlan* plan, const double* input, double* output);
+void Fft_realInverse(const FftPlan* plan, const double* input, double* output);
+
+#endif
\ No newline at end of file
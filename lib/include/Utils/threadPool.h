@@ -0,0 +1,46 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdlib.h>
+
+/**
+ * Function that processes the index range [start; end) of a parallel loop.
+ * The context is passed through from the caller unchanged.
+ */
+typedef void (*ParallelTask)(const size_t start, const size_t end, void* context);
+
+typedef struct ThreadPool ThreadPool;
+
+ThreadPool* createThreadPool(const int workerCount, const int pinThreads);
+void ThreadPool_parallelFor(ThreadPool* pool, const size_t start, const size_t end,
+    const size_t grainSize, const ParallelTask task, void* context);
+int ThreadPool_getWorkerCount(const ThreadPool* pool);
+void ThreadPool_free(ThreadPool* pool);
+
+ThreadPool* getDefaultThreadPool();
+void configureDefaultThreadPool(const int workerCount, const int pinThreads);
+void parallelFor(const size_t start, const size_t end, const size_t grainSize,
+    const ParallelTask task, void* context);
+
+#endif
\ No newline at end of file
@@ -25,6 +25,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Operations/convolution.h"
 #include "Operations/activation.h"
+#include "Operations/pooling.h"
 
 #define true 1
 #define false 0
@@ -70,6 +71,9 @@ void SequentialNetwork_free(SequentialNetwork* network) {
         case ACTIVATION:
             (void)ActivationLayer_free(layer);
             break;
+        case POOLING:
+            (void)PoolingLayer_free(layer);
+            break;
         }
 
         (void)free(entry);
@@ -90,6 +94,11 @@ void* executeLayer(const NetworkEntry* entry, void* input) {
         (void)ActivationLayer_forward(layer, input);
         return layer->base->destination;
     }
+    case POOLING: {
+        PoolingLayer* layer = (PoolingLayer*)entry->layer;
+        (void)PoolingLayer_forward(layer, input);
+        return layer->base->destination;
+    }
     }
     }
 
@@ -0,0 +1,340 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Operations/simd.h"
+#include "Utils/threadPool.h"
+#include "Utils/list.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * First line of a saved tuning table. Every following line holds one
+ * choice: `<engine> <key length> <key...>`.
+ */
+#define TUNING_FILE_HEADER "TO-Core convolution tuning 2"
+
+/**
+ * Upper bound of the key length accepted from a file (6 + 6 * dimensions).
+ */
+#define TUNING_MAX_KEY_LENGTH 1024
+
+/**
+ * A tuned choice: the signature of a convolution problem and the engine,
+ * that executes it the fastest on this host.
+ */
+typedef struct {
+    int* key;
+    int length;
+    int algorithm;
+} TuningEntry;
+
+/**
+ * All tuned choices of the process, created on the first store.
+ */
+static List* TUNING_TABLE = NULL;
+static pthread_mutex_t TUNING_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Creates the signature of a convolution problem. Two problems with the
+ * same signature are executed by the same code paths of every engine.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The key holds the type, the stride, the padding mode, the number of
+ * dimensions, the SIMD level and the number of pool workers, followed by
+ * the tensor shape, the kernel shape, the output shape and the padding
+ * before every dimension. The output shape and the padding capture the
+ * padding size. Problems without a shared stride append the stride and
+ * the dilation of every dimension.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * The SIMD level and the workers change the speed of the engines, a
+ * choice tuned under other values misses and is tuned again.
+ * </p>
+ * 
+ * @param *problem  The convolution.
+ * @param *length   Pointer to write the length of the key to.
+ * 
+ * @return The key or `NULL` on failure.
+ */
+static int* createTuningKey(const ConvolutionProblem* problem, int* length) {
+    const int dims = problem->tensorBase->dimensions;
+    const int keyLength = problem->stride > 0 ? 6 + 4 * dims : 6 + 6 * dims;
+    int* key = (int*)malloc(keyLength * sizeof(int));
+
+    if (key == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the tuning key (convolution).");
+        return NULL;
+    }
+
+    key[0] = (int)problem->tensorType;
+    key[1] = problem->stride;
+    key[2] = (int)problem->padding;
+    key[3] = dims;
+    key[4] = (int)getSimdLevel();
+    key[5] = ThreadPool_getWorkerCount(getDefaultThreadPool());
+
+    for (int i = 0; i < dims; i++) {
+        key[6 + i] = problem->tensorBase->shape[i];
+        key[6 + dims + i] = problem->kernelBase->shape[i];
+        key[6 + 2 * dims + i] = problem->outputShape[i];
+        key[6 + 3 * dims + i] = problem->paddingBefore[i];
+
+        if (problem->stride == 0) {
+            key[6 + 4 * dims + i] = problem->strides[i];
+            key[6 + 5 * dims + i] = problem->dilations[i];
+        }
+    }
+
+    *length = keyLength;
+    return key;
+}
+
+/**
+ * Searches the entry with the given key, the lock must be held.
+ * 
+ * @param *key      The signature of the problem.
+ * @param length    Length of the key.
+ * 
+ * @return The entry or `NULL`, when the problem was not tuned yet.
+ */
+static TuningEntry* findTuningEntry(const int* key, const int length) {
+    if (TUNING_TABLE == NULL) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < TUNING_TABLE->size; i++) {
+        TuningEntry* entry = (TuningEntry*)TUNING_TABLE->list[i];
+
+        if (entry->length == length && memcmp(entry->key, key, length * sizeof(int)) == 0) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Stores a choice, the lock must be held. A previous choice for the same
+ * key is replaced.
+ * 
+ * @param *key          The signature of the problem, the table takes its ownership.
+ * @param length        Length of the key.
+ * @param algorithm     The chosen engine.
+ */
+static void storeTuningEntry(int* key, const int length, const int algorithm) {
+    TuningEntry* entry = (TuningEntry*)findTuningEntry(key, length);
+
+    if (entry != NULL) {
+        entry->algorithm = algorithm;
+        (void)free(key);
+        return;
+    }
+
+    if (TUNING_TABLE == NULL) {
+        TUNING_TABLE = (List*)createNewList(16);
+    }
+
+    entry = TUNING_TABLE == NULL ? NULL : (TuningEntry*)malloc(sizeof(TuningEntry));
+
+    if (entry == NULL) {
+        if (TUNING_TABLE != NULL) {
+            (void)throwMemoryAllocationException("Error on allocating memory for the tuning table (convolution).");
+        }
+
+        (void)free(key);
+        return;
+    }
+
+    entry->key = key;
+    entry->length = length;
+    entry->algorithm = algorithm;
+    (void)List_append(TUNING_TABLE, entry);
+}
+
+/**
+ * Returns the engine, that was tuned for the given problem.
+ * 
+ * @param *problem  The convolution.
+ * 
+ * @return The engine or `-1`, when the problem was not tuned yet.
+ */
+int getTunedAlgorithm(const ConvolutionProblem* problem) {
+    int length = 0;
+    int* key = (int*)createTuningKey(problem, &length);
+
+    if (key == NULL) {
+        return -1;
+    }
+
+    (void)pthread_mutex_lock(&TUNING_LOCK);
+    const TuningEntry* entry = (TuningEntry*)findTuningEntry(key, length);
+    const int algorithm = entry == NULL ? -1 : entry->algorithm;
+    (void)pthread_mutex_unlock(&TUNING_LOCK);
+
+    (void)free(key);
+    return algorithm;
+}
+
+/**
+ * Stores the engine, that executes the given problem the fastest.
+ * 
+ * @param *problem      The convolution.
+ * @param algorithm     The fastest engine.
+ */
+void setTunedAlgorithm(const ConvolutionProblem* problem, const int algorithm) {
+    int length = 0;
+    int* key = (int*)createTuningKey(problem, &length);
+
+    if (key == NULL) {
+        return;
+    }
+
+    (void)pthread_mutex_lock(&TUNING_LOCK);
+    (void)storeTuningEntry(key, length, algorithm);
+    (void)pthread_mutex_unlock(&TUNING_LOCK);
+}
+
+/**
+ * Returns the number of tuned problems.
+ * 
+ * @return The size of the tuning table.
+ */
+size_t getTuningTableSize() {
+    (void)pthread_mutex_lock(&TUNING_LOCK);
+    const size_t size = TUNING_TABLE == NULL ? 0 : TUNING_TABLE->size;
+    (void)pthread_mutex_unlock(&TUNING_LOCK);
+    return size;
+}
+
+/**
+ * Removes all tuned choices.
+ */
+void clearTuningTable() {
+    (void)pthread_mutex_lock(&TUNING_LOCK);
+
+    if (TUNING_TABLE != NULL) {
+        for (size_t i = 0; i < TUNING_TABLE->size; i++) {
+            TuningEntry* entry = (TuningEntry*)TUNING_TABLE->list[i];
+            (void)free(entry->key);
+            (void)free(entry);
+        }
+
+        (void)List_free(TUNING_TABLE);
+        TUNING_TABLE = NULL;
+    }
+
+    (void)pthread_mutex_unlock(&TUNING_LOCK);
+}
+
+/**
+ * Writes all tuned choices to a text file.
+ * 
+ * @param *path     Path of the file, an existing file is replaced.
+ * 
+ * @return `true` on success, `false` when the file could not be written.
+ */
+int saveTuningTable(const char* path) {
+    FILE* file = fopen(path, "w");
+
+    if (file == NULL) {
+        return false;
+    }
+
+    int success = fprintf(file, "%s\n", TUNING_FILE_HEADER) > 0;
+    (void)pthread_mutex_lock(&TUNING_LOCK);
+
+    for (size_t i = 0; TUNING_TABLE != NULL && i < TUNING_TABLE->size && success; i++) {
+        const TuningEntry* entry = (TuningEntry*)TUNING_TABLE->list[i];
+        success = fprintf(file, "%d %d", entry->algorithm, entry->length) > 0;
+
+        for (int k = 0; k < entry->length && success; k++) {
+            success = fprintf(file, " %d", entry->key[k]) > 0;
+        }
+
+        success = success && fprintf(file, "\n") > 0;
+    }
+
+    (void)pthread_mutex_unlock(&TUNING_LOCK);
+    return fclose(file) == 0 && success;
+}
+
+/**
+ * Reads tuned choices from a file written by `saveTuningTable`. The choices
+ * are merged into the table, they replace choices for the same problems.
+ * 
+ * <p><b>Note:</b><br>
+ * Reading stops at the first malformed line, all choices before it are
+ * kept. The engines are validated on use, a choice that does not apply
+ * to its problem falls back to the automatic choice.
+ * </p>
+ * 
+ * @param *path     Path of the file.
+ * 
+ * @return `true` when the whole file was read, `false` when it could not
+ * be opened or is malformed.
+ */
+int loadTuningTable(const char* path) {
+    FILE* file = fopen(path, "r");
+
+    if (file == NULL) {
+        return false;
+    }
+
+    char header[64];
+    int success = fgets(header, sizeof(header), file) != NULL
+                && strncmp(header, TUNING_FILE_HEADER, strlen(TUNING_FILE_HEADER)) == 0;
+    int algorithm = 0;
+    int length = 0;
+
+    while (success && fscanf(file, "%d %d", &algorithm, &length) == 2) {
+        int* key = length > 0 && length <= TUNING_MAX_KEY_LENGTH ? (int*)malloc(length * sizeof(int)) : NULL;
+
+        for (int k = 0; key != NULL && k < length; k++) {
+            if (fscanf(file, "%d", key + k) != 1) {
+                (void)free(key);
+                key = NULL;
+            }
+        }
+
+        if (key == NULL) {
+            success = false;
+            break;
+        }
+
+        (void)pthread_mutex_lock(&TUNING_LOCK);
+        (void)storeTuningEntry(key, length, algorithm);
+        (void)pthread_mutex_unlock(&TUNING_LOCK);
+    }
+
+    success = success && feof(file);
+    (void)fclose(file);
+    return success;
+}
\ No newline at end of file
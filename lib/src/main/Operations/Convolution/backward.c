@@ -0,0 +1,401 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Operations/simd.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Maximum number of partial weight gradients. The output rows are split
+ * into this many chunks, independent of the number of threads, so the
+ * summation order and the result do not depend on the thread count.
+ */
+#define WEIGHT_GRADIENT_MAX_CHUNKS 64
+
+/**
+ * Number of independent sums of a tap, that run over neighbouring outputs.
+ * They fill one AVX-512 register of INTEGER and FLOAT values.
+ */
+#define WEIGHT_GRADIENT_LANES 16
+
+/**
+ * Adds the interior outputs of an output row onto the gradients of the taps
+ * of one kernel row.
+ */
+typedef void (*WeightGradientRow)(void* partial, const void* gradient, const void* input,
+    const int count, const ptrdiff_t step, const ptrdiff_t tapStep, const int kernelWidth);
+
+/**
+ * Adds the border outputs of an output row, whose taps might read padding,
+ * onto the gradients of the taps of one kernel row.
+ */
+typedef void (*WeightGradientBorder)(void* partial, const void* gradient, const void* input,
+    const int* indices, const int from, const int to, const int kernelWidth);
+
+/**
+ * Sums the partial gradients of all chunks into the weight gradient.
+ */
+typedef void (*WeightGradientReduce)(void* dest, const void* partials, const int chunks, const size_t taps);
+
+/**
+ * Shared state of the threads computing a weight gradient.
+ */
+typedef struct {
+    const ConvolutionProblem* problem;
+    const char* input;
+    const char* gradient;
+    char* partials;
+    WeightGradientRow row;
+    WeightGradientBorder border;
+    size_t outputRows;
+    int outputWidth;
+    int kernelRows;
+    int kernelWidth;
+    int chunks;
+    int interiorFirst;
+    int interiorEnd;
+    size_t elementSize;
+} WeightGradientContext;
+
+/**
+ * Generates the row function of one type and SIMD level.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The gradient of a tap is the dot product of the output gradients with
+ * the inputs the tap reads. Four taps are summed at once, so every output
+ * gradient is loaded once per group and the four independent sums hide the
+ * latency of the additions. Every tap keeps `WEIGHT_GRADIENT_LANES` sums
+ * over neighbouring outputs, which are vectorized without reordering the
+ * additions of a single sum. Unit distances are compiled separately.
+ * </p>
+ */
+#define DEFINE_WEIGHT_GRADIENT_ROW(name, attributes, type) \
+    attributes \
+    static inline void name##Taps(type* restrict partial, const type* restrict gradient, \
+        const type* restrict input, const int count, const ptrdiff_t step, const ptrdiff_t tapStep, \
+        const int kernelWidth) { \
+        for (int kx = 0; kx < kernelWidth; kx += 4) { \
+            const int group = kernelWidth - kx < 4 ? kernelWidth - kx : 4; \
+            const type* restrict tap0 = input + kx * tapStep; \
+            const type* restrict tap1 = group > 1 ? tap0 + tapStep : tap0; \
+            const type* restrict tap2 = group > 2 ? tap0 + 2 * tapStep : tap0; \
+            const type* restrict tap3 = group > 3 ? tap0 + 3 * tapStep : tap0; \
+            type lanes0[WEIGHT_GRADIENT_LANES] = {0}; \
+            type lanes1[WEIGHT_GRADIENT_LANES] = {0}; \
+            type lanes2[WEIGHT_GRADIENT_LANES] = {0}; \
+            type lanes3[WEIGHT_GRADIENT_LANES] = {0}; \
+            int x = 0; \
+            for (; x + WEIGHT_GRADIENT_LANES <= count; x += WEIGHT_GRADIENT_LANES) { \
+                for (int l = 0; l < WEIGHT_GRADIENT_LANES; l++) { \
+                    const type g = gradient[x + l]; \
+                    lanes0[l] += g * tap0[(x + l) * step]; \
+                    lanes1[l] += g * tap1[(x + l) * step]; \
+                    lanes2[l] += g * tap2[(x + l) * step]; \
+                    lanes3[l] += g * tap3[(x + l) * step]; \
+                } \
+            } \
+            type sums[4] = {0, 0, 0, 0}; \
+            for (int l = 0; l < WEIGHT_GRADIENT_LANES; l++) { \
+                sums[0] += lanes0[l]; \
+                sums[1] += lanes1[l]; \
+                sums[2] += lanes2[l]; \
+                sums[3] += lanes3[l]; \
+            } \
+            for (; x < count; x++) { \
+                sums[0] += gradient[x] * tap0[x * step]; \
+                sums[1] += gradient[x] * tap1[x * step]; \
+                sums[2] += gradient[x] * tap2[x * step]; \
+                sums[3] += gradient[x] * tap3[x * step]; \
+            } \
+            for (int t = 0; t < group; t++) { \
+                partial[kx + t] += sums[t]; \
+            } \
+        } \
+    } \
+    attributes \
+    static void name(void* partial, const void* gradient, const void* input, const int count, \
+        const ptrdiff_t step, const ptrdiff_t tapStep, const int kernelWidth) { \
+        if (step == 1) { \
+            name##Taps((type*)partial, (const type*)gradient, (const type*)input, count, 1, tapStep, kernelWidth); \
+        } else { \
+            name##Taps((type*)partial, (const type*)gradient, (const type*)input, count, step, tapStep, kernelWidth); \
+        } \
+    }
+
+DEFINE_WEIGHT_GRADIENT_ROW(Integer_weightGradientRow, , int)
+DEFINE_WEIGHT_GRADIENT_ROW(Float_weightGradientRow, , float)
+DEFINE_WEIGHT_GRADIENT_ROW(Double_weightGradientRow, , double)
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_WEIGHT_GRADIENT_ROW(Integer_weightGradientRow_avx2, __attribute__((target("avx2"))), int)
+DEFINE_WEIGHT_GRADIENT_ROW(Float_weightGradientRow_avx2, __attribute__((target("avx2"))), float)
+DEFINE_WEIGHT_GRADIENT_ROW(Double_weightGradientRow_avx2, __attribute__((target("avx2"))), double)
+
+// AVX-512 implies FMA, the results should not depend on the SIMD level.
+DEFINE_WEIGHT_GRADIENT_ROW(Integer_weightGradientRow_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), int)
+DEFINE_WEIGHT_GRADIENT_ROW(Float_weightGradientRow_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), float)
+DEFINE_WEIGHT_GRADIENT_ROW(Double_weightGradientRow_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), double)
+#endif
+
+/**
+ * Generates the border and the reduction function of one type.
+ * 
+ * <p><b>Note:</b><br>
+ * The border function gets the resolved input index of every padded
+ * position of the row (`-1` for zeros of the padding), so mirrored paddings
+ * add their gradient onto the mirrored inputs.
+ * </p>
+ */
+#define DEFINE_WEIGHT_GRADIENT_HELPERS(prefix, type) \
+    static void prefix##_weightGradientBorder(void* partial, const void* gradient, const void* input, \
+        const int* indices, const int from, const int to, const int kernelWidth) { \
+        type* sums = (type*)partial; \
+        const type* outputs = (const type*)gradient; \
+        const type* values = (const type*)input; \
+        for (int x = from; x < to; x++) { \
+            for (int kx = 0; kx < kernelWidth; kx++) { \
+                const int index = indices[x * kernelWidth + kx]; \
+                if (index >= 0) { \
+                    sums[kx] += outputs[x] * values[index]; \
+                } \
+            } \
+        } \
+    } \
+    static void prefix##_weightGradientReduce(void* dest, const void* partials, const int chunks, \
+        const size_t taps) { \
+        type* result = (type*)dest; \
+        const type* sums = (const type*)partials; \
+        for (size_t k = 0; k < taps; k++) { \
+            type sum = 0; \
+            for (int chunk = 0; chunk < chunks; chunk++) { \
+                sum += sums[chunk * taps + k]; \
+            } \
+            result[k] = sum; \
+        } \
+    }
+
+DEFINE_WEIGHT_GRADIENT_HELPERS(Integer, int)
+DEFINE_WEIGHT_GRADIENT_HELPERS(Float, float)
+DEFINE_WEIGHT_GRADIENT_HELPERS(Double, double)
+
+/**
+ * Selects the row function for the type and the active SIMD level.
+ * 
+ * @param tensorType    Type of the tensors.
+ * 
+ * @return The row function.
+ */
+static WeightGradientRow selectWeightGradientRow(const TensorType tensorType) {
+    const SimdLevel level = getSimdLevel();
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_weightGradientRow_avx512 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_weightGradientRow_avx512 : Double_weightGradientRow_avx512;
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_weightGradientRow_avx2 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_weightGradientRow_avx2 : Double_weightGradientRow_avx2;
+    }
+#endif
+
+    (void)level;
+    return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_weightGradientRow :
+            tensorType == _TENSOR_TYPE_FLOAT_ ? Float_weightGradientRow : Double_weightGradientRow;
+}
+
+/**
+ * Calculates the input offset of a kernel row at an output row.
+ * 
+ * @param *problem      The convolution.
+ * @param *coordinates  Coordinates of the output row (all dimensions but the last).
+ * @param kernelRow     Index of the kernel row in row-major order.
+ * 
+ * @return The offset in the tensor data or `-1` when the kernel row reads
+ * a zero of the padding.
+ */
+static ptrdiff_t getKernelRowOffset(const ConvolutionProblem* problem, const int* coordinates, const int kernelRow) {
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+    int rest = kernelRow;
+    ptrdiff_t offset = 0;
+
+    for (int dim = tensorBase->dimensions - 2; dim >= 0; dim--) {
+        const int k = rest % kernelBase->shape[dim];
+        const int index = resolvePaddedIndex(coordinates[dim] * problem->stride - problem->paddingBefore[dim] + k,
+            tensorBase->shape[dim], problem->padding);
+
+        if (index < 0) {
+            return -1;
+        }
+
+        rest /= kernelBase->shape[dim];
+        offset += (ptrdiff_t)index * tensorBase->strides[dim];
+    }
+
+    return offset;
+}
+
+/**
+ * Computes the partial weight gradients of the chunks [from; to). Every
+ * chunk owns a dense partial gradient of all taps, so the threads never
+ * write to the same memory.
+ * 
+ * @param from      First chunk.
+ * @param to        End of the chunks (exclusive).
+ * @param *context  The WeightGradientContext.
+ */
+static void weightGradientTask(const size_t from, const size_t to, void* context) {
+    const WeightGradientContext* weights = (WeightGradientContext*)context;
+    const ConvolutionProblem* problem = weights->problem;
+    const Tensor* tensorBase = problem->tensorBase;
+    const int last = tensorBase->dimensions - 1;
+    const int width = weights->outputWidth;
+    const int kernelWidth = weights->kernelWidth;
+    const ptrdiff_t tapStep = tensorBase->strides[last];
+    const size_t taps = (size_t)weights->kernelRows * kernelWidth;
+    int* coordinates = (int*)malloc((last + 1) * sizeof(int));
+    int* indices = (int*)malloc((size_t)width * kernelWidth * sizeof(int));
+
+    if (coordinates == NULL || indices == NULL) {
+        if (coordinates != NULL) (void)free(coordinates);
+        if (indices != NULL) (void)free(indices);
+        (void)throwMemoryAllocationException("Error on allocating memory for the weight gradient (convolution).");
+        return;
+    }
+
+    // Input indices of the last dimension, they are the same for every row.
+    for (int x = 0; x < width; x++) {
+        for (int kx = 0; kx < kernelWidth; kx++) {
+            const int index = resolvePaddedIndex(x * problem->stride - problem->paddingBefore[last] + kx,
+                tensorBase->shape[last], problem->padding);
+            indices[x * kernelWidth + kx] = index < 0 ? -1 : (int)(index * tapStep);
+        }
+    }
+
+    for (size_t chunk = from; chunk < to; chunk++) {
+        char* partial = weights->partials + chunk * taps * weights->elementSize;
+        const size_t firstRow = chunk * weights->outputRows / weights->chunks;
+        const size_t endRow = (chunk + 1) * weights->outputRows / weights->chunks;
+
+        for (size_t row = firstRow; row < endRow; row++) {
+            const char* gradient = weights->gradient + row * width * weights->elementSize;
+            size_t rest = row;
+
+            for (int dim = last - 1; dim >= 0; dim--) {
+                coordinates[dim] = (int)(rest % problem->outputShape[dim]);
+                rest /= problem->outputShape[dim];
+            }
+
+            for (int r = 0; r < weights->kernelRows; r++) {
+                const ptrdiff_t offset = getKernelRowOffset(problem, coordinates, r);
+
+                if (offset < 0) {
+                    continue;
+                }
+
+                const char* input = weights->input + offset * (ptrdiff_t)weights->elementSize;
+                char* sums = partial + (size_t)r * kernelWidth * weights->elementSize;
+                const int first = weights->interiorFirst;
+                const int end = weights->interiorEnd;
+
+                (void)weights->border(sums, gradient, input, indices, 0, first, kernelWidth);
+
+                if (first < end) {
+                    const ptrdiff_t start = ((ptrdiff_t)first * problem->stride - problem->paddingBefore[last]) * tapStep;
+                    (void)weights->row(sums, gradient + first * weights->elementSize,
+                        input + start * (ptrdiff_t)weights->elementSize, end - first,
+                        problem->stride * tapStep, tapStep, kernelWidth);
+                }
+
+                (void)weights->border(sums, gradient, input, indices, end, width, kernelWidth);
+            }
+        }
+    }
+
+    (void)free(coordinates);
+    (void)free(indices);
+}
+
+/**
+ * Computes the gradient of the loss with respect to the kernel of a
+ * convolution: every tap is the sum of the output gradients times the
+ * inputs the tap read in the forward pass.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The problem describes the forward convolution, but its kernel is the
+ * destination of the weight gradient (written densely) and its destination
+ * is the gradient of the outputs (read densely). The output rows are split
+ * into a fixed number of chunks, every chunk accumulates a private dense
+ * gradient of all taps, which are summed at the end. Thus the threads never
+ * share a cache line of the gradient and the result does not depend on the
+ * thread count.
+ * </p>
+ * 
+ * @param *problem  The forward convolution.
+ */
+void convolveWeightGradient(const ConvolutionProblem* problem) {
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+    const int last = tensorBase->dimensions - 1;
+    const int kernelWidth = kernelBase->shape[last];
+    const size_t taps = kernelBase->dataPoints;
+    const size_t elementSize = problem->tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const int outputWidth = problem->outputShape[last];
+    const size_t outputRows = outputWidth == 0 ? 0 : problem->outputs / outputWidth;
+    const int chunks = outputRows < WEIGHT_GRADIENT_MAX_CHUNKS ? (int)outputRows : WEIGHT_GRADIENT_MAX_CHUNKS;
+    char* dest = (char*)getTensorDataByType(problem->kernel, problem->tensorType);
+
+    if (chunks == 0) {
+        (void)memset(dest, 0, taps * elementSize);
+        return;
+    }
+
+    char* partials = (char*)calloc((size_t)chunks * taps, elementSize);
+
+    if (partials == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the weight gradient (convolution).");
+        return;
+    }
+
+    WeightGradientContext context = {problem, (const char*)getTensorDataByType(problem->tensor, problem->tensorType),
+        (const char*)getTensorDataByType(problem->dest, problem->tensorType), partials,
+        selectWeightGradientRow(problem->tensorType), NULL, outputRows, outputWidth,
+        (int)(taps / kernelWidth), kernelWidth, chunks, 0, 0, elementSize};
+
+    context.border = problem->tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_weightGradientBorder :
+                    problem->tensorType == _TENSOR_TYPE_FLOAT_ ? Float_weightGradientBorder : Double_weightGradientBorder;
+    (void)getInteriorOutputRange(problem, last, &context.interiorFirst, &context.interiorEnd);
+    (void)parallelFor(0, chunks, 1, weightGradientTask, &context);
+
+    const WeightGradientReduce reduce = problem->tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_weightGradientReduce :
+                    problem->tensorType == _TENSOR_TYPE_FLOAT_ ? Float_weightGradientReduce : Double_weightGradientReduce;
+    (void)reduce(dest, partials, chunks, taps);
+    (void)free(partials);
+}
\ No newline at end of file
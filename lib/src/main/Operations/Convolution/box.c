@@ -0,0 +1,502 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Number of table values, that a thread accumulates at least per task.
+ */
+#define BOX_GRAIN_VALUES 4096
+
+/**
+ * Number of table rows, whose running sums are formed at once.
+ */
+#define INTEGRAL_ROW_GROUP 4
+
+/**
+ * Summed-area table of a tensor. Every dimension starts with a plane of
+ * zeros, so the value at `i + 1` is the sum of all tensor values at
+ * indices up to `i` and a box sum never needs a bounds check. INTEGER
+ * tensors are summed into `long long`, FLOAT and DOUBLE tensors into
+ * `double`, so the differences of large sums keep their precision.
+ */
+typedef struct {
+    const Tensor* tensorBase;
+    const char* data;
+    void* values;
+    size_t* strides;
+    size_t size;
+    int rowBlocks;
+    int dim;
+} IntegralTable;
+
+/**
+ * Parameters of the box sums of a convolution.
+ */
+typedef struct {
+    const ConvolutionProblem* problem;
+    const IntegralTable* table;
+    char* output;
+    int first;
+    int end;
+    int width;
+} BoxContext;
+
+/**
+ * Generates the task, that sums the rows [from; to) of the table along the
+ * last dimension. Rows in a plane of zeros are cleared, the others hold the
+ * running sums of their tensor row.
+ * 
+ * <p><b>Functionality:</b><br>
+ * A running sum is a chain of dependent additions, so four rows are summed
+ * at once to overlap their chains.
+ * </p>
+ */
+#define DEFINE_INTEGRAL_ROWS(name, type, accumulator) \
+    static inline void name##Group(const type* restrict input0, const type* restrict input1, \
+        const type* restrict input2, const type* restrict input3, accumulator* restrict sums0, \
+        accumulator* restrict sums1, accumulator* restrict sums2, accumulator* restrict sums3, \
+        const int width, const size_t step) { \
+        accumulator sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0; \
+        for (int x = 0; x < width; x++) { \
+            sum0 += input0[x * step]; \
+            sum1 += input1[x * step]; \
+            sum2 += input2[x * step]; \
+            sum3 += input3[x * step]; \
+            sums0[x] = sum0; \
+            sums1[x] = sum1; \
+            sums2[x] = sum2; \
+            sums3[x] = sum3; \
+        } \
+    } \
+    static void name(const size_t from, const size_t to, void* context) { \
+        const IntegralTable* table = (IntegralTable*)context; \
+        const Tensor* tensorBase = table->tensorBase; \
+        const int last = tensorBase->dimensions - 1; \
+        const int width = tensorBase->shape[last]; \
+        const size_t step = tensorBase->strides[last]; \
+        const type* inputs[INTEGRAL_ROW_GROUP]; \
+        accumulator* outputs[INTEGRAL_ROW_GROUP]; \
+        int pending = 0; \
+        for (size_t row = from; row < to; row++) { \
+            size_t rest = row; \
+            size_t offset = 0; \
+            int zero = false; \
+            for (int dim = last - 1; dim >= 0; dim--) { \
+                const size_t index = rest % ((size_t)tensorBase->shape[dim] + 1); \
+                rest /= (size_t)tensorBase->shape[dim] + 1; \
+                zero = zero || index == 0; \
+                offset += zero ? 0 : (index - 1) * tensorBase->strides[dim]; \
+            } \
+            accumulator* sums = (accumulator*)table->values + row * (width + 1); \
+            if (zero) { \
+                (void)memset(sums, 0, (width + 1) * sizeof(accumulator)); \
+                continue; \
+            } \
+            sums[0] = 0; \
+            inputs[pending] = (const type*)table->data + offset; \
+            outputs[pending] = sums + 1; \
+            if (++pending == INTEGRAL_ROW_GROUP) { \
+                name##Group(inputs[0], inputs[1], inputs[2], inputs[3], \
+                    outputs[0], outputs[1], outputs[2], outputs[3], width, step); \
+                pending = 0; \
+            } \
+        } \
+        for (int p = 0; p < pending; p++) { \
+            accumulator sum = 0; \
+            for (int x = 0; x < width; x++) { \
+                sum += inputs[p][x * step]; \
+                outputs[p][x] = sum; \
+            } \
+        } \
+    }
+
+DEFINE_INTEGRAL_ROWS(Integer_integralRows, int, long long)
+DEFINE_INTEGRAL_ROWS(Float_integralRows, float, double)
+DEFINE_INTEGRAL_ROWS(Double_integralRows, double, double)
+
+/**
+ * Generates the task, that accumulates the table along a dimension, that
+ * is not the last one. A task covers a block of the values behind the
+ * dimension in one slab of the dimensions in front of it, so the innermost
+ * loop runs over neighbouring values.
+ */
+#define DEFINE_INTEGRAL_COLUMNS(name, accumulator) \
+    static void name(const size_t from, const size_t to, void* context) { \
+        const IntegralTable* table = (IntegralTable*)context; \
+        const int dim = table->dim; \
+        const size_t inner = table->strides[dim]; \
+        const size_t planes = (size_t)table->tensorBase->shape[dim] + 1; \
+        for (size_t task = from; task < to; task++) { \
+            const size_t slab = task / table->rowBlocks; \
+            const size_t start = (task % table->rowBlocks) * BOX_GRAIN_VALUES; \
+            const size_t count = inner - start < BOX_GRAIN_VALUES ? inner - start : BOX_GRAIN_VALUES; \
+            accumulator* values = (accumulator*)table->values + slab * planes * inner + start; \
+            for (size_t plane = 2; plane < planes; plane++) { \
+                accumulator* restrict current = values + plane * inner; \
+                const accumulator* restrict previous = current - inner; \
+                for (size_t i = 0; i < count; i++) { \
+                    current[i] += previous[i]; \
+                } \
+            } \
+        } \
+    }
+
+DEFINE_INTEGRAL_COLUMNS(Integer_integralColumns, long long)
+DEFINE_INTEGRAL_COLUMNS(Double_integralColumns, double)
+
+/**
+ * Builds the summed-area table of a tensor.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The rows of the tensor are summed along the last dimension first, then
+ * the table is accumulated along every other dimension from the back.
+ * Every pass is distributed over the threads.
+ * </p>
+ * 
+ * @param *tensor       The tensor, can be a strided view.
+ * @param tensorType    Type of the tensor.
+ * @param *table        The table to build.
+ * 
+ * @return `true` on success.
+ * 
+ * @throw MemoryAllocationException - When the table could not be allocated.
+ */
+static int buildIntegralTable(const void* tensor, const TensorType tensorType, IntegralTable* table) {
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const int dims = tensorBase->dimensions;
+    size_t size = 1;
+
+    table->strides = (size_t*)malloc(dims * sizeof(size_t));
+
+    if (table->strides == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the summed-area table.");
+        return false;
+    }
+
+    for (int dim = dims - 1; dim >= 0; dim--) {
+        table->strides[dim] = size;
+        size *= (size_t)tensorBase->shape[dim] + 1;
+    }
+
+    // The accumulators of all types have 8 bytes.
+    table->values = malloc(size * sizeof(double));
+
+    if (table->values == NULL) {
+        (void)free(table->strides);
+        (void)throwMemoryAllocationException("Error on allocating memory for the summed-area table.");
+        return false;
+    }
+
+    table->tensorBase = tensorBase;
+    table->data = (const char*)getTensorDataByType(tensor, tensorType);
+    table->size = size;
+
+    const int width = tensorBase->shape[dims - 1];
+    const size_t grainSize = width >= BOX_GRAIN_VALUES ? INTEGRAL_ROW_GROUP :
+                            INTEGRAL_ROW_GROUP * (BOX_GRAIN_VALUES / width);
+    (void)parallelFor(0, size / (width + 1), grainSize,
+        tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_integralRows :
+        tensorType == _TENSOR_TYPE_FLOAT_ ? Float_integralRows : Double_integralRows, table);
+
+    for (int dim = dims - 2; dim >= 0; dim--) {
+        const size_t inner = table->strides[dim];
+        const size_t slabs = size / (inner * ((size_t)tensorBase->shape[dim] + 1));
+        table->dim = dim;
+        table->rowBlocks = (int)((inner + BOX_GRAIN_VALUES - 1) / BOX_GRAIN_VALUES);
+        (void)parallelFor(0, slabs * table->rowBlocks, 1,
+            tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_integralColumns : Double_integralColumns, table);
+    }
+
+    return true;
+}
+
+/**
+ * Frees the buffers of a summed-area table.
+ * 
+ * @param *table    The table.
+ */
+static void freeIntegralTable(IntegralTable* table) {
+    (void)free(table->values);
+    (void)free(table->strides);
+}
+
+/**
+ * Computes the summed-area table (integral image) of a tensor. Every value
+ * of the destination is the sum of all tensor values, whose indices are
+ * at most its own ones in every dimension.
+ * 
+ * <p><b>Note:</b><br>
+ * The sums are formed in `long long` for INTEGER and in `double` for FLOAT
+ * tensors and rounded to the type of the destination at the end. The sums
+ * of INTEGER tensors wrap around like every other INTEGER operation.
+ * </p>
+ * 
+ * @param *tensor       The tensor, can be a strided view.
+ * @param *dest         Destination with the shape of the tensor.
+ * @param tensorType    Type of the tensors.
+ * 
+ * @throw MemoryAllocationException - When the table could not be allocated.
+ */
+void computeIntegralImage(const void* tensor, const void* dest, const TensorType tensorType) {
+    IntegralTable table;
+
+    if (buildIntegralTable(tensor, tensorType, &table) == false) {
+        return;
+    }
+
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    char* destData = (char*)getTensorDataByType(dest, tensorType);
+    const int dims = destBase->dimensions;
+
+    for (size_t k = 0; k < destBase->dataPoints; k++) {
+        size_t rest = k;
+        size_t tableOffset = 0;
+
+        for (int dim = dims - 1; dim >= 0; dim--) {
+            tableOffset += (rest % destBase->shape[dim] + 1) * table.strides[dim];
+            rest /= destBase->shape[dim];
+        }
+
+        const size_t offset = Tensor_getElementOffset(destBase, k);
+
+        switch (tensorType) {
+        case _TENSOR_TYPE_INTEGER_:
+            ((int*)destData)[offset] = (int)((const long long*)table.values)[tableOffset];
+            break;
+        case _TENSOR_TYPE_FLOAT_:
+            ((float*)destData)[offset] = (float)((const double*)table.values)[tableOffset];
+            break;
+        default:
+            ((double*)destData)[offset] = ((const double*)table.values)[tableOffset];
+            break;
+        }
+    }
+
+    (void)freeIntegralTable(&table);
+}
+
+/**
+ * Checks whether all values of a kernel are equal (e.g. a box or mean
+ * filter).
+ * 
+ * @param *kernel       The kernel.
+ * @param tensorType    Type of the kernel.
+ * 
+ * @return `true` when the kernel is constant.
+ */
+int isConstantKernel(const void* kernel, const TensorType tensorType) {
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    const char* data = (const char*)getTensorDataByType(kernel, tensorType);
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const char* first = data + Tensor_getElementOffset(kernelBase, 0) * elementSize;
+
+    for (size_t k = 1; k < kernelBase->dataPoints; k++) {
+        const char* value = data + Tensor_getElementOffset(kernelBase, k) * elementSize;
+        const int equal = tensorType == _TENSOR_TYPE_INTEGER_ ? *(const int*)value == *(const int*)first :
+                          tensorType == _TENSOR_TYPE_FLOAT_ ? *(const float*)value == *(const float*)first :
+                          *(const double*)value == *(const double*)first;
+
+        if (equal == false) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Generates the function, that adds (`sign > 0`) or subtracts the
+ * differences of two table rows onto the box sums of `count` outputs. Unit
+ * distances are compiled separately, so they stay vectorized.
+ */
+#define DEFINE_BOX_DIFFERENCES(name, accumulator) \
+    static inline void name##Outputs(accumulator* restrict sums, const accumulator* restrict low, \
+        const accumulator* restrict high, const int count, const ptrdiff_t step, const int sign) { \
+        if (sign > 0) { \
+            for (int x = 0; x < count; x++) { \
+                sums[x] += high[x * step] - low[x * step]; \
+            } \
+        } else { \
+            for (int x = 0; x < count; x++) { \
+                sums[x] -= high[x * step] - low[x * step]; \
+            } \
+        } \
+    } \
+    static void name(accumulator* sums, const accumulator* low, const accumulator* high, \
+        const int count, const ptrdiff_t step, const int sign) { \
+        if (step == 1) { \
+            name##Outputs(sums, low, high, count, 1, sign); \
+        } else { \
+            name##Outputs(sums, low, high, count, step, sign); \
+        } \
+    }
+
+DEFINE_BOX_DIFFERENCES(Integer_boxDifferences, long long)
+DEFINE_BOX_DIFFERENCES(Double_boxDifferences, double)
+
+/**
+ * Generates the task, that computes the output rows [from; to) of a box
+ * convolution from the summed-area table.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The box of an output row is clipped to the tensor in every dimension in
+ * front of the last one, the zero padding adds nothing. Its `2^(N-1)`
+ * corners select table rows, whose signed differences along the last
+ * dimension sum up the box. Outputs, whose box lies inside of the tensor
+ * along the last dimension, are computed in vectorized loops, the border
+ * outputs clip their box.
+ * </p>
+ */
+#define DEFINE_BOX_ROWS(name, type, accumulator, differences) \
+    static void name(const size_t from, const size_t to, void* context) { \
+        const BoxContext* box = (BoxContext*)context; \
+        const ConvolutionProblem* problem = box->problem; \
+        const IntegralTable* table = box->table; \
+        const int last = problem->tensorBase->dimensions - 1; \
+        const int corners = 1 << last; \
+        const int size = problem->tensorBase->shape[last]; \
+        const int kernelSize = problem->kernelBase->shape[last]; \
+        const int before = problem->paddingBefore[last]; \
+        const int stride = problem->stride; \
+        const char* kernelData = (const char*)getTensorDataByType(problem->kernel, problem->tensorType); \
+        const accumulator value = ((const type*)kernelData)[Tensor_getElementOffset(problem->kernelBase, 0)]; \
+        ptrdiff_t* rows = (ptrdiff_t*)malloc(corners * sizeof(ptrdiff_t)); \
+        int* signs = (int*)malloc(corners * sizeof(int)); \
+        accumulator* sums = (accumulator*)malloc(box->width * sizeof(accumulator)); \
+        if (rows == NULL || signs == NULL || sums == NULL) { \
+            if (rows != NULL) (void)free(rows); \
+            if (signs != NULL) (void)free(signs); \
+            if (sums != NULL) (void)free(sums); \
+            (void)throwMemoryAllocationException("Error on allocating memory for the box sums (convolution)."); \
+            return; \
+        } \
+        for (size_t row = from; row < to; row++) { \
+            type* output = (type*)box->output + row * box->width; \
+            int empty = false; \
+            size_t rest = row; \
+            for (int c = 0; c < corners; c++) { \
+                rows[c] = 0; \
+                signs[c] = 1; \
+            } \
+            for (int dim = last - 1; dim >= 0; dim--) { \
+                const int index = (int)(rest % problem->outputShape[dim]); \
+                rest /= problem->outputShape[dim]; \
+                int low = index * stride - problem->paddingBefore[dim]; \
+                int high = low + problem->kernelBase->shape[dim]; \
+                low = low < 0 ? 0 : low; \
+                high = high > problem->tensorBase->shape[dim] ? problem->tensorBase->shape[dim] : high; \
+                empty = empty || low >= high; \
+                for (int c = 0; c < corners; c++) { \
+                    const int upper = (c >> dim) & 1; \
+                    rows[c] += (ptrdiff_t)(upper ? high : low) * table->strides[dim]; \
+                    signs[c] = upper ? signs[c] : -signs[c]; \
+                } \
+            } \
+            if (empty) { \
+                (void)memset(output, 0, box->width * sizeof(type)); \
+                continue; \
+            } \
+            for (int x = 0; x < box->width; x++) { \
+                sums[x] = 0; \
+            } \
+            for (int c = 0; c < corners; c++) { \
+                const accumulator* restrict values = (const accumulator*)table->values + rows[c]; \
+                const ptrdiff_t low = (ptrdiff_t)box->first * stride - before; \
+                const ptrdiff_t high = low + kernelSize; \
+                (void)differences(sums + box->first, values + low, values + high, \
+                    box->end - box->first, stride, signs[c]); \
+                for (int x = 0; x < box->width; x++) { \
+                    if (x == box->first && x < box->end) { \
+                        x = box->end; \
+                        if (x >= box->width) { \
+                            break; \
+                        } \
+                    } \
+                    int start = x * stride - before; \
+                    int stop = start + kernelSize; \
+                    start = start < 0 ? 0 : (start > size ? size : start); \
+                    stop = stop < start ? start : (stop > size ? size : stop); \
+                    sums[x] += signs[c] * (values[stop] - values[start]); \
+                } \
+            } \
+            for (int x = 0; x < box->width; x++) { \
+                output[x] = (type)(value * sums[x]); \
+            } \
+        } \
+        (void)free(rows); \
+        (void)free(signs); \
+        (void)free(sums); \
+    }
+
+DEFINE_BOX_ROWS(Integer_boxRows, int, long long, Integer_boxDifferences)
+DEFINE_BOX_ROWS(Float_boxRows, float, double, Double_boxDifferences)
+DEFINE_BOX_ROWS(Double_boxRows, double, double, Double_boxDifferences)
+
+/**
+ * Executes the convolution of the problem with a constant kernel by box
+ * sums of a summed-area table of the tensor.
+ * 
+ * <p><b>Functionality:</b><br>
+ * After building the table, an output costs `2^N` table reads independent
+ * of the kernel size, so a 63x63 mean filter costs as much as a 3x3 one.
+ * The box sum is multiplied with the kernel value once.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * Supports the valid and the zero padding. The sums are formed in a
+ * different order than by the other engines, so FLOAT and DOUBLE results
+ * can differ in the last bits.
+ * </p>
+ * 
+ * @param *problem  The convolution with a constant kernel.
+ */
+void convolveBox(const ConvolutionProblem* problem) {
+    IntegralTable table;
+
+    if (buildIntegralTable(problem->tensor, problem->tensorType, &table) == false) {
+        return;
+    }
+
+    const int last = problem->tensorBase->dimensions - 1;
+    const int width = problem->outputShape[last];
+    BoxContext context = {problem, &table, (char*)getTensorDataByType(problem->dest, problem->tensorType),
+        0, 0, width};
+    (void)getInteriorOutputRange(problem, last, &context.first, &context.end);
+    context.end = context.end < context.first ? context.first : context.end;
+
+    const size_t grainSize = width >= BOX_GRAIN_VALUES ? 1 : BOX_GRAIN_VALUES / width;
+    (void)parallelFor(0, problem->outputs / width, grainSize,
+        problem->tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_boxRows :
+        problem->tensorType == _TENSOR_TYPE_FLOAT_ ? Float_boxRows : Double_boxRows, &context);
+
+    (void)freeIntegralTable(&table);
+}
\ No newline at end of file
@@ -0,0 +1,1241 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Operations/simd.h"
+#include "Utils/threadPool.h"
+#include "Utils/cpu.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Number of neighbouring outputs of a row, that are computed at once.
+ */
+#define DIRECT_BLOCK_OUTPUTS 256
+
+/**
+ * Minimum number of outputs a thread computes per chunk.
+ */
+#define DIRECT_GRAIN_OUTPUTS 1024
+
+/**
+ * Size of the tile of depthwise outputs, that a thread keeps in the cache
+ * before the pointwise filters combine them.
+ */
+#define DIRECT_TILE_BYTES (512 * 1024)
+
+/**
+ * Number of output rows, that a spatial tile has at least. Fewer rows would
+ * read the halo rows too often.
+ */
+#define DIRECT_TILE_MIN_ROWS 16
+
+/**
+ * Number of outputs, that a spatial tile is wide at least. Shorter pieces of
+ * the tensor rows are not prefetched well.
+ */
+#define DIRECT_TILE_MIN_WIDTH (4 * DIRECT_BLOCK_OUTPUTS)
+
+struct DirectContext;
+
+/**
+ * Computes `count` neighbouring outputs of one output row.
+ */
+typedef void (*DirectRow)(const struct DirectContext* context, const size_t tensorOffset,
+    void* output, const int count, void* scratch);
+
+/**
+ * Computes the outputs [from; to) of one output row, whose kernel reaches
+ * into the padding.
+ */
+typedef void (*DirectBorder)(const struct DirectContext* context, const ptrdiff_t* rowOffsets,
+    void* output, const int from, const int to, void* scratch);
+
+/**
+ * Combines the channels of a tile of depthwise outputs with the pointwise
+ * filters (`channels x filters`) into `count` outputs of every filter.
+ */
+typedef void (*DirectPointwise)(void* output, const size_t filterStep, const void* tile, const size_t channelStep,
+    const int count, const int channels, const void* weights, const int filters);
+
+/**
+ * Parameters of a direct convolution that is split across threads.
+ */
+typedef struct DirectContext {
+    const ConvolutionProblem* problem;
+    const void* data;
+    void* output;
+    const void* weights;
+    int kernelRows;
+    int kernelWidth;
+    const size_t* rowOffsets;
+    const int* closedLevels;
+    int levels;
+    size_t tapStep;
+    size_t positionStep;
+    size_t outputRows;
+    int outputWidth;
+    size_t elementSize;
+    DirectRow row;
+    DirectBorder border;
+    const int* interiorFirst;
+    const int* interiorEnd;
+    size_t channelRows;
+    ptrdiff_t channelStep;
+    size_t channelWeights;
+    size_t bandRows;
+    DirectPointwise pointwise;
+    const void* pointwiseWeights;
+    int filters;
+    size_t tileRows;
+    int tileWidth;
+    size_t rowTiles;
+    size_t columnTiles;
+} DirectContext;
+
+/**
+ * Number of kernel taps, that are added onto a partial sum at once, while
+ * it stays in a register.
+ */
+#define DIRECT_UNROLLED_TAPS 4
+
+/**
+ * Adds `taps` (1 to 4) neighbouring kernel taps onto the partial sums of all
+ * outputs. The taps are added one after another, as in a plain loop.
+ */
+#define DIRECT_ADD_TAPS(type, partial, tap, tapStep, w, taps, step, count) \
+    if ((taps) == 4) { \
+        for (int x = 0; x < (count); x++) { \
+            type sum = (partial)[x]; \
+            sum += (tap)[x * (step)] * (w)[0]; \
+            sum += (tap)[(tapStep) + x * (step)] * (w)[1]; \
+            sum += (tap)[2 * (tapStep) + x * (step)] * (w)[2]; \
+            sum += (tap)[3 * (tapStep) + x * (step)] * (w)[3]; \
+            (partial)[x] = sum; \
+        } \
+    } else if ((taps) == 3) { \
+        for (int x = 0; x < (count); x++) { \
+            type sum = (partial)[x]; \
+            sum += (tap)[x * (step)] * (w)[0]; \
+            sum += (tap)[(tapStep) + x * (step)] * (w)[1]; \
+            sum += (tap)[2 * (tapStep) + x * (step)] * (w)[2]; \
+            (partial)[x] = sum; \
+        } \
+    } else if ((taps) == 2) { \
+        for (int x = 0; x < (count); x++) { \
+            type sum = (partial)[x]; \
+            sum += (tap)[x * (step)] * (w)[0]; \
+            sum += (tap)[(tapStep) + x * (step)] * (w)[1]; \
+            (partial)[x] = sum; \
+        } \
+    } else { \
+        for (int x = 0; x < (count); x++) { \
+            (partial)[x] += (tap)[x * (step)] * (w)[0]; \
+        } \
+    }
+
+/**
+ * Generates the function, that computes neighbouring outputs of a row.
+ * `STEP` is the distance of neighbouring outputs in the tensor, when it is
+ * known at compile time, or `0` to read it from the context.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The kernel is walked row by row (the last dimension), every row is reduced
+ * for all outputs at once, so the innermost loop runs over the outputs and
+ * is vectorized. The kernel is always inside the tensor, so no tap is bounds
+ * checked. The sums of each output are formed in the same order as by a
+ * recursion over the kernel dimensions: each row starts at zero and adds its
+ * taps from left to right, each dimension starts at zero and adds its
+ * completed sub-sums in order. The results are therefore bit for bit equal
+ * to a nested per-dimension accumulation, on every SIMD level.
+ * </p>
+ */
+#define DEFINE_DIRECT_ROW(name, attributes, type, STEP) \
+    attributes \
+    static void name(const DirectContext* direct, const size_t tensorOffset, \
+        void* outputData, const int count, void* scratch) { \
+        const type* data = (const type*)direct->data + tensorOffset; \
+        const type* weights = (const type*)direct->weights; \
+        type* output = (type*)outputData; \
+        type* restrict partial = (type*)scratch; \
+        type* sums = partial + DIRECT_BLOCK_OUTPUTS; \
+        const size_t step = (STEP) > 0 ? (size_t)(STEP) : direct->positionStep; \
+        const size_t tapStep = direct->tapStep; \
+        const int width = direct->kernelWidth; \
+        (void)memset(sums, 0, (size_t)direct->levels * DIRECT_BLOCK_OUTPUTS * sizeof(type)); \
+        for (int r = 0; r < direct->kernelRows; r++) { \
+            const type* row = data + direct->rowOffsets[r]; \
+            const type* w = weights + (size_t)r * width; \
+            for (int x = 0; x < count; x++) { \
+                partial[x] = 0; \
+            } \
+            for (int kx = 0; kx < width; kx += DIRECT_UNROLLED_TAPS) { \
+                const type* restrict tap = row + kx * tapStep; \
+                const int taps = width - kx < DIRECT_UNROLLED_TAPS ? width - kx : DIRECT_UNROLLED_TAPS; \
+                DIRECT_ADD_TAPS(type, partial, tap, tapStep, w + kx, taps, step, count) \
+            } \
+            if (direct->levels == 0) { \
+                (void)memcpy(output, partial, count * sizeof(type)); \
+                return; \
+            } \
+            int level = direct->levels - 1; \
+            type* current = sums + (size_t)level * DIRECT_BLOCK_OUTPUTS; \
+            for (int x = 0; x < count; x++) { \
+                current[x] += partial[x]; \
+            } \
+            for (int c = 0; c < direct->closedLevels[r] && level > 0; c++, level--) { \
+                type* parent = current - DIRECT_BLOCK_OUTPUTS; \
+                for (int x = 0; x < count; x++) { \
+                    parent[x] += current[x]; \
+                    current[x] = 0; \
+                } \
+                current = parent; \
+            } \
+        } \
+        (void)memcpy(output, sums, count * sizeof(type)); \
+    }
+
+/**
+ * Generates the function, that computes the outputs of a row, whose kernel
+ * reaches into the padding.
+ * 
+ * <p><b>Functionality:</b><br>
+ * Every tap is mapped onto the tensor by the padding, taps in the zero
+ * padding read a zero. The sums are formed in the same order as by the row
+ * functions, so the results equal the ones of a materialized padding.
+ * </p>
+ */
+#define DEFINE_DIRECT_BORDER(name, type) \
+    static void name(const DirectContext* direct, const ptrdiff_t* rowOffsets, \
+        void* outputData, const int from, const int to, void* scratch) { \
+        const ConvolutionProblem* problem = direct->problem; \
+        const int last = direct->levels; \
+        const int size = problem->tensorBase->shape[last]; \
+        const int before = problem->paddingBefore[last]; \
+        const int stride = problem->strides[last]; \
+        const int dilation = problem->dilations[last]; \
+        const ptrdiff_t elementStep = problem->tensorBase->strides[last]; \
+        const type* data = (const type*)direct->data; \
+        const type* weights = (const type*)direct->weights; \
+        type* output = (type*)outputData; \
+        type* sums = (type*)scratch; \
+        for (int x = from; x < to; x++) { \
+            (void)memset(sums, 0, (size_t)direct->levels * sizeof(type)); \
+            type partial = 0; \
+            for (int r = 0; r < direct->kernelRows; r++) { \
+                const type* w = weights + (size_t)r * direct->kernelWidth; \
+                partial = 0; \
+                for (int kx = 0; kx < direct->kernelWidth; kx++) { \
+                    const int index = resolvePaddedIndex(x * stride - before + kx * dilation, \
+                                        size, problem->padding); \
+                    const type value = rowOffsets[r] < 0 || index < 0 ? 0 : \
+                                        data[rowOffsets[r] + (ptrdiff_t)index * elementStep]; \
+                    partial += value * w[kx]; \
+                } \
+                if (direct->levels == 0) { \
+                    break; \
+                } \
+                int level = direct->levels - 1; \
+                sums[level] += partial; \
+                for (int c = 0; c < direct->closedLevels[r] && level > 0; c++, level--) { \
+                    sums[level - 1] += sums[level]; \
+                    sums[level] = 0; \
+                } \
+            } \
+            output[x] = direct->levels == 0 ? partial : sums[0]; \
+        } \
+    }
+
+DEFINE_DIRECT_BORDER(Integer_directBorder, int)
+DEFINE_DIRECT_BORDER(Float_directBorder, float)
+DEFINE_DIRECT_BORDER(Double_directBorder, double)
+
+/**
+ * Generates the row functions of one type and SIMD level for the output
+ * distances 1, 2, 3 and any other distance.
+ */
+#define DEFINE_DIRECT_ROWS(prefix, suffix, attributes, type) \
+    DEFINE_DIRECT_ROW(prefix##_directRowStep1##suffix, attributes, type, 1) \
+    DEFINE_DIRECT_ROW(prefix##_directRowStep2##suffix, attributes, type, 2) \
+    DEFINE_DIRECT_ROW(prefix##_directRowStep3##suffix, attributes, type, 3) \
+    DEFINE_DIRECT_ROW(prefix##_directRowStepN##suffix, attributes, type, 0)
+
+DEFINE_DIRECT_ROWS(Integer, , , int)
+DEFINE_DIRECT_ROWS(Float, , , float)
+DEFINE_DIRECT_ROWS(Double, , , double)
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_DIRECT_ROWS(Integer, _avx2, __attribute__((target("avx2"))), int)
+DEFINE_DIRECT_ROWS(Float, _avx2, __attribute__((target("avx2"))), float)
+DEFINE_DIRECT_ROWS(Double, _avx2, __attribute__((target("avx2"))), double)
+
+// AVX-512 implies FMA, contracting the sums would change the results.
+DEFINE_DIRECT_ROWS(Integer, _avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), int)
+DEFINE_DIRECT_ROWS(Float, _avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), float)
+DEFINE_DIRECT_ROWS(Double, _avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), double)
+#endif
+
+/**
+ * Selects one of the four row functions by the output distance.
+ */
+#define SELECT_DIRECT_ROW(prefix, suffix, step) \
+    ((step) == 1 ? prefix##_directRowStep1##suffix : \
+    (step) == 2 ? prefix##_directRowStep2##suffix : \
+    (step) == 3 ? prefix##_directRowStep3##suffix : prefix##_directRowStepN##suffix)
+
+/**
+ * Selects the row function for the type, the output distance and the
+ * active SIMD level.
+ * 
+ * @param tensorType    Type of the tensors.
+ * @param step          Distance of neighbouring outputs in the tensor.
+ * 
+ * @return The row function.
+ */
+static DirectRow selectDirectRow(const TensorType tensorType, const size_t step) {
+    const SimdLevel level = getSimdLevel();
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        switch (tensorType) {
+        case _TENSOR_TYPE_INTEGER_: return SELECT_DIRECT_ROW(Integer, _avx512, step);
+        case _TENSOR_TYPE_FLOAT_: return SELECT_DIRECT_ROW(Float, _avx512, step);
+        default: return SELECT_DIRECT_ROW(Double, _avx512, step);
+        }
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        switch (tensorType) {
+        case _TENSOR_TYPE_INTEGER_: return SELECT_DIRECT_ROW(Integer, _avx2, step);
+        case _TENSOR_TYPE_FLOAT_: return SELECT_DIRECT_ROW(Float, _avx2, step);
+        default: return SELECT_DIRECT_ROW(Double, _avx2, step);
+        }
+    }
+#endif
+
+    (void)level;
+
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_: return SELECT_DIRECT_ROW(Integer, , step);
+    case _TENSOR_TYPE_FLOAT_: return SELECT_DIRECT_ROW(Float, , step);
+    default: return SELECT_DIRECT_ROW(Double, , step);
+    }
+}
+
+/**
+ * Number of kernel shapes, for which fully unrolled row functions exist:
+ * 1D kernels with 3, 5 and 7 taps and 2D kernels with 1x1, 3x3, 5x5 and 7x7 taps.
+ */
+#define DIRECT_FIXED_SHAPES 7
+
+/**
+ * Adds tap `kx` of kernel row `r` onto the partial sum of output `x`.
+ */
+#define DIRECT_FIXED_TAP(r, kx, WIDTH) \
+    partial += data[rows[r] + (kx) * tapStep + x * step] * w[(r) * (WIDTH) + (kx)];
+
+#define DIRECT_FIXED_TAPS_1(r, WIDTH) DIRECT_FIXED_TAP(r, 0, WIDTH)
+#define DIRECT_FIXED_TAPS_3(r, WIDTH) DIRECT_FIXED_TAPS_1(r, WIDTH) \
+    DIRECT_FIXED_TAP(r, 1, WIDTH) DIRECT_FIXED_TAP(r, 2, WIDTH)
+#define DIRECT_FIXED_TAPS_5(r, WIDTH) DIRECT_FIXED_TAPS_3(r, WIDTH) \
+    DIRECT_FIXED_TAP(r, 3, WIDTH) DIRECT_FIXED_TAP(r, 4, WIDTH)
+#define DIRECT_FIXED_TAPS_7(r, WIDTH) DIRECT_FIXED_TAPS_5(r, WIDTH) \
+    DIRECT_FIXED_TAP(r, 5, WIDTH) DIRECT_FIXED_TAP(r, 6, WIDTH)
+
+/**
+ * Reduces kernel row `r` of output `x` and adds it onto the sum.
+ */
+#define DIRECT_FIXED_ROW(type, r, WIDTH) { \
+        type partial = 0; \
+        DIRECT_FIXED_TAPS_##WIDTH(r, WIDTH) \
+        sum += partial; \
+    }
+
+#define DIRECT_FIXED_ROWS_1(type, WIDTH) DIRECT_FIXED_ROW(type, 0, WIDTH)
+#define DIRECT_FIXED_ROWS_3(type, WIDTH) DIRECT_FIXED_ROWS_1(type, WIDTH) \
+    DIRECT_FIXED_ROW(type, 1, WIDTH) DIRECT_FIXED_ROW(type, 2, WIDTH)
+#define DIRECT_FIXED_ROWS_5(type, WIDTH) DIRECT_FIXED_ROWS_3(type, WIDTH) \
+    DIRECT_FIXED_ROW(type, 3, WIDTH) DIRECT_FIXED_ROW(type, 4, WIDTH)
+#define DIRECT_FIXED_ROWS_7(type, WIDTH) DIRECT_FIXED_ROWS_5(type, WIDTH) \
+    DIRECT_FIXED_ROW(type, 5, WIDTH) DIRECT_FIXED_ROW(type, 6, WIDTH)
+
+/**
+ * Generates a row function for a kernel, whose shape is known at compile
+ * time. `ROWS` and `WIDTH` are the rows and taps per row of the kernel (1,
+ * 3, 5 or 7) and `STEP` is the distance of neighbouring outputs or `0` to
+ * read it from the context.
+ * 
+ * <p><b>Functionality:</b><br>
+ * All taps are unrolled by the preprocessor, the weights stay in registers
+ * and every output is completed in a single pass without partial sums in
+ * memory. The outputs are computed by a separate function, whose `restrict`
+ * parameters spare the compiler an alias check per tap. The sums are formed in the same order as by the generic row
+ * function, so the results are bit for bit equal.
+ * </p>
+ */
+#define DEFINE_DIRECT_FIXED(name, attributes, type, ROWS, WIDTH, STEP) \
+    attributes \
+    static inline void name##Outputs(const type* restrict data, type* restrict output, \
+        const size_t* rows, const type* w, const size_t tapStep, const size_t step, const int count) { \
+        for (int x = 0; x < count; x++) { \
+            type sum = 0; \
+            DIRECT_FIXED_ROWS_##ROWS(type, WIDTH) \
+            output[x] = sum; \
+        } \
+    } \
+    attributes \
+    static void name(const DirectContext* direct, const size_t tensorOffset, \
+        void* outputData, const int count, void* scratch) { \
+        size_t rows[ROWS]; \
+        type w[(ROWS) * (WIDTH)]; \
+        (void)scratch; \
+        for (int r = 0; r < (ROWS); r++) { \
+            rows[r] = direct->rowOffsets[r]; \
+        } \
+        for (int k = 0; k < (ROWS) * (WIDTH); k++) { \
+            w[k] = ((const type*)direct->weights)[k]; \
+        } \
+        (void)name##Outputs((const type*)direct->data + tensorOffset, (type*)outputData, rows, w, \
+            direct->tapStep, (STEP) > 0 ? (size_t)(STEP) : direct->positionStep, count); \
+    }
+
+/**
+ * Generates the fixed row functions of one kernel shape for the output
+ * distance 1 and any other distance.
+ */
+#define DEFINE_DIRECT_FIXED_STEPS(name, suffix, attributes, type, ROWS, WIDTH) \
+    DEFINE_DIRECT_FIXED(name##Step1##suffix, attributes, type, ROWS, WIDTH, 1) \
+    DEFINE_DIRECT_FIXED(name##StepN##suffix, attributes, type, ROWS, WIDTH, 0)
+
+/**
+ * Generates the fixed row functions of all kernel shapes for one type and
+ * SIMD level.
+ */
+#define DEFINE_DIRECT_FIXED_SHAPES(prefix, suffix, attributes, type) \
+    DEFINE_DIRECT_FIXED_STEPS(prefix##_directFixed3, suffix, attributes, type, 1, 3) \
+    DEFINE_DIRECT_FIXED_STEPS(prefix##_directFixed5, suffix, attributes, type, 1, 5) \
+    DEFINE_DIRECT_FIXED_STEPS(prefix##_directFixed7, suffix, attributes, type, 1, 7) \
+    DEFINE_DIRECT_FIXED_STEPS(prefix##_directFixed1x1, suffix, attributes, type, 1, 1) \
+    DEFINE_DIRECT_FIXED_STEPS(prefix##_directFixed3x3, suffix, attributes, type, 3, 3) \
+    DEFINE_DIRECT_FIXED_STEPS(prefix##_directFixed5x5, suffix, attributes, type, 5, 5) \
+    DEFINE_DIRECT_FIXED_STEPS(prefix##_directFixed7x7, suffix, attributes, type, 7, 7)
+
+/**
+ * Table of the fixed row functions of one type and SIMD level, indexed by
+ * the kernel shape and whether the output distance is `1`.
+ */
+#define DIRECT_FIXED_TABLE(prefix, suffix) { \
+    {prefix##_directFixed3StepN##suffix, prefix##_directFixed3Step1##suffix}, \
+    {prefix##_directFixed5StepN##suffix, prefix##_directFixed5Step1##suffix}, \
+    {prefix##_directFixed7StepN##suffix, prefix##_directFixed7Step1##suffix}, \
+    {prefix##_directFixed1x1StepN##suffix, prefix##_directFixed1x1Step1##suffix}, \
+    {prefix##_directFixed3x3StepN##suffix, prefix##_directFixed3x3Step1##suffix}, \
+    {prefix##_directFixed5x5StepN##suffix, prefix##_directFixed5x5Step1##suffix}, \
+    {prefix##_directFixed7x7StepN##suffix, prefix##_directFixed7x7Step1##suffix} \
+}
+
+DEFINE_DIRECT_FIXED_SHAPES(Integer, , , int)
+DEFINE_DIRECT_FIXED_SHAPES(Float, , , float)
+DEFINE_DIRECT_FIXED_SHAPES(Double, , , double)
+
+static const DirectRow DIRECT_FIXED_ROWS[3][DIRECT_FIXED_SHAPES][2] = {
+    DIRECT_FIXED_TABLE(Integer, ), DIRECT_FIXED_TABLE(Float, ), DIRECT_FIXED_TABLE(Double, )
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_DIRECT_FIXED_SHAPES(Integer, _avx2, __attribute__((target("avx2"))), int)
+DEFINE_DIRECT_FIXED_SHAPES(Float, _avx2, __attribute__((target("avx2"))), float)
+DEFINE_DIRECT_FIXED_SHAPES(Double, _avx2, __attribute__((target("avx2"))), double)
+
+DEFINE_DIRECT_FIXED_SHAPES(Integer, _avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), int)
+DEFINE_DIRECT_FIXED_SHAPES(Float, _avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), float)
+DEFINE_DIRECT_FIXED_SHAPES(Double, _avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), double)
+
+static const DirectRow DIRECT_FIXED_ROWS_AVX2[3][DIRECT_FIXED_SHAPES][2] = {
+    DIRECT_FIXED_TABLE(Integer, _avx2), DIRECT_FIXED_TABLE(Float, _avx2), DIRECT_FIXED_TABLE(Double, _avx2)
+};
+
+static const DirectRow DIRECT_FIXED_ROWS_AVX512[3][DIRECT_FIXED_SHAPES][2] = {
+    DIRECT_FIXED_TABLE(Integer, _avx512), DIRECT_FIXED_TABLE(Float, _avx512), DIRECT_FIXED_TABLE(Double, _avx512)
+};
+#endif
+
+/**
+ * Finds the fully unrolled row functions for the shape of a kernel. Leading
+ * dimensions of size `1` are ignored, they do not change the order of the sums.
+ * 
+ * @param *kernelBase   Base of the kernel.
+ * 
+ * @return Index of the kernel shape in the tables or `-1`, when there are
+ * no fixed row functions for the shape.
+ */
+static int getDirectFixedShape(const Tensor* kernelBase) {
+    const int dims = kernelBase->dimensions;
+    const int width = kernelBase->shape[dims - 1];
+    const int rows = dims > 1 ? kernelBase->shape[dims - 2] : 1;
+
+    for (int dim = 0; dim < dims - 2; dim++) {
+        if (kernelBase->shape[dim] != 1) {
+            return -1;
+        }
+    }
+
+    if (width > 7 || width % 2 == 0) {
+        return -1;
+    } else if (rows == 1 && width > 1) {
+        return width / 2 - 1;
+    } else if (dims > 1 && rows == width) {
+        return 3 + width / 2;
+    }
+
+    return -1;
+}
+
+/**
+ * Checks whether the direct engine has fully unrolled row functions for
+ * the given kernel.
+ * 
+ * @param *kernelBase   Base of the kernel.
+ * 
+ * @return `true` for 1D kernels with 3, 5 or 7 taps and 2D kernels with
+ * 1x1, 3x3, 5x5 or 7x7 taps (with any leading dimensions of size `1`).
+ */
+int isDirectFixedKernel(const Tensor* kernelBase) {
+    return getDirectFixedShape(kernelBase) >= 0;
+}
+
+/**
+ * Selects the fully unrolled row function for the shape of the kernel.
+ * 
+ * @param tensorType    Type of the tensors.
+ * @param *kernelBase   Base of the kernel.
+ * @param step          Distance of neighbouring outputs in the tensor.
+ * 
+ * @return The row function or `NULL`, when there is none for the shape.
+ */
+static DirectRow selectDirectFixedRow(const TensorType tensorType, const Tensor* kernelBase, const size_t step) {
+    const int shape = getDirectFixedShape(kernelBase);
+
+    if (shape < 0) {
+        return NULL;
+    }
+
+    const SimdLevel level = getSimdLevel();
+    const int unitStep = step == 1 ? 1 : 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        return DIRECT_FIXED_ROWS_AVX512[tensorType][shape][unitStep];
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        return DIRECT_FIXED_ROWS_AVX2[tensorType][shape][unitStep];
+    }
+#endif
+
+    (void)level;
+    return DIRECT_FIXED_ROWS[tensorType][shape][unitStep];
+}
+
+/**
+ * Computes the tensor offsets of all kernel rows of an output row, whose
+ * kernel reaches into the padding.
+ * 
+ * @param *direct       The DirectContext.
+ * @param *coordinates  Output coordinates of the row (all but the last dimension).
+ * @param *offsets      Array to write the offsets to, `-1` for rows in the zero padding.
+ */
+static void computePaddedRowOffsets(const DirectContext* direct, const int* coordinates, ptrdiff_t* offsets) {
+    const ConvolutionProblem* problem = direct->problem;
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+
+    for (int r = 0; r < direct->kernelRows; r++) {
+        int rest = r;
+        ptrdiff_t offset = 0;
+
+        for (int dim = direct->levels - 1; dim >= 0 && offset >= 0; dim--) {
+            const int k = rest % kernelBase->shape[dim];
+            const int index = resolvePaddedIndex(coordinates[dim] * problem->strides[dim]
+                                - problem->paddingBefore[dim] + k * problem->dilations[dim],
+                                tensorBase->shape[dim], problem->padding);
+            rest /= kernelBase->shape[dim];
+            offset = index < 0 ? -1 : offset + (ptrdiff_t)index * tensorBase->strides[dim];
+        }
+
+        offsets[r] = offset;
+    }
+}
+
+/**
+ * Number of neighbouring positions a pointwise register tile computes at once.
+ */
+#define DIRECT_POINTWISE_OUTPUTS 16
+
+/**
+ * Number of pointwise filters a register tile computes at once.
+ */
+#define DIRECT_POINTWISE_FILTERS 8
+
+/**
+ * Vectors of `DIRECT_POINTWISE_OUTPUTS` elements. The compiler maps them to
+ * the registers of the instruction set a tile is compiled for.
+ */
+typedef int DirectIntegerVector __attribute__((vector_size(DIRECT_POINTWISE_OUTPUTS * sizeof(int))));
+typedef float DirectFloatVector __attribute__((vector_size(DIRECT_POINTWISE_OUTPUTS * sizeof(float))));
+typedef double DirectDoubleVector __attribute__((vector_size(DIRECT_POINTWISE_OUTPUTS * sizeof(double))));
+
+/**
+ * Generates a pointwise register tile for `rows` filters. The sums stay in
+ * registers, while the depthwise outputs of all channels are added in order.
+ */
+#define DEFINE_DIRECT_POINTWISE_TILE(name, attributes, type, vector, rows) \
+    attributes \
+    static void name(type* output, const size_t filterStep, const type* tile, const size_t channelStep, \
+        const int channels, const type* weights, const int filters) { \
+        vector acc[rows]; \
+        for (int r = 0; r < (rows); r++) { \
+            acc[r] = (vector){0}; \
+        } \
+        for (int c = 0; c < channels; c++) { \
+            const type* w = weights + (size_t)c * filters; \
+            vector row; \
+            (void)memcpy(&row, tile + c * channelStep, sizeof(vector)); \
+            for (int r = 0; r < (rows); r++) { \
+                acc[r] += w[r] * row; \
+            } \
+        } \
+        for (int r = 0; r < (rows); r++) { \
+            (void)memcpy(output + r * filterStep, &acc[r], sizeof(vector)); \
+        } \
+    }
+
+/**
+ * Generates the function, that multiplies the depthwise outputs of a tile
+ * with the 1x1 pointwise filters.
+ * 
+ * <p><b>Functionality:</b><br>
+ * Blocks of positions are computed by register tiles, which load every
+ * depthwise output once per block of filters. The rows of the tile are padded
+ * to whole blocks, so the last partial block is computed into a buffer. The
+ * channels are always added in order.
+ * </p>
+ */
+#define DEFINE_DIRECT_POINTWISE(name, attributes, type, vector) \
+    DEFINE_DIRECT_POINTWISE_TILE(name##Tile, attributes, type, vector, DIRECT_POINTWISE_FILTERS) \
+    DEFINE_DIRECT_POINTWISE_TILE(name##Single, attributes, type, vector, 1) \
+    attributes \
+    static void name(void* outputData, const size_t filterStep, const void* tileData, const size_t channelStep, \
+        const int count, const int channels, const void* weightsData, const int filters) { \
+        type* output = (type*)outputData; \
+        const type* tile = (const type*)tileData; \
+        const type* weights = (const type*)weightsData; \
+        const int fullCount = count / DIRECT_POINTWISE_OUTPUTS * DIRECT_POINTWISE_OUTPUTS; \
+        int f = 0; \
+        for (; f + DIRECT_POINTWISE_FILTERS <= filters; f += DIRECT_POINTWISE_FILTERS) { \
+            for (int x = 0; x < fullCount; x += DIRECT_POINTWISE_OUTPUTS) { \
+                name##Tile(output + f * filterStep + x, filterStep, tile + x, channelStep, channels, weights + f, filters); \
+            } \
+        } \
+        for (; f < filters; f++) { \
+            for (int x = 0; x < fullCount; x += DIRECT_POINTWISE_OUTPUTS) { \
+                name##Single(output + f * filterStep + x, filterStep, tile + x, channelStep, channels, weights + f, filters); \
+            } \
+        } \
+        if (fullCount < count) { \
+            type rest[DIRECT_POINTWISE_OUTPUTS]; \
+            for (f = 0; f < filters; f++) { \
+                name##Single(rest, 0, tile + fullCount, channelStep, channels, weights + f, filters); \
+                (void)memcpy(output + f * filterStep + fullCount, rest, (size_t)(count - fullCount) * sizeof(type)); \
+            } \
+        } \
+    }
+
+DEFINE_DIRECT_POINTWISE(Integer_directPointwise, , int, DirectIntegerVector)
+DEFINE_DIRECT_POINTWISE(Float_directPointwise, , float, DirectFloatVector)
+DEFINE_DIRECT_POINTWISE(Double_directPointwise, , double, DirectDoubleVector)
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_DIRECT_POINTWISE(Integer_directPointwise_avx2, __attribute__((target("avx2"))), int, DirectIntegerVector)
+DEFINE_DIRECT_POINTWISE(Float_directPointwise_avx2, __attribute__((target("avx2"))), float, DirectFloatVector)
+DEFINE_DIRECT_POINTWISE(Double_directPointwise_avx2, __attribute__((target("avx2"))), double, DirectDoubleVector)
+
+// AVX-512 implies FMA, contracting the sums would change the results.
+DEFINE_DIRECT_POINTWISE(Integer_directPointwise_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))),
+    int, DirectIntegerVector)
+DEFINE_DIRECT_POINTWISE(Float_directPointwise_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))),
+    float, DirectFloatVector)
+DEFINE_DIRECT_POINTWISE(Double_directPointwise_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))),
+    double, DirectDoubleVector)
+#endif
+
+/**
+ * Selects the pointwise function for the type and the active SIMD level.
+ * 
+ * @param tensorType    Type of the tensors.
+ * 
+ * @return The pointwise function.
+ */
+static DirectPointwise selectDirectPointwise(const TensorType tensorType) {
+    const SimdLevel level = getSimdLevel();
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_directPointwise_avx512 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_directPointwise_avx512 : Double_directPointwise_avx512;
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_directPointwise_avx2 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_directPointwise_avx2 : Double_directPointwise_avx2;
+    }
+#endif
+
+    (void)level;
+    return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_directPointwise :
+            tensorType == _TENSOR_TYPE_FLOAT_ ? Float_directPointwise : Double_directPointwise;
+}
+
+/**
+ * Computes the outputs [from; to) of a row with the row function.
+ * 
+ * @param *direct       The DirectContext.
+ * @param tensorOffset  Offset in the tensor of the first output of the row.
+ * @param *output       Output of the row.
+ * @param from          First output to compute.
+ * @param to            End of the outputs to compute (exclusive).
+ * @param *scratch      Buffer for the partial sums.
+ */
+static void computeDirectRow(const DirectContext* direct, const size_t tensorOffset,
+    char* output, const int from, const int to, void* scratch) {
+    for (int x = from; x < to; x += DIRECT_BLOCK_OUTPUTS) {
+        const int count = to - x < DIRECT_BLOCK_OUTPUTS ? to - x : DIRECT_BLOCK_OUTPUTS;
+        (void)direct->row(direct, tensorOffset + x * direct->positionStep,
+            output + x * direct->elementSize, count, scratch);
+    }
+}
+
+/**
+ * Computes the outputs [from; to) of one output row of a channel. The
+ * tensor offset of the row is computed from its output coordinates, so
+ * rows and parts of rows are independent.
+ * 
+ * <p><b>Note:</b><br>
+ * With padding, the interior outputs of a row, whose kernel lies inside of
+ * the tensor, are computed by the row function. Only the outputs at the
+ * border are computed with checked taps.
+ * </p>
+ * 
+ * @param *direct       The DirectContext of the channel.
+ * @param row           Index of the output row in the channel.
+ * @param *output       Output of the row.
+ * @param from          First output of the row to compute.
+ * @param to            End of the outputs to compute (exclusive).
+ * @param *scratch      Buffer for the partial sums.
+ * @param *coordinates  Buffer for the output coordinates of the row.
+ * @param *offsets      Buffer for the offsets of the kernel rows, only used with padding.
+ */
+static void computeDirectOutputRow(const DirectContext* direct, const size_t row, char* output,
+    const int from, const int to, void* scratch, int* coordinates, ptrdiff_t* offsets) {
+    const ConvolutionProblem* problem = direct->problem;
+    const Tensor* tensorBase = problem->tensorBase;
+    const int last = direct->levels;
+    size_t rest = row;
+    ptrdiff_t tensorOffset = 0;
+    int interior = true;
+
+    for (int dim = last - 1; dim >= 0; dim--) {
+        coordinates[dim] = (int)(rest % problem->outputShape[dim]);
+        rest /= problem->outputShape[dim];
+        tensorOffset += ((ptrdiff_t)coordinates[dim] * problem->strides[dim] - problem->paddingBefore[dim])
+                        * tensorBase->strides[dim];
+        interior = interior && coordinates[dim] >= direct->interiorFirst[dim]
+                    && coordinates[dim] < direct->interiorEnd[dim];
+    }
+
+    if (problem->padding == CONVOLUTION_PADDING_VALID) {
+        (void)computeDirectRow(direct, (size_t)tensorOffset, output, from, to, scratch);
+        return;
+    }
+
+    const int interiorFirst = interior ? direct->interiorFirst[last] : to;
+    const int interiorEnd = interior ? direct->interiorEnd[last] : to;
+    const int first = interiorFirst < from ? from : interiorFirst > to ? to : interiorFirst;
+    const int end = interiorEnd < first ? first : interiorEnd > to ? to : interiorEnd;
+    const ptrdiff_t shift = (ptrdiff_t)problem->paddingBefore[last] * tensorBase->strides[last];
+
+    (void)computePaddedRowOffsets(direct, coordinates, offsets);
+    (void)direct->border(direct, offsets, output, from, first, scratch);
+
+    if (first < end) {
+        (void)computeDirectRow(direct, (size_t)(tensorOffset - shift), output, first, end, scratch);
+    }
+
+    (void)direct->border(direct, offsets, output, end, to, scratch);
+}
+
+/**
+ * Points a copy of the context to the data and the weights of a channel of
+ * a depthwise convolution.
+ * 
+ * @param *direct   The DirectContext.
+ * @param channel   Index of the channel.
+ * @param *target   The context to write the channel to.
+ */
+static void selectDirectChannel(const DirectContext* direct, const size_t channel, DirectContext* target) {
+    *target = *direct;
+    target->data = (const char*)direct->data + (ptrdiff_t)channel * direct->channelStep * (ptrdiff_t)direct->elementSize;
+    target->weights = (const char*)direct->weights + channel * direct->channelWeights * direct->elementSize;
+}
+
+/**
+ * Allocates the buffers of a thread, which computes output rows.
+ * 
+ * @param *direct       The DirectContext.
+ * @param **scratch     Pointer to write the buffer of the partial sums to.
+ * @param **coordinates Pointer to write the buffer of the output coordinates to.
+ * @param **offsets     Pointer to write the buffer of the kernel row offsets to, `NULL` without padding.
+ * 
+ * @return `false` when the memory could not be allocated.
+ */
+static int createDirectBuffers(const DirectContext* direct, void** scratch, int** coordinates, ptrdiff_t** offsets) {
+    const int padded = direct->problem->padding != CONVOLUTION_PADDING_VALID;
+    *scratch = malloc((size_t)(direct->levels + 1) * DIRECT_BLOCK_OUTPUTS * direct->elementSize);
+    *coordinates = (int*)malloc((size_t)(direct->levels + 1) * sizeof(int));
+    *offsets = padded ? (ptrdiff_t*)malloc(direct->kernelRows * sizeof(ptrdiff_t)) : NULL;
+
+    if (*scratch == NULL || *coordinates == NULL || (padded && *offsets == NULL)) {
+        if (*scratch != NULL) (void)free(*scratch);
+        if (*coordinates != NULL) (void)free(*coordinates);
+        if (*offsets != NULL) (void)free(*offsets);
+        (void)throwMemoryAllocationException("Error on allocating memory for the partial sums (convolution).");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Computes the output rows [from; to). The rows of all channels of a
+ * depthwise convolution are counted one after another.
+ * 
+ * @param from      First output row.
+ * @param to        End of the output rows (exclusive).
+ * @param *context  The DirectContext.
+ */
+static void directTask(const size_t from, const size_t to, void* context) {
+    const DirectContext* direct = (DirectContext*)context;
+    void* scratch = NULL;
+    int* coordinates = NULL;
+    ptrdiff_t* offsets = NULL;
+    DirectContext channel;
+
+    if (createDirectBuffers(direct, &scratch, &coordinates, &offsets) == false) {
+        return;
+    }
+
+    (void)selectDirectChannel(direct, from / direct->channelRows, &channel);
+
+    for (size_t row = from; row < to; row++) {
+        if (row % direct->channelRows == 0) {
+            (void)selectDirectChannel(direct, row / direct->channelRows, &channel);
+        }
+
+        (void)computeDirectOutputRow(&channel, row % direct->channelRows,
+            (char*)direct->output + row * direct->outputWidth * direct->elementSize, 0, direct->outputWidth,
+            scratch, coordinates, offsets);
+    }
+
+    (void)free(scratch);
+    (void)free(coordinates);
+    (void)free(offsets);
+}
+
+/**
+ * Computes the spatial tiles [from; to). The tiles of a column follow each
+ * other, so the halo rows of a tile are still cached from the tile above.
+ * 
+ * @param from      First tile.
+ * @param to        End of the tiles (exclusive).
+ * @param *context  The DirectContext.
+ */
+static void directTileTask(const size_t from, const size_t to, void* context) {
+    const DirectContext* direct = (DirectContext*)context;
+    const size_t height = (size_t)direct->problem->outputShape[direct->levels - 1];
+    void* scratch = NULL;
+    int* coordinates = NULL;
+    ptrdiff_t* offsets = NULL;
+
+    if (createDirectBuffers(direct, &scratch, &coordinates, &offsets) == false) {
+        return;
+    }
+
+    for (size_t tile = from; tile < to; tile++) {
+        const size_t rowTile = tile % direct->rowTiles;
+        const size_t column = tile / direct->rowTiles % direct->columnTiles;
+        const size_t plane = tile / direct->rowTiles / direct->columnTiles;
+        const int first = (int)column * direct->tileWidth;
+        const int end = first + direct->tileWidth < direct->outputWidth ? first + direct->tileWidth : direct->outputWidth;
+        const size_t top = rowTile * direct->tileRows;
+        const size_t bottom = top + direct->tileRows < height ? top + direct->tileRows : height;
+
+        for (size_t y = top; y < bottom; y++) {
+            const size_t row = plane * height + y;
+            (void)computeDirectOutputRow(direct, row, (char*)direct->output + row * direct->outputWidth
+                * direct->elementSize, first, end, scratch, coordinates, offsets);
+        }
+    }
+
+    (void)free(scratch);
+    (void)free(coordinates);
+    (void)free(offsets);
+}
+
+/**
+ * Computes the bands [from; to) of output rows of a depthwise convolution,
+ * that is followed by a pointwise convolution.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The depthwise outputs of all channels of a band are written to a tile,
+ * which is small enough to stay in the L2 cache, and are multiplied with
+ * the pointwise filters right away. The depthwise outputs are never
+ * written to memory as a whole.
+ * </p>
+ * 
+ * @param from      First band.
+ * @param to        End of the bands (exclusive).
+ * @param *context  The DirectContext.
+ */
+static void directPointwiseTask(const size_t from, const size_t to, void* context) {
+    const DirectContext* direct = (DirectContext*)context;
+    const size_t channels = direct->outputRows / direct->channelRows;
+    const size_t tileOutputs = (direct->bandRows * direct->outputWidth + DIRECT_POINTWISE_OUTPUTS - 1)
+        / DIRECT_POINTWISE_OUTPUTS * DIRECT_POINTWISE_OUTPUTS;
+    const size_t channelOutputs = direct->channelRows * direct->outputWidth;
+    char* tile = (char*)calloc(channels * tileOutputs, direct->elementSize);
+    void* scratch = NULL;
+    int* coordinates = NULL;
+    ptrdiff_t* offsets = NULL;
+    DirectContext channel;
+
+    if (tile == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the depthwise tile (convolution).");
+        return;
+    } else if (createDirectBuffers(direct, &scratch, &coordinates, &offsets) == false) {
+        (void)free(tile);
+        return;
+    }
+
+    for (size_t band = from; band < to; band++) {
+        const size_t first = band * direct->bandRows;
+        const size_t end = first + direct->bandRows < direct->channelRows ? first + direct->bandRows : direct->channelRows;
+
+        for (size_t c = 0; c < channels; c++) {
+            (void)selectDirectChannel(direct, c, &channel);
+
+            for (size_t row = first; row < end; row++) {
+                (void)computeDirectOutputRow(&channel, row, tile + (c * tileOutputs + (row - first)
+                    * direct->outputWidth) * direct->elementSize, 0, direct->outputWidth, scratch, coordinates, offsets);
+            }
+        }
+
+        (void)direct->pointwise((char*)direct->output + first * direct->outputWidth * direct->elementSize,
+            channelOutputs, tile, tileOutputs, (int)((end - first) * direct->outputWidth), (int)channels,
+            direct->pointwiseWeights, direct->filters);
+    }
+
+    (void)free(tile);
+    (void)free(scratch);
+    (void)free(coordinates);
+    (void)free(offsets);
+}
+
+/**
+ * Prepares the context of a direct convolution. The tensor offsets of all
+ * kernel rows and the dense kernel values are computed once per call.
+ * 
+ * @param *problem      The convolution (of a single channel).
+ * @param *weightsBase  Base of the kernel, whose values are copied (of all channels).
+ * @param *context      The context to initialize.
+ * 
+ * @return `false` when the memory could not be allocated.
+ */
+static int createDirectContext(const ConvolutionProblem* problem, const Tensor* weightsBase, DirectContext* context) {
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+    const int dims = tensorBase->dimensions;
+    const int kernelWidth = kernelBase->shape[dims - 1];
+    const int kernelRows = (int)(kernelBase->dataPoints / kernelWidth);
+    const size_t elementSize = problem->tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const char* kernelData = (const char*)getTensorDataByType(problem->kernel, problem->tensorType);
+    char* weights = (char*)malloc(weightsBase->dataPoints * elementSize);
+    size_t* rowOffsets = (size_t*)malloc(kernelRows * sizeof(size_t));
+    int* closedLevels = (int*)malloc(kernelRows * sizeof(int));
+    int* interiorFirst = (int*)malloc(dims * sizeof(int));
+    int* interiorEnd = (int*)malloc(dims * sizeof(int));
+
+    if (weights == NULL || rowOffsets == NULL || closedLevels == NULL
+        || interiorFirst == NULL || interiorEnd == NULL) {
+        if (weights != NULL) (void)free(weights);
+        if (rowOffsets != NULL) (void)free(rowOffsets);
+        if (closedLevels != NULL) (void)free(closedLevels);
+        if (interiorFirst != NULL) (void)free(interiorFirst);
+        if (interiorEnd != NULL) (void)free(interiorEnd);
+        (void)throwMemoryAllocationException("Error on allocating memory for the kernel tables (convolution).");
+        return false;
+    }
+
+    for (size_t k = 0; k < weightsBase->dataPoints; k++) {
+        (void)memcpy(weights + k * elementSize,
+            kernelData + Tensor_getElementOffset(weightsBase, k) * elementSize, elementSize);
+    }
+
+    for (int r = 0; r < kernelRows; r++) {
+        int rest = r;
+        size_t offset = 0;
+        int closed = 0;
+        int trailing = true;
+
+        for (int dim = dims - 2; dim >= 0; dim--) {
+            const int index = rest % kernelBase->shape[dim];
+            rest /= kernelBase->shape[dim];
+            offset += (size_t)index * problem->dilations[dim] * tensorBase->strides[dim];
+            trailing = trailing && index == kernelBase->shape[dim] - 1;
+            closed += trailing ? 1 : 0;
+        }
+
+        rowOffsets[r] = offset;
+        closedLevels[r] = closed;
+    }
+
+    for (int dim = 0; dim < dims; dim++) {
+        (void)getInteriorOutputRange(problem, dim, &interiorFirst[dim], &interiorEnd[dim]);
+    }
+
+    const int outputWidth = problem->outputShape[dims - 1];
+    const size_t elementStep = tensorBase->strides[dims - 1];
+    const DirectContext direct = {problem, getTensorDataByType(problem->tensor, problem->tensorType),
+        getTensorDataByType(problem->dest, problem->tensorType), weights, kernelRows, kernelWidth,
+        rowOffsets, closedLevels, dims - 1, elementStep * problem->dilations[dims - 1],
+        elementStep * problem->strides[dims - 1], problem->outputs / outputWidth, outputWidth, elementSize,
+        NULL, NULL, interiorFirst, interiorEnd, problem->outputs / outputWidth, 0, 0, 0, NULL, NULL, 0, 0, 0, 0, 0};
+    *context = direct;
+
+    const DirectRow fixed = selectDirectFixedRow(problem->tensorType, kernelBase, context->positionStep);
+    context->row = fixed != NULL ? fixed : selectDirectRow(problem->tensorType, context->positionStep);
+    context->border = problem->tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_directBorder :
+                    problem->tensorType == _TENSOR_TYPE_FLOAT_ ? Float_directBorder : Double_directBorder;
+    return true;
+}
+
+/**
+ * Computes the bytes of the tensor, that a spatial tile of output rows and
+ * columns reads, including the halo of the kernel.
+ * 
+ * @param *direct   The DirectContext.
+ * @param rows      Number of output rows of the tile.
+ * @param width     Number of output columns of the tile.
+ * 
+ * @return The input footprint of the tile in bytes.
+ */
+static size_t getDirectTileFootprint(const DirectContext* direct, const size_t rows, const int width) {
+    const ConvolutionProblem* problem = direct->problem;
+    const int vertical = direct->levels - 1;
+    const int last = direct->levels;
+    const int kernelHeight = problem->kernelBase->shape[vertical];
+    const size_t planes = (size_t)direct->kernelRows / kernelHeight;
+    const size_t inputRows = (rows - 1) * problem->strides[vertical] + (size_t)(kernelHeight - 1)
+                            * problem->dilations[vertical] + 1;
+    const size_t inputWidth = (size_t)(width - 1) * problem->strides[last] + (size_t)(direct->kernelWidth - 1)
+                            * problem->dilations[last] + 1;
+    return planes * inputRows * inputWidth * direct->elementSize;
+}
+
+/**
+ * Sizes the spatial tiles of a direct convolution by the L2 cache.
+ * 
+ * <p><b>Functionality:</b><br>
+ * As long as the tensor rows, that the kernel covers for one output row,
+ * fit into the L2 cache, they are reused by the next output row anyway.
+ * Whole rows are walked then and there is a single tile. The same holds,
+ * when not even the rows of the narrowest tile fit, as tiles would only
+ * read the halo more often. Otherwise tiles of
+ * `DIRECT_TILE_MIN_ROWS` rows are made narrower until their input footprint
+ * (with the halo) fits into half of the L2 cache, the other half is left for
+ * the weights and the outputs. They are not made narrower than
+ * `DIRECT_TILE_MIN_WIDTH` outputs. Then they are made as tall as the
+ * footprint allows.
+ * </p>
+ * 
+ * @param *direct   The DirectContext to write the tile sizes to.
+ */
+static void chooseDirectTiles(DirectContext* direct) {
+    const size_t cache = getCacheSizes()->l2;
+    const size_t budget = cache / 2;
+    const size_t height = direct->levels > 0 ? (size_t)direct->problem->outputShape[direct->levels - 1] : 1;
+    direct->tileRows = height;
+    direct->tileWidth = direct->outputWidth;
+
+    if (direct->levels > 0 && getDirectTileFootprint(direct, 1, direct->outputWidth) > cache
+        && getDirectTileFootprint(direct, 1, DIRECT_TILE_MIN_WIDTH) <= cache) {
+        direct->tileRows = height < DIRECT_TILE_MIN_ROWS ? height : DIRECT_TILE_MIN_ROWS;
+
+        while (direct->tileWidth > DIRECT_TILE_MIN_WIDTH
+            && getDirectTileFootprint(direct, direct->tileRows, direct->tileWidth) > budget) {
+            const int half = ((direct->tileWidth + 1) / 2 + DIRECT_BLOCK_OUTPUTS - 1)
+                            / DIRECT_BLOCK_OUTPUTS * DIRECT_BLOCK_OUTPUTS;
+            direct->tileWidth = half < DIRECT_TILE_MIN_WIDTH ? DIRECT_TILE_MIN_WIDTH : half;
+        }
+
+        while (direct->tileRows < height
+            && getDirectTileFootprint(direct, 2 * direct->tileRows, direct->tileWidth) <= budget) {
+            direct->tileRows = 2 * direct->tileRows < height ? 2 * direct->tileRows : height;
+        }
+    }
+
+    direct->rowTiles = (height + direct->tileRows - 1) / direct->tileRows;
+    direct->columnTiles = (size_t)(direct->outputWidth + direct->tileWidth - 1) / direct->tileWidth;
+}
+
+/**
+ * Frees the tables of a direct convolution.
+ * 
+ * @param *context  The DirectContext.
+ */
+static void freeDirectContext(const DirectContext* context) {
+    (void)free((void*)context->weights);
+    (void)free((void*)context->rowOffsets);
+    (void)free((void*)context->closedLevels);
+    (void)free((void*)context->interiorFirst);
+    (void)free((void*)context->interiorEnd);
+}
+
+/**
+ * Executes the convolution of the problem by moving the kernel over the tensor.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The tensor offsets of all kernel rows and the dense kernel values are
+ * computed once per call. Every output index is computed from its output
+ * coordinates, the output rows are distributed over the threads. The
+ * strides and dilations of every dimension only scale the row offsets and
+ * the distances of taps and outputs, a dilated kernel is never spread out.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * When the tensor rows, that the kernel covers at once, do not fit into the
+ * L2 cache, the output is split into spatial tiles, whose input fits. The
+ * tiles are distributed over the threads instead of the rows.
+ * </p>
+ * 
+ * @param *problem  The convolution.
+ */
+void convolveDirect(const ConvolutionProblem* problem) {
+    DirectContext context;
+
+    if (createDirectContext(problem, problem->kernelBase, &context) == false) {
+        return;
+    }
+
+    (void)chooseDirectTiles(&context);
+
+    if (context.rowTiles > 1 || context.columnTiles > 1) {
+        const size_t planes = context.outputRows / problem->outputShape[context.levels - 1];
+        (void)parallelFor(0, planes * context.columnTiles * context.rowTiles, 1, directTileTask, &context);
+        (void)freeDirectContext(&context);
+        return;
+    }
+
+    const size_t grainSize = context.outputWidth >= DIRECT_GRAIN_OUTPUTS ? 1 : DIRECT_GRAIN_OUTPUTS / context.outputWidth;
+    (void)parallelFor(0, context.outputRows, grainSize, directTask, &context);
+    (void)freeDirectContext(&context);
+}
+
+/**
+ * Executes a depthwise convolution, optionally followed by a pointwise
+ * (1x1) convolution. The leading dimension of the tensor and of the kernel
+ * are the channels, channel `c` of the tensor is convolved with channel `c`
+ * of the kernel only.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The channels share the row offsets of the direct walker, only the data
+ * and the weights move from channel to channel. Without pointwise filters,
+ * the output rows of all channels are distributed over the threads and
+ * written to channel `c` of the destination. With pointwise filters, bands
+ * of output rows are distributed over the threads. The depthwise outputs
+ * of a band stay in a tile in the cache, until the filters combined them
+ * into the outputs of the band (`filters x ...`) in the destination.
+ * </p>
+ * 
+ * @param *problem      The depthwise convolution, its output shape and its outputs include the channels.
+ * @param *pointwise    Optional dense pointwise filters, transposed to `channels x filters`.
+ * @param filters       Number of pointwise filters.
+ */
+void convolveDepthwise(const ConvolutionProblem* problem, const void* pointwise, const int filters) {
+    const int channels = problem->kernelBase->shape[0];
+    Tensor tensorChannel = *problem->tensorBase;
+    Tensor kernelChannel = *problem->kernelBase;
+    Tensor destChannel = *problem->destBase;
+    ConvolutionProblem channel = *problem;
+    DirectContext context;
+
+    // The problem of a single channel views the trailing dimensions of the bases.
+    Tensor* bases[] = {&tensorChannel, &kernelChannel, &destChannel};
+
+    for (int i = 0; i < 3; i++) {
+        bases[i]->dataPoints = bases[i]->shape[0] == 0 ? 0 : bases[i]->dataPoints / bases[i]->shape[0];
+        bases[i]->dimensions--;
+        bases[i]->shape++;
+        bases[i]->strides++;
+    }
+
+    channel.tensorBase = &tensorChannel;
+    channel.kernelBase = &kernelChannel;
+    channel.destBase = &destChannel;
+    channel.outputShape++;
+    channel.paddingBefore++;
+    channel.strides++;
+    channel.dilations++;
+    channel.outputs /= channels;
+
+    if (channel.outputs == 0 || createDirectContext(&channel, problem->kernelBase, &context) == false) {
+        return;
+    }
+
+    context.channelStep = problem->tensorBase->strides[0];
+    context.channelWeights = kernelChannel.dataPoints;
+    context.outputRows *= channels;
+
+    if (pointwise == NULL) {
+        const size_t grainSize = context.outputWidth >= DIRECT_GRAIN_OUTPUTS ? 1 : DIRECT_GRAIN_OUTPUTS / context.outputWidth;
+        (void)parallelFor(0, context.outputRows, grainSize, directTask, &context);
+    } else {
+        const size_t rowBytes = (size_t)channels * context.outputWidth * context.elementSize;
+        context.bandRows = rowBytes >= DIRECT_TILE_BYTES ? 1 : DIRECT_TILE_BYTES / rowBytes;
+        context.pointwise = selectDirectPointwise(problem->tensorType);
+        context.pointwiseWeights = pointwise;
+        context.filters = filters;
+        (void)parallelFor(0, (context.channelRows + context.bandRows - 1) / context.bandRows, 1,
+            directPointwiseTask, &context);
+    }
+
+    (void)freeDirectContext(&context);
+}
\ No newline at end of file
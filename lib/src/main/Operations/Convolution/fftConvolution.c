@@ -0,0 +1,516 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Utils/fft.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Minimum FFT length per dimension of an overlap-add block.
+ */
+#define FFT_MIN_BLOCK_LENGTH 32
+
+/**
+ * Factor between the FFT length of a block and the kernel size, so most of
+ * a block holds new tensor values instead of the kernel overlap.
+ */
+#define FFT_BLOCK_KERNEL_FACTOR 4
+
+/**
+ * Maximum number of supported dimensions.
+ */
+#define FFT_MAX_DIMENSIONS 16
+
+/**
+ * Parameters of an overlap-add FFT convolution that is split across threads.
+ */
+typedef struct {
+    const ConvolutionProblem* problem;
+    const void* data;
+    void* output;
+    int dims;
+    FftPlan* plans[FFT_MAX_DIMENSIONS];
+    size_t lengths[FFT_MAX_DIMENSIONS];
+    size_t blockSizes[FFT_MAX_DIMENSIONS];
+    size_t blocks[FFT_MAX_DIMENSIONS];
+    size_t inputExtent[FFT_MAX_DIMENSIONS];
+    size_t blockElements;
+    size_t spectrumElements;
+    double* kernelSpectrum;
+    int splitDimension;
+    int phase;
+} FftContext;
+
+/**
+ * Checks whether a convolution of the given type can be executed by the
+ * FFT engine. That is the case for FLOAT and DOUBLE tensors.
+ * 
+ * @param tensorType    Type of the tensors.
+ * 
+ * @return `true` if the FFT engine can be used, else `false`.
+ */
+int isFftApplicable(const TensorType tensorType) {
+    return tensorType == _TENSOR_TYPE_FLOAT_ || tensorType == _TENSOR_TYPE_DOUBLE_;
+}
+
+/**
+ * Calculates the smallest power of two that is not smaller than the value.
+ * 
+ * @param value     The value.
+ * 
+ * @return The power of two.
+ */
+static size_t nextPowerOfTwo(const size_t value) {
+    size_t power = 1;
+
+    while (power < value) {
+        power <<= 1;
+    }
+
+    return power;
+}
+
+/**
+ * Transforms the real values of a block into its spectrum. The last
+ * dimension is transformed by a real FFT, all other dimensions by complex
+ * FFTs along the lines of the spectrum.
+ * 
+ * @param *fft          The FftContext.
+ * @param *input        `blockElements` real values, they are left unchanged.
+ * @param *spectrum     `spectrumElements` interleaved complex values.
+ * @param *line         Buffer for the complex values of one line.
+ */
+static void forwardTransform(const FftContext* fft, const double* input, double* spectrum, double* line) {
+    const size_t lastLength = fft->lengths[fft->dims - 1];
+    const size_t bins = lastLength / 2 + 1;
+    const size_t rows = fft->blockElements / lastLength;
+
+    for (size_t row = 0; row < rows; row++) {
+        (void)Fft_realForward(fft->plans[fft->dims - 1], input + row * lastLength, spectrum + 2 * row * bins);
+    }
+
+    size_t inner = bins;
+
+    for (int dim = fft->dims - 2; dim >= 0; dim--) {
+        const size_t length = fft->lengths[dim];
+        const size_t outer = fft->spectrumElements / (inner * length);
+
+        for (size_t o = 0; o < outer; o++) {
+            for (size_t q = 0; q < inner; q++) {
+                double* start = spectrum + 2 * (o * length * inner + q);
+
+                for (size_t k = 0; k < length; k++) {
+                    line[2 * k] = start[2 * k * inner];
+                    line[2 * k + 1] = start[2 * k * inner + 1];
+                }
+
+                (void)Fft_complex(fft->plans[dim], line, false);
+
+                for (size_t k = 0; k < length; k++) {
+                    start[2 * k * inner] = line[2 * k];
+                    start[2 * k * inner + 1] = line[2 * k + 1];
+                }
+            }
+        }
+
+        inner *= length;
+    }
+}
+
+/**
+ * Transforms a spectrum back into the real values of a block. The values
+ * are scaled by the number of values of the block.
+ * 
+ * @param *fft          The FftContext.
+ * @param *spectrum     `spectrumElements` interleaved complex values, they are overwritten.
+ * @param *output       `blockElements` real values.
+ * @param *line         Buffer for the complex values of one line.
+ */
+static void inverseTransform(const FftContext* fft, double* spectrum, double* output, double* line) {
+    const size_t lastLength = fft->lengths[fft->dims - 1];
+    const size_t bins = lastLength / 2 + 1;
+    const size_t rows = fft->blockElements / lastLength;
+    size_t inner = fft->spectrumElements;
+
+    for (int dim = 0; dim < fft->dims - 1; dim++) {
+        const size_t length = fft->lengths[dim];
+        inner /= length;
+        const size_t outer = fft->spectrumElements / (inner * length);
+
+        for (size_t o = 0; o < outer; o++) {
+            for (size_t q = 0; q < inner; q++) {
+                double* start = spectrum + 2 * (o * length * inner + q);
+
+                for (size_t k = 0; k < length; k++) {
+                    line[2 * k] = start[2 * k * inner];
+                    line[2 * k + 1] = start[2 * k * inner + 1];
+                }
+
+                (void)Fft_complex(fft->plans[dim], line, true);
+
+                for (size_t k = 0; k < length; k++) {
+                    start[2 * k * inner] = line[2 * k];
+                    start[2 * k * inner + 1] = line[2 * k + 1];
+                }
+            }
+        }
+    }
+
+    for (size_t row = 0; row < rows; row++) {
+        (void)Fft_realInverse(fft->plans[fft->dims - 1], spectrum + 2 * row * bins, output + row * lastLength);
+    }
+}
+
+/**
+ * Reads an element of a FLOAT or DOUBLE tensor as double.
+ * 
+ * @param *data         Data of the tensor.
+ * @param offset        Offset of the element.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The value.
+ */
+static double readElement(const void* data, const size_t offset, const TensorType tensorType) {
+    return tensorType == _TENSOR_TYPE_FLOAT_ ?
+            ((const float*)data)[offset] : ((const double*)data)[offset];
+}
+
+/**
+ * Convolves the blocks at the given index of the split dimension with all
+ * blocks of the other dimensions and adds the results onto the output.
+ * 
+ * <p><b>Functionality:</b><br>
+ * Each block of the tensor is zero padded to the FFT length, transformed,
+ * multiplied with the spectrum of the flipped kernel and transformed back.
+ * This is the full linear convolution of the block, whose values are added
+ * at the output positions they belong to (overlap-add). The convolution of
+ * the library is a correlation, so the result at index `j` of a block at
+ * `p` belongs to the output at `p + j - (kernel - 1)`.
+ * </p>
+ * 
+ * @param *fft          The FftContext.
+ * @param splitIndex    Index of the block in the split dimension.
+ * @param *real         Buffer of `blockElements` real values.
+ * @param *spectrum     Buffer of `spectrumElements` complex values.
+ * @param *line         Buffer for the complex values of one line.
+ */
+static void convolveBlocks(const FftContext* fft, const size_t splitIndex,
+    double* real, double* spectrum, double* line) {
+    const ConvolutionProblem* problem = fft->problem;
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+    const int dims = fft->dims;
+    const int stride = problem->stride;
+    const double scale = 1.0 / (double)fft->blockElements;
+    size_t blockCount = 1;
+
+    for (int dim = 0; dim < dims; dim++) {
+        blockCount *= dim == fft->splitDimension ? 1 : fft->blocks[dim];
+    }
+
+    for (size_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+        size_t origin[FFT_MAX_DIMENSIONS];
+        size_t extent[FFT_MAX_DIMENSIONS];
+        size_t rest = blockIndex;
+
+        for (int dim = dims - 1; dim >= 0; dim--) {
+            size_t index = splitIndex;
+
+            if (dim != fft->splitDimension) {
+                index = rest % fft->blocks[dim];
+                rest /= fft->blocks[dim];
+            }
+
+            origin[dim] = index * fft->blockSizes[dim];
+            extent[dim] = fft->inputExtent[dim] - origin[dim] < fft->blockSizes[dim] ?
+                        fft->inputExtent[dim] - origin[dim] : fft->blockSizes[dim];
+        }
+
+        (void)memset(real, 0, fft->blockElements * sizeof(double));
+        const int last = dims - 1;
+        const size_t lastLength = fft->lengths[last];
+        const size_t lastStride = tensorBase->strides[last];
+        size_t extentRows = 1;
+
+        for (int dim = 0; dim < last; dim++) {
+            extentRows *= extent[dim];
+        }
+
+        for (size_t row = 0; row < extentRows; row++) {
+            size_t r = row;
+            size_t tensorOffset = origin[last] * lastStride;
+            size_t blockOffset = 0;
+            size_t blockStride = lastLength;
+
+            for (int dim = last - 1; dim >= 0; dim--) {
+                const size_t index = r % extent[dim];
+                r /= extent[dim];
+                tensorOffset += (origin[dim] + index) * tensorBase->strides[dim];
+                blockOffset += index * blockStride;
+                blockStride *= fft->lengths[dim];
+            }
+
+            for (size_t j = 0; j < extent[last]; j++) {
+                real[blockOffset + j] = readElement(fft->data, tensorOffset + j * lastStride, problem->tensorType);
+            }
+        }
+
+        (void)forwardTransform(fft, real, spectrum, line);
+
+        for (size_t i = 0; i < fft->spectrumElements; i++) {
+            const double ar = spectrum[2 * i];
+            const double ai = spectrum[2 * i + 1];
+            const double br = fft->kernelSpectrum[2 * i];
+            const double bi = fft->kernelSpectrum[2 * i + 1];
+            spectrum[2 * i] = ar * br - ai * bi;
+            spectrum[2 * i + 1] = ar * bi + ai * br;
+        }
+
+        (void)inverseTransform(fft, spectrum, real, line);
+
+        // Accumulate the results, that fall onto an output position.
+        const long lastOverlap = kernelBase->shape[last] - 1;
+        const long lastOutputs = problem->outputShape[last];
+        long firstPosition = (long)origin[last] - lastOverlap;
+        firstPosition = firstPosition < 0 ? 0 : (firstPosition + stride - 1) / stride * stride;
+        const long endPosition = (long)origin[last] + (long)lastLength - lastOverlap;
+
+        for (size_t row = 0; row < fft->blockElements / lastLength; row++) {
+            size_t r = row;
+            size_t outputOffset = 0;
+            size_t outputStride = lastOutputs;
+            int valid = true;
+
+            for (int dim = last - 1; dim >= 0 && valid; dim--) {
+                const size_t index = r % fft->lengths[dim];
+                r /= fft->lengths[dim];
+                const long position = (long)(origin[dim] + index) - (kernelBase->shape[dim] - 1);
+
+                if (position < 0 || position % stride != 0 || position / stride >= problem->outputShape[dim]) {
+                    valid = false;
+                } else {
+                    outputOffset += (size_t)(position / stride) * outputStride;
+                    outputStride *= problem->outputShape[dim];
+                }
+            }
+
+            const double* values = real + row * lastLength;
+            const long shift = lastOverlap - (long)origin[last];
+
+            for (long position = firstPosition; valid && position < endPosition
+                && position / stride < lastOutputs; position += stride) {
+                const double value = values[position + shift] * scale;
+
+                if (problem->tensorType == _TENSOR_TYPE_FLOAT_) {
+                    ((float*)fft->output)[outputOffset + position / stride] += (float)value;
+                } else {
+                    ((double*)fft->output)[outputOffset + position / stride] += value;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Convolves the blocks [from; to) of the current phase of the split dimension.
+ * 
+ * <p><b>Note:</b><br>
+ * Neighbouring blocks add onto overlapping outputs, so each phase only
+ * processes every second block of the split dimension.
+ * </p>
+ * 
+ * @param from      First block of the phase.
+ * @param to        End of the blocks of the phase (exclusive).
+ * @param *context  The FftContext.
+ */
+static void fftTask(const size_t from, const size_t to, void* context) {
+    const FftContext* fft = (FftContext*)context;
+    size_t maxLength = 1;
+
+    for (int dim = 0; dim < fft->dims; dim++) {
+        maxLength = fft->lengths[dim] > maxLength ? fft->lengths[dim] : maxLength;
+    }
+
+    double* real = (double*)malloc(fft->blockElements * sizeof(double));
+    double* spectrum = (double*)malloc(2 * fft->spectrumElements * sizeof(double));
+    double* line = (double*)malloc(2 * maxLength * sizeof(double));
+
+    if (real == NULL || spectrum == NULL || line == NULL) {
+        if (real != NULL) (void)free(real);
+        if (spectrum != NULL) (void)free(spectrum);
+        if (line != NULL) (void)free(line);
+        (void)throwMemoryAllocationException("Error on allocating memory for the FFT blocks (convolution).");
+        return;
+    }
+
+    for (size_t i = from; i < to; i++) {
+        (void)convolveBlocks(fft, 2 * i + fft->phase, real, spectrum, line);
+    }
+
+    (void)free(real);
+    (void)free(spectrum);
+    (void)free(line);
+}
+
+/**
+ * Calculates the spectrum of the flipped kernel, zero padded to the FFT
+ * lengths of the blocks.
+ * 
+ * @param *fft  The FftContext with the plans.
+ * 
+ * @return `true` on success, else `false`.
+ */
+static int createKernelSpectrum(FftContext* fft) {
+    const ConvolutionProblem* problem = fft->problem;
+    const Tensor* kernelBase = problem->kernelBase;
+    const void* kernelData = getTensorDataByType(problem->kernel, problem->tensorType);
+    size_t maxLength = 1;
+
+    for (int dim = 0; dim < fft->dims; dim++) {
+        maxLength = fft->lengths[dim] > maxLength ? fft->lengths[dim] : maxLength;
+    }
+
+    double* real = (double*)calloc(fft->blockElements, sizeof(double));
+    double* line = (double*)malloc(2 * maxLength * sizeof(double));
+    fft->kernelSpectrum = (double*)malloc(2 * fft->spectrumElements * sizeof(double));
+
+    if (real == NULL || line == NULL || fft->kernelSpectrum == NULL) {
+        if (real != NULL) (void)free(real);
+        if (line != NULL) (void)free(line);
+        return false;
+    }
+
+    for (size_t k = 0; k < kernelBase->dataPoints; k++) {
+        size_t rest = k;
+        size_t blockOffset = 0;
+        size_t blockStride = 1;
+
+        for (int dim = fft->dims - 1; dim >= 0; dim--) {
+            const size_t index = rest % kernelBase->shape[dim];
+            rest /= kernelBase->shape[dim];
+            blockOffset += (kernelBase->shape[dim] - 1 - index) * blockStride;
+            blockStride *= fft->lengths[dim];
+        }
+
+        real[blockOffset] = readElement(kernelData,
+            Tensor_getElementOffset(kernelBase, k), problem->tensorType);
+    }
+
+    (void)forwardTransform(fft, real, fft->kernelSpectrum, line);
+    (void)free(real);
+    (void)free(line);
+    return true;
+}
+
+/**
+ * Executes the convolution of the problem by FFTs with overlap-add.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The tensor is split into blocks, whose FFT length per dimension is the
+ * smaller one of the full convolution and `FFT_BLOCK_KERNEL_FACTOR` times
+ * the kernel size, so the memory stays bounded for large tensors. The
+ * blocks are convolved with the kernel in the frequency domain and the
+ * results are added onto the outputs. The dimension with the most blocks
+ * is distributed over the threads in two phases of non-neighbouring blocks.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * All values are transformed in double precision. Strided convolutions
+ * compute all positions of stride 1 and keep every `stride`-th one.
+ * </p>
+ * 
+ * @param *problem  The convolution, its type must be FLOAT or DOUBLE.
+ */
+void convolveFft(const ConvolutionProblem* problem) {
+    const Tensor* kernelBase = problem->kernelBase;
+    const int dims = problem->tensorBase->dimensions;
+
+    if (dims > FFT_MAX_DIMENSIONS) {
+        (void)throwIllegalArgumentException("Too many dimensions for an FFT convolution.");
+        return;
+    }
+
+    FftContext fft;
+    (void)memset(&fft, 0, sizeof(FftContext));
+    fft.problem = problem;
+    fft.data = getTensorDataByType(problem->tensor, problem->tensorType);
+    fft.output = getTensorDataByType(problem->dest, problem->tensorType);
+    fft.dims = dims;
+    fft.blockElements = 1;
+
+    for (int dim = 0; dim < dims; dim++) {
+        const size_t kernelSize = kernelBase->shape[dim];
+        const size_t extent = (size_t)(problem->outputShape[dim] - 1) * problem->stride + kernelSize;
+        size_t length = nextPowerOfTwo(extent + kernelSize - 1);
+        size_t blockLength = nextPowerOfTwo(FFT_BLOCK_KERNEL_FACTOR * kernelSize);
+        blockLength = blockLength < FFT_MIN_BLOCK_LENGTH ? FFT_MIN_BLOCK_LENGTH : blockLength;
+        length = length < blockLength ? length : blockLength;
+
+        if (dim == dims - 1 && length < 2) {
+            length = 2;
+        }
+
+        fft.lengths[dim] = length;
+        fft.inputExtent[dim] = extent;
+        fft.blockSizes[dim] = length - kernelSize + 1;
+        fft.blocks[dim] = (extent + fft.blockSizes[dim] - 1) / fft.blockSizes[dim];
+        fft.blockElements *= length;
+
+        if (fft.blocks[dim] > fft.blocks[fft.splitDimension]) {
+            fft.splitDimension = dim;
+        }
+    }
+
+    fft.spectrumElements = fft.blockElements / fft.lengths[dims - 1] * (fft.lengths[dims - 1] / 2 + 1);
+    int valid = true;
+
+    for (int dim = 0; dim < dims && valid; dim++) {
+        fft.plans[dim] = createFftPlan(fft.lengths[dim]);
+        valid = fft.plans[dim] != NULL;
+    }
+
+    if (valid && createKernelSpectrum(&fft)) {
+        const size_t elementSize = problem->tensorType == _TENSOR_TYPE_FLOAT_ ? sizeof(float) : sizeof(double);
+        const size_t splitBlocks = fft.blocks[fft.splitDimension];
+        (void)memset(fft.output, 0, problem->outputs * elementSize);
+
+        for (fft.phase = 0; fft.phase < 2; fft.phase++) {
+            const size_t count = (splitBlocks + 1 - fft.phase) / 2;
+            (void)parallelFor(0, count, 1, fftTask, &fft);
+        }
+    } else if (valid) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the kernel spectrum (convolution).");
+    }
+
+    for (int dim = 0; dim < dims; dim++) {
+        (void)FftPlan_free(fft.plans[dim]);
+    }
+
+    if (fft.kernelSpectrum != NULL) (void)free(fft.kernelSpectrum);
+}
\ No newline at end of file
@@ -0,0 +1,438 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Operations/simd.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Number of output positions (columns of the patch matrix) that are lowered
+ * at once. Must be a multiple of `GEMM_TILE_POSITIONS`.
+ */
+#define GEMM_BLOCK_POSITIONS 128
+
+/**
+ * Number of kernel taps (rows of the patch matrix) that are lowered at once,
+ * so a panel of `GEMM_BLOCK_TAPS x GEMM_BLOCK_POSITIONS` stays in the L2 cache.
+ */
+#define GEMM_BLOCK_TAPS 256
+
+/**
+ * Number of filters a register tile computes at once.
+ */
+#define GEMM_TILE_FILTERS 4
+
+/**
+ * Number of output positions a register tile computes at once.
+ */
+#define GEMM_TILE_POSITIONS 16
+
+/**
+ * Computes a register tile of `rows x GEMM_TILE_POSITIONS` outputs.
+ * The outputs are accumulated onto the values already in the output.
+ */
+typedef void (*GemmTile)(const void* weights, const size_t weightStride,
+    const void* panel, const int taps, void* output, const size_t outputStride);
+
+/**
+ * Lowers and multiplies a single block of output positions.
+ */
+typedef void (*GemmBlock)(const void* context, const size_t firstPosition,
+    const int columns, void* panel, const size_t* positionOffsets, const int* runLengths);
+
+/**
+ * Parameters of a GEMM convolution that is split across threads.
+ */
+typedef struct {
+    const ConvolutionProblem* problem;
+    const void* data;
+    void* output;
+    const void* weights;
+    int filters;
+    size_t taps;
+    const size_t* tapOffsets;
+    size_t elementSize;
+    GemmTile fullTile;
+    GemmTile singleTile;
+    GemmBlock block;
+} GemmContext;
+
+/**
+ * Vectors of `GEMM_TILE_POSITIONS` elements. The compiler maps them to the
+ * registers of the instruction set a tile is compiled for.
+ */
+typedef int GemmIntegerVector __attribute__((vector_size(GEMM_TILE_POSITIONS * sizeof(int))));
+typedef float GemmFloatVector __attribute__((vector_size(GEMM_TILE_POSITIONS * sizeof(float))));
+typedef double GemmDoubleVector __attribute__((vector_size(GEMM_TILE_POSITIONS * sizeof(double))));
+
+/**
+ * Generates a register tile for `rows` filters. The accumulators stay in
+ * registers for all taps of the panel, each tap adds the broadcasted weight
+ * times a row of the panel.
+ */
+#define DEFINE_GEMM_TILE(name, attributes, type, vector, rows) \
+    attributes \
+    static void name(const void* weightData, const size_t weightStride, \
+        const void* panelData, const int taps, void* outputData, const size_t outputStride) { \
+        const type* weights = (const type*)weightData; \
+        const type* panel = (const type*)panelData; \
+        type* output = (type*)outputData; \
+        vector acc[rows]; \
+        for (int r = 0; r < (rows); r++) { \
+            (void)memcpy(&acc[r], output + r * outputStride, sizeof(vector)); \
+        } \
+        for (int k = 0; k < taps; k++) { \
+            vector row; \
+            (void)memcpy(&row, panel + (size_t)k * GEMM_BLOCK_POSITIONS, sizeof(vector)); \
+            for (int r = 0; r < (rows); r++) { \
+                acc[r] += weights[r * weightStride + k] * row; \
+            } \
+        } \
+        for (int r = 0; r < (rows); r++) { \
+            (void)memcpy(output + r * outputStride, &acc[r], sizeof(vector)); \
+        } \
+    }
+
+/**
+ * Generates the function that lowers a block of output positions into the
+ * panel (im2col) and multiplies it with the weights of all filters.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The taps are processed in slices of `GEMM_BLOCK_TAPS`. For each slice the
+ * panel holds one row per tap with the tensor values of all positions of the
+ * block. Positions, that are consecutive in the tensor, are copied as a run,
+ * positions whose kernel reaches into the padding are gathered tap by tap. Full tiles are computed by the register tiles, the remaining
+ * positions, that do not fill a tile, are computed directly.
+ * </p>
+ */
+#define DEFINE_GEMM_BLOCK(name, type) \
+    static void name(const void* context, const size_t firstPosition, \
+        const int columns, void* panelData, const size_t* positionOffsets, const int* runLengths) { \
+        const GemmContext* gemm = (const GemmContext*)context; \
+        const type* data = (const type*)gemm->data; \
+        const type* weights = (const type*)gemm->weights; \
+        type* panel = (type*)panelData; \
+        type* output = (type*)gemm->output + firstPosition; \
+        const size_t outputs = gemm->problem->outputs; \
+        const size_t K = gemm->taps; \
+        const int fullColumns = columns / GEMM_TILE_POSITIONS * GEMM_TILE_POSITIONS; \
+        for (int n = 0; n < gemm->filters; n++) { \
+            (void)memset(output + n * outputs, 0, columns * sizeof(type)); \
+        } \
+        for (size_t k0 = 0; k0 < K; k0 += GEMM_BLOCK_TAPS) { \
+            const int taps = K - k0 < GEMM_BLOCK_TAPS ? (int)(K - k0) : GEMM_BLOCK_TAPS; \
+            for (int k = 0; k < taps; k++) { \
+                const type* tap = data + gemm->tapOffsets[k0 + k]; \
+                type* row = panel + (size_t)k * GEMM_BLOCK_POSITIONS; \
+                for (int j = 0; j < columns; j += runLengths[j] > 0 ? runLengths[j] : 1) { \
+                    if (runLengths[j] == 0) { \
+                        const ptrdiff_t offset = getPaddedTapOffset(gemm->problem, firstPosition + j, k0 + k); \
+                        row[j] = offset < 0 ? 0 : data[offset]; \
+                    } else if (runLengths[j] == 1) { \
+                        row[j] = tap[positionOffsets[j]]; \
+                    } else { \
+                        (void)memcpy(row + j, tap + positionOffsets[j], runLengths[j] * sizeof(type)); \
+                    } \
+                } \
+            } \
+            int n = 0; \
+            for (; n + GEMM_TILE_FILTERS <= gemm->filters; n += GEMM_TILE_FILTERS) { \
+                for (int j = 0; j < fullColumns; j += GEMM_TILE_POSITIONS) { \
+                    (void)gemm->fullTile(weights + n * K + k0, K, panel + j, taps, \
+                        output + n * outputs + j, outputs); \
+                } \
+            } \
+            for (; n < gemm->filters; n++) { \
+                for (int j = 0; j < fullColumns; j += GEMM_TILE_POSITIONS) { \
+                    (void)gemm->singleTile(weights + n * K + k0, K, panel + j, taps, \
+                        output + n * outputs + j, outputs); \
+                } \
+            } \
+            for (n = 0; n < gemm->filters; n++) { \
+                for (int j = fullColumns; j < columns; j++) { \
+                    type sum = output[n * outputs + j]; \
+                    for (int k = 0; k < taps; k++) { \
+                        sum += weights[n * K + k0 + k] * panel[(size_t)k * GEMM_BLOCK_POSITIONS + j]; \
+                    } \
+                    output[n * outputs + j] = sum; \
+                } \
+            } \
+        } \
+    }
+
+DEFINE_GEMM_TILE(Integer_gemmTile, , int, GemmIntegerVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Integer_gemmTileSingle, , int, GemmIntegerVector, 1)
+DEFINE_GEMM_TILE(Float_gemmTile, , float, GemmFloatVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Float_gemmTileSingle, , float, GemmFloatVector, 1)
+DEFINE_GEMM_TILE(Double_gemmTile, , double, GemmDoubleVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Double_gemmTileSingle, , double, GemmDoubleVector, 1)
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_GEMM_TILE(Integer_gemmTile_avx2, __attribute__((target("avx2"))), int, GemmIntegerVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Integer_gemmTileSingle_avx2, __attribute__((target("avx2"))), int, GemmIntegerVector, 1)
+DEFINE_GEMM_TILE(Float_gemmTile_avx2, __attribute__((target("avx2"))), float, GemmFloatVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Float_gemmTileSingle_avx2, __attribute__((target("avx2"))), float, GemmFloatVector, 1)
+DEFINE_GEMM_TILE(Double_gemmTile_avx2, __attribute__((target("avx2"))), double, GemmDoubleVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Double_gemmTileSingle_avx2, __attribute__((target("avx2"))), double, GemmDoubleVector, 1)
+
+DEFINE_GEMM_TILE(Integer_gemmTile_avx512, __attribute__((target("avx512f"))), int, GemmIntegerVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Integer_gemmTileSingle_avx512, __attribute__((target("avx512f"))), int, GemmIntegerVector, 1)
+DEFINE_GEMM_TILE(Float_gemmTile_avx512, __attribute__((target("avx512f"))), float, GemmFloatVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Float_gemmTileSingle_avx512, __attribute__((target("avx512f"))), float, GemmFloatVector, 1)
+DEFINE_GEMM_TILE(Double_gemmTile_avx512, __attribute__((target("avx512f"))), double, GemmDoubleVector, GEMM_TILE_FILTERS)
+DEFINE_GEMM_TILE(Double_gemmTileSingle_avx512, __attribute__((target("avx512f"))), double, GemmDoubleVector, 1)
+#endif
+
+DEFINE_GEMM_BLOCK(Integer_gemmBlock, int)
+DEFINE_GEMM_BLOCK(Float_gemmBlock, float)
+DEFINE_GEMM_BLOCK(Double_gemmBlock, double)
+
+/**
+ * Selects the register tiles and the block function for the type of the
+ * problem and the active SIMD level.
+ * 
+ * @param *gemm         The GemmContext to fill.
+ * @param tensorType    Type of the tensors.
+ */
+static void selectGemmKernels(GemmContext* gemm, const TensorType tensorType) {
+    const SimdLevel level = getSimdLevel();
+
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        gemm->fullTile = Integer_gemmTile;
+        gemm->singleTile = Integer_gemmTileSingle;
+        gemm->block = Integer_gemmBlock;
+        gemm->elementSize = sizeof(int);
+#if defined(__x86_64__) || defined(__i386__)
+        if (level >= SIMD_LEVEL_AVX512) {
+            gemm->fullTile = Integer_gemmTile_avx512;
+            gemm->singleTile = Integer_gemmTileSingle_avx512;
+        } else if (level >= SIMD_LEVEL_AVX2) {
+            gemm->fullTile = Integer_gemmTile_avx2;
+            gemm->singleTile = Integer_gemmTileSingle_avx2;
+        }
+#endif
+        break;
+    case _TENSOR_TYPE_FLOAT_:
+        gemm->fullTile = Float_gemmTile;
+        gemm->singleTile = Float_gemmTileSingle;
+        gemm->block = Float_gemmBlock;
+        gemm->elementSize = sizeof(float);
+#if defined(__x86_64__) || defined(__i386__)
+        if (level >= SIMD_LEVEL_AVX512) {
+            gemm->fullTile = Float_gemmTile_avx512;
+            gemm->singleTile = Float_gemmTileSingle_avx512;
+        } else if (level >= SIMD_LEVEL_AVX2) {
+            gemm->fullTile = Float_gemmTile_avx2;
+            gemm->singleTile = Float_gemmTileSingle_avx2;
+        }
+#endif
+        break;
+    case _TENSOR_TYPE_DOUBLE_:
+        gemm->fullTile = Double_gemmTile;
+        gemm->singleTile = Double_gemmTileSingle;
+        gemm->block = Double_gemmBlock;
+        gemm->elementSize = sizeof(double);
+#if defined(__x86_64__) || defined(__i386__)
+        if (level >= SIMD_LEVEL_AVX512) {
+            gemm->fullTile = Double_gemmTile_avx512;
+            gemm->singleTile = Double_gemmTileSingle_avx512;
+        } else if (level >= SIMD_LEVEL_AVX2) {
+            gemm->fullTile = Double_gemmTile_avx2;
+            gemm->singleTile = Double_gemmTileSingle_avx2;
+        }
+#endif
+        break;
+    }
+
+    (void)level;
+}
+
+/**
+ * Calculates the offsets in the tensor data of the first tap for each
+ * output position of a block and the lengths of the runs of positions,
+ * that are consecutive in the tensor. Positions, whose kernel reaches into
+ * the padding, get a run length of `0`.
+ * 
+ * @param *problem          The convolution.
+ * @param firstPosition     First output position of the block.
+ * @param columns           Number of positions in the block.
+ * @param *offsets          Array to write the offsets to.
+ * @param *runLengths       Array to write the length of the run starting at each position to.
+ */
+static void computePositionOffsets(const ConvolutionProblem* problem,
+    const size_t firstPosition, const int columns, size_t* offsets, int* runLengths) {
+    const Tensor* base = problem->tensorBase;
+
+    for (int j = 0; j < columns; j++) {
+        size_t rest = firstPosition + j;
+        ptrdiff_t offset = 0;
+        int interior = true;
+
+        for (int dim = base->dimensions - 1; dim >= 0; dim--) {
+            const int index = (int)(rest % problem->outputShape[dim]);
+            rest /= problem->outputShape[dim];
+            offset += ((ptrdiff_t)index * problem->strides[dim] - problem->paddingBefore[dim]) * base->strides[dim];
+
+            if (problem->padding != CONVOLUTION_PADDING_VALID) {
+                int first, end;
+                (void)getInteriorOutputRange(problem, dim, &first, &end);
+                interior = interior && index >= first && index < end;
+            }
+        }
+
+        offsets[j] = interior ? (size_t)offset : 0;
+        runLengths[j] = interior ? 1 : 0;
+    }
+
+    for (int j = columns - 2; j >= 0; j--) {
+        if (runLengths[j] > 0 && runLengths[j + 1] > 0 && offsets[j + 1] == offsets[j] + 1) {
+            runLengths[j] = runLengths[j + 1] + 1;
+        }
+    }
+}
+
+/**
+ * Lowers and multiplies the blocks [from; to) of output positions.
+ * 
+ * @param from      First block to compute.
+ * @param to        End of the blocks to compute (exclusive).
+ * @param *context  The GemmContext.
+ */
+static void gemmTask(const size_t from, const size_t to, void* context) {
+    const GemmContext* gemm = (GemmContext*)context;
+    const size_t panelSize = (size_t)GEMM_BLOCK_TAPS * GEMM_BLOCK_POSITIONS * gemm->elementSize;
+    void* panel = aligned_alloc(TENSOR_DATA_ALIGNMENT, panelSize);
+    size_t* positionOffsets = (size_t*)malloc(GEMM_BLOCK_POSITIONS * sizeof(size_t));
+    int* runLengths = (int*)malloc(GEMM_BLOCK_POSITIONS * sizeof(int));
+
+    if (panel == NULL || positionOffsets == NULL || runLengths == NULL) {
+        if (panel != NULL) (void)free(panel);
+        if (positionOffsets != NULL) (void)free(positionOffsets);
+        if (runLengths != NULL) (void)free(runLengths);
+        (void)throwMemoryAllocationException("Error on allocating memory for the patch matrix (convolution).");
+        return;
+    }
+
+    for (size_t block = from; block < to; block++) {
+        const size_t firstPosition = block * GEMM_BLOCK_POSITIONS;
+        const size_t remaining = gemm->problem->outputs - firstPosition;
+        const int columns = remaining < GEMM_BLOCK_POSITIONS ? (int)remaining : GEMM_BLOCK_POSITIONS;
+
+        (void)computePositionOffsets(gemm->problem, firstPosition, columns, positionOffsets, runLengths);
+        (void)gemm->block(gemm, firstPosition, columns, panel, positionOffsets, runLengths);
+    }
+
+    (void)free(panel);
+    (void)free(positionOffsets);
+    (void)free(runLengths);
+}
+
+/**
+ * Executes the convolution of the problem with `filters` kernels, that all
+ * have the shape of the kernel of the problem, as a GEMM.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The output of filter `n` is the product of row `n` of the weights with
+ * the patch matrix (im2col) of the tensor, in which every column holds the
+ * tensor values under the kernel at one output position. The patch matrix
+ * is never materialized as a whole, it is lowered in blocks of
+ * `GEMM_BLOCK_POSITIONS` positions and `GEMM_BLOCK_TAPS` taps, that are
+ * distributed over the threads.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * The output of filter `n` starts at `n * outputs` in the destination.
+ * </p>
+ * 
+ * @param *problem  The convolution.
+ * @param *weights  Dense `filters x taps` matrix with the kernel values of each filter.
+ * @param filters   Number of filters.
+ */
+void convolveGemmWithWeights(const ConvolutionProblem* problem, const void* weights, const int filters) {
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+    const size_t taps = kernelBase->dataPoints;
+    size_t* tapOffsets = (size_t*)malloc(taps * sizeof(size_t));
+
+    if (tapOffsets == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the tap offsets (convolution).");
+        return;
+    }
+
+    for (size_t k = 0; k < taps; k++) {
+        size_t rest = k;
+        size_t offset = 0;
+
+        for (int dim = kernelBase->dimensions - 1; dim >= 0; dim--) {
+            offset += (rest % kernelBase->shape[dim]) * problem->dilations[dim] * tensorBase->strides[dim];
+            rest /= kernelBase->shape[dim];
+        }
+
+        tapOffsets[k] = offset;
+    }
+
+    GemmContext context = {problem, getTensorDataByType(problem->tensor, problem->tensorType),
+        getTensorDataByType(problem->dest, problem->tensorType), weights, filters, taps, tapOffsets,
+        0, NULL, NULL, NULL};
+    (void)selectGemmKernels(&context, problem->tensorType);
+
+    const size_t blocks = (problem->outputs + GEMM_BLOCK_POSITIONS - 1) / GEMM_BLOCK_POSITIONS;
+    (void)parallelFor(0, blocks, 1, gemmTask, &context);
+    (void)free(tapOffsets);
+}
+
+/**
+ * Executes the convolution of the problem as a GEMM with a single filter.
+ * 
+ * @param *problem  The convolution.
+ * 
+ * @see #convolveGemmWithWeights(const ConvolutionProblem* problem, const void* weights, const int filters)
+ */
+void convolveGemm(const ConvolutionProblem* problem) {
+    const Tensor* kernelBase = problem->kernelBase;
+    const size_t elementSize = problem->tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const char* kernelData = (const char*)getTensorDataByType(problem->kernel, problem->tensorType);
+    char* weights = (char*)malloc(kernelBase->dataPoints * elementSize);
+
+    if (weights == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the weights (convolution).");
+        return;
+    }
+
+    // Pack the kernel densely, since it might be a strided view.
+    for (size_t k = 0; k < kernelBase->dataPoints; k++) {
+        (void)memcpy(weights + k * elementSize,
+            kernelData + Tensor_getElementOffset(kernelBase, k) * elementSize, elementSize);
+    }
+
+    (void)convolveGemmWithWeights(problem, weights, 1);
+    (void)free(weights);
+}
\ No newline at end of file
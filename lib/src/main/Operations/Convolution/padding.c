@@ -0,0 +1,120 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+
+/**
+ * Maps an index of the padded tensor onto the tensor.
+ * 
+ * @param index     Index in the dimension, can be outside of [0; size).
+ * @param size      Size of the dimension.
+ * @param padding   The padding of the convolution.
+ * 
+ * @return The index inside of the tensor or `-1` when the value is a zero
+ * of the padding.
+ */
+int resolvePaddedIndex(const int index, const int size, const ConvolutionPadding padding) {
+    if (index >= 0 && index < size) {
+        return index;
+    }
+
+    switch (padding) {
+    case CONVOLUTION_PADDING_REPLICATE:
+        return index < 0 ? 0 : size - 1;
+    case CONVOLUTION_PADDING_REFLECT: {
+        if (size == 1) {
+            return 0;
+        }
+
+        // Mirroring twice is a shift by the period, so reflecting works for
+        // paddings larger than the tensor as well.
+        const int period = 2 * (size - 1);
+        int folded = (index < 0 ? -index : index) % period;
+        return folded < size ? folded : period - folded;
+    }
+    default:
+        return -1;
+    }
+}
+
+/**
+ * Calculates the outputs of a dimension, whose kernel lies completely
+ * inside of the tensor. Only outputs outside of [first; end) read padding.
+ * 
+ * @param *problem  The convolution.
+ * @param dim       The dimension.
+ * @param *first    Pointer to write the first interior output to.
+ * @param *end      Pointer to write the end of the interior outputs (exclusive) to.
+ */
+void getInteriorOutputRange(const ConvolutionProblem* problem, const int dim, int* first, int* end) {
+    const int outputs = problem->outputShape[dim];
+    const int before = problem->paddingBefore[dim];
+    const int stride = problem->strides[dim];
+    const int extent = (problem->kernelBase->shape[dim] - 1) * problem->dilations[dim] + 1;
+    const int last = problem->tensorBase->shape[dim] - extent + before;
+    int begin = (before + stride - 1) / stride;
+    int stop = last < 0 ? 0 : last / stride + 1;
+
+    begin = begin > outputs ? outputs : begin;
+    stop = stop > outputs ? outputs : stop;
+    *first = begin;
+    *end = stop < begin ? begin : stop;
+}
+
+/**
+ * Calculates the offset in the tensor data of a tap at an output position,
+ * whose kernel might reach into the padding.
+ * 
+ * @param *problem  The convolution.
+ * @param position  Index of the output position in row-major order.
+ * @param tap       Index of the tap in row-major order of the kernel.
+ * 
+ * @return The offset in the tensor data or `-1` when the tap reads a zero
+ * of the padding.
+ */
+ptrdiff_t getPaddedTapOffset(const ConvolutionProblem* problem, const size_t position, const size_t tap) {
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+    size_t restPosition = position;
+    size_t restTap = tap;
+    ptrdiff_t offset = 0;
+
+    for (int dim = tensorBase->dimensions - 1; dim >= 0; dim--) {
+        const int output = (int)(restPosition % problem->outputShape[dim]);
+        const int k = (int)(restTap % kernelBase->shape[dim]);
+        const int index = resolvePaddedIndex(output * problem->strides[dim] - problem->paddingBefore[dim]
+                            + k * problem->dilations[dim], tensorBase->shape[dim], problem->padding);
+
+        if (index < 0) {
+            return -1;
+        }
+
+        restPosition /= problem->outputShape[dim];
+        restTap /= kernelBase->shape[dim];
+        offset += (ptrdiff_t)index * tensorBase->strides[dim];
+    }
+
+    return offset;
+}
\ No newline at end of file
@@ -0,0 +1,519 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Operations/simd.h"
+#include "Utils/cpu.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Number of outputs, that the dot product kernels compute at once (four
+ * AVX-512 registers of 32-bit accumulations).
+ */
+#define QUANTIZED_VECTOR_OUTPUTS 64
+
+/**
+ * Maximum number of outputs of an output row, whose patches are lowered at
+ * once. The patches of a block stay in L1 while all filters are applied.
+ */
+#define QUANTIZED_BLOCK_OUTPUTS 128
+
+/**
+ * Number of outputs of all filters, that a thread computes at least per task.
+ */
+#define QUANTIZED_GRAIN_OUTPUTS 4096
+
+/**
+ * Number of filters, whose dot products with a block of patches are
+ * computed in one call of the dot product kernels.
+ */
+#define QUANTIZED_FILTER_CHUNK 8
+
+/**
+ * Computes the dot products of a block of patches with consecutive filters.
+ * The taps are grouped by four: group `g` of output `x` are the four bytes
+ * at `patches[(g * count + x) * 4]` and the four weights of the group of
+ * filter `f` are packed into `weights[f * groups + g]`. The results of
+ * filter `f` are written to `accumulators[f * count]`. `count` is a multiple
+ * of `QUANTIZED_VECTOR_OUTPUTS`.
+ */
+typedef void (*QuantizedDot)(int32_t* accumulators, const uint8_t* patches, const int32_t* weights,
+    const int groups, const int count, const int filters);
+
+/**
+ * Copies the four taps of a kernel row group for `count` neighbouring
+ * outputs from a dense input row (`quads[4 * x + j] = source[x + j]`).
+ */
+typedef void (*QuantizedQuads)(uint8_t* quads, const uint8_t* source, const int count);
+
+/**
+ * Writes the accumulations of a block of one filter to the destination.
+ */
+typedef void (*QuantizedStore)(const QuantizedConvolution* convolution, const int32_t* accumulators,
+    const int correction, const int filter, const size_t first, const int count);
+
+/**
+ * Shared state of the threads of a quantized convolution.
+ */
+typedef struct {
+    const QuantizedConvolution* convolution;
+    const ptrdiff_t* groupOffsets;
+    const int* groupTaps;
+    const int32_t* weights;
+    const int* weightSums;
+    int groups;
+    int outputWidth;
+    QuantizedDot dot;
+    QuantizedQuads quads;
+    QuantizedStore store;
+} QuantizedContext;
+
+/**
+ * Dot products of the patches with the filters without intrinsics.
+ */
+static void quantizedDot(int32_t* restrict accumulators, const uint8_t* restrict patches,
+    const int32_t* restrict weights, const int groups, const int count, const int filters) {
+    for (int f = 0; f < filters; f++) {
+        int32_t* restrict sums = accumulators + (size_t)f * count;
+
+        for (int x = 0; x < count; x++) {
+            sums[x] = 0;
+        }
+
+        for (int g = 0; g < groups; g++) {
+            const int8_t* w = (const int8_t*)&weights[(size_t)f * groups + g];
+            const int w0 = w[0], w1 = w[1], w2 = w[2], w3 = w[3];
+            const uint8_t* restrict quads = patches + (size_t)g * count * 4;
+
+            for (int x = 0; x < count; x++) {
+                sums[x] += quads[4 * x] * w0 + quads[4 * x + 1] * w1
+                        + quads[4 * x + 2] * w2 + quads[4 * x + 3] * w3;
+            }
+        }
+    }
+}
+
+/**
+ * Copies the groups of four taps of neighbouring outputs without intrinsics.
+ */
+static void copyQuantizedQuads(uint8_t* restrict quads, const uint8_t* restrict source, const int count) {
+    for (int x = 0; x < count; x++) {
+        (void)memcpy(quads + 4 * x, source + x, 4);
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * Dot products of the patches with one filter on AVX2. The bytes are widened
+ * to 16 bits and multiplied with `vpmaddwd`, which adds the products of two
+ * taps exactly into 32 bits.
+ */
+__attribute__((target("avx2")))
+static void quantizedDot_avx2(int32_t* accumulators, const uint8_t* patches,
+    const int32_t* weights, const int groups, const int count, const int filters) {
+    for (int f = 0; f < filters; f++) {
+        for (int x = 0; x < count; x += 16) {
+            __m256i sums[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(),
+                                _mm256_setzero_si256(), _mm256_setzero_si256()};
+
+            for (int g = 0; g < groups; g++) {
+                const __m256i w = _mm256_cvtepi8_epi16(_mm_set1_epi32(weights[(size_t)f * groups + g]));
+                const uint8_t* quads = patches + ((size_t)g * count + x) * 4;
+
+                for (int i = 0; i < 4; i++) {
+                    const __m256i values = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(quads + 16 * i)));
+                    sums[i] = _mm256_add_epi32(sums[i], _mm256_madd_epi16(values, w));
+                }
+            }
+
+            // Every output has two partial sums, add them and restore the order.
+            int32_t* dest = accumulators + (size_t)f * count + x;
+            const __m256i low = _mm256_permute4x64_epi64(_mm256_hadd_epi32(sums[0], sums[1]), 0xD8);
+            const __m256i high = _mm256_permute4x64_epi64(_mm256_hadd_epi32(sums[2], sums[3]), 0xD8);
+            (void)_mm256_storeu_si256((__m256i*)dest, low);
+            (void)_mm256_storeu_si256((__m256i*)(dest + 8), high);
+        }
+    }
+}
+
+/**
+ * Copies the groups of four taps of neighbouring outputs on AVX2. The taps
+ * of 8 outputs are shuffled out of 11 neighbouring input bytes.
+ */
+__attribute__((target("avx2")))
+static void copyQuantizedQuads_avx2(uint8_t* quads, const uint8_t* source, const int count) {
+    const __m256i pattern = _mm256_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6,
+                                            4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10);
+    int x = 0;
+
+    // The 16 loaded bytes stay within the taps of the outputs.
+    for (; x + 16 <= count; x += 8) {
+        const __m256i values = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(source + x)));
+        (void)_mm256_storeu_si256((__m256i*)(quads + 4 * x), _mm256_shuffle_epi8(values, pattern));
+    }
+
+    for (; x < count; x++) {
+        (void)memcpy(quads + 4 * x, source + x, 4);
+    }
+}
+
+/**
+ * Dot products of the patches with the filters on AVX-512 VNNI. `vpdpbusd`
+ * multiplies the four unsigned bytes of every output with the four signed
+ * weights and adds them into the 32-bit accumulation in one instruction.
+ * Two filters share the loads of the patches.
+ */
+__attribute__((target("avx512f,avx512bw,avx512vnni")))
+static void quantizedDot_vnni(int32_t* accumulators, const uint8_t* patches,
+    const int32_t* weights, const int groups, const int count, const int filters) {
+    int f = 0;
+
+    for (; f + 2 <= filters; f += 2) {
+        const int32_t* first = weights + (size_t)f * groups;
+        const int32_t* second = first + groups;
+
+        for (int x = 0; x < count; x += QUANTIZED_VECTOR_OUTPUTS) {
+            __m512i a0 = _mm512_setzero_si512(), a1 = _mm512_setzero_si512();
+            __m512i a2 = _mm512_setzero_si512(), a3 = _mm512_setzero_si512();
+            __m512i b0 = _mm512_setzero_si512(), b1 = _mm512_setzero_si512();
+            __m512i b2 = _mm512_setzero_si512(), b3 = _mm512_setzero_si512();
+
+            for (int g = 0; g < groups; g++) {
+                const __m512i wa = _mm512_set1_epi32(first[g]);
+                const __m512i wb = _mm512_set1_epi32(second[g]);
+                const uint8_t* quads = patches + ((size_t)g * count + x) * 4;
+                const __m512i q0 = _mm512_loadu_si512(quads);
+                const __m512i q1 = _mm512_loadu_si512(quads + 64);
+                const __m512i q2 = _mm512_loadu_si512(quads + 128);
+                const __m512i q3 = _mm512_loadu_si512(quads + 192);
+
+                a0 = _mm512_dpbusd_epi32(a0, q0, wa);
+                a1 = _mm512_dpbusd_epi32(a1, q1, wa);
+                a2 = _mm512_dpbusd_epi32(a2, q2, wa);
+                a3 = _mm512_dpbusd_epi32(a3, q3, wa);
+                b0 = _mm512_dpbusd_epi32(b0, q0, wb);
+                b1 = _mm512_dpbusd_epi32(b1, q1, wb);
+                b2 = _mm512_dpbusd_epi32(b2, q2, wb);
+                b3 = _mm512_dpbusd_epi32(b3, q3, wb);
+            }
+
+            int32_t* dest = accumulators + (size_t)f * count + x;
+            (void)_mm512_storeu_si512(dest, a0);
+            (void)_mm512_storeu_si512(dest + 16, a1);
+            (void)_mm512_storeu_si512(dest + 32, a2);
+            (void)_mm512_storeu_si512(dest + 48, a3);
+            (void)_mm512_storeu_si512(dest + count, b0);
+            (void)_mm512_storeu_si512(dest + count + 16, b1);
+            (void)_mm512_storeu_si512(dest + count + 32, b2);
+            (void)_mm512_storeu_si512(dest + count + 48, b3);
+        }
+    }
+
+    for (; f < filters; f++) {
+        const int32_t* filter = weights + (size_t)f * groups;
+
+        for (int x = 0; x < count; x += QUANTIZED_VECTOR_OUTPUTS) {
+            __m512i a0 = _mm512_setzero_si512(), a1 = _mm512_setzero_si512();
+            __m512i a2 = _mm512_setzero_si512(), a3 = _mm512_setzero_si512();
+
+            for (int g = 0; g < groups; g++) {
+                const __m512i w = _mm512_set1_epi32(filter[g]);
+                const uint8_t* quads = patches + ((size_t)g * count + x) * 4;
+
+                a0 = _mm512_dpbusd_epi32(a0, _mm512_loadu_si512(quads), w);
+                a1 = _mm512_dpbusd_epi32(a1, _mm512_loadu_si512(quads + 64), w);
+                a2 = _mm512_dpbusd_epi32(a2, _mm512_loadu_si512(quads + 128), w);
+                a3 = _mm512_dpbusd_epi32(a3, _mm512_loadu_si512(quads + 192), w);
+            }
+
+            int32_t* dest = accumulators + (size_t)f * count + x;
+            (void)_mm512_storeu_si512(dest, a0);
+            (void)_mm512_storeu_si512(dest + 16, a1);
+            (void)_mm512_storeu_si512(dest + 32, a2);
+            (void)_mm512_storeu_si512(dest + 48, a3);
+        }
+    }
+}
+#endif
+
+/**
+ * Generates the function, that writes the accumulations of a block of one
+ * filter for one SIMD level, either exact or requantized (rounded to the
+ * nearest value and saturated to [0; 255]).
+ */
+#define DEFINE_QUANTIZED_STORE(name, attributes) \
+    attributes \
+    static void name(const QuantizedConvolution* convolution, const int32_t* restrict accumulators, \
+        const int correction, const int filter, const size_t first, const int count) { \
+        const size_t offset = (size_t)filter * convolution->outputs + first; \
+        if (convolution->accumulators != NULL) { \
+            int* restrict dest = convolution->accumulators + offset; \
+            for (int x = 0; x < count; x++) { \
+                dest[x] = accumulators[x] - correction; \
+            } \
+            return; \
+        } \
+        uint8_t* restrict dest = convolution->requantized + offset; \
+        const float multiplier = convolution->multipliers[filter]; \
+        const float zeroPoint = (float)convolution->requantizedZeroPoint; \
+        for (int x = 0; x < count; x++) { \
+            float value = (float)(accumulators[x] - correction) * multiplier + zeroPoint; \
+            value = value < 0.0f ? 0.0f : value; \
+            value = value > (float)UINT8_MAX ? (float)UINT8_MAX : value; \
+            dest[x] = (uint8_t)(int)(value + 0.5f); \
+        } \
+    }
+
+DEFINE_QUANTIZED_STORE(storeQuantizedOutputs, )
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_QUANTIZED_STORE(storeQuantizedOutputs_avx2, __attribute__((target("avx2"))))
+DEFINE_QUANTIZED_STORE(storeQuantizedOutputs_avx512, __attribute__((target("avx512f,avx512bw"))))
+#endif
+
+/**
+ * Selects the dot product, copy and store kernels for the active SIMD level. VNNI
+ * is used on the AVX-512 level, when the CPU supports it.
+ * 
+ * @param *context  The QuantizedContext in which to store the kernels.
+ */
+static void selectQuantizedKernels(QuantizedContext* context) {
+    const SimdLevel level = getSimdLevel();
+    context->dot = quantizedDot;
+    context->quads = copyQuantizedQuads;
+    context->store = storeQuantizedOutputs;
+
+#if defined(__x86_64__) || defined(__i386__)
+    const CpuFeatures* features = getCpuFeatures();
+
+    if (level >= SIMD_LEVEL_AVX2) {
+        context->dot = quantizedDot_avx2;
+        context->quads = copyQuantizedQuads_avx2;
+        context->store = storeQuantizedOutputs_avx2;
+    }
+
+    if (level >= SIMD_LEVEL_AVX512 && features->avx512bw) {
+        context->store = storeQuantizedOutputs_avx512;
+    }
+
+    if (level >= SIMD_LEVEL_AVX512 && features->avx512bw && features->avx512vnni) {
+        context->dot = quantizedDot_vnni;
+    }
+#endif
+
+    (void)level;
+}
+
+/**
+ * Lowers the patches of `count` neighbouring outputs into the groups of four
+ * taps, as expected by the dot product kernels. A group holds four taps of
+ * a kernel row, so for dense rows it is a single 32-bit copy.
+ * 
+ * @param *patches      Destination with `groups * stride * 4` bytes.
+ * @param *input        First value of the patch of the first output.
+ * @param *context      The QuantizedContext with the offsets and sizes of the groups.
+ * @param count         Number of outputs.
+ * @param stride        Distance between the groups in outputs.
+ * @param step          Distance in the input between the patches of two outputs.
+ * @param tapStep       Distance in the input between two taps of a kernel row.
+ */
+static void lowerQuantizedPatches(uint8_t* restrict patches, const uint8_t* restrict input,
+    const QuantizedContext* context, const int count, const int stride, const ptrdiff_t step,
+    const ptrdiff_t tapStep) {
+    for (int g = 0; g < context->groups; g++) {
+        const uint8_t* restrict source = input + context->groupOffsets[g];
+        uint8_t* restrict quads = patches + (size_t)g * stride * 4;
+        const int taps = context->groupTaps[g];
+
+        if (tapStep == 1 && step == 1) {
+            (void)context->quads(quads, source, count);
+        } else if (tapStep == 1) {
+            for (int x = 0; x < count; x++) {
+                (void)memcpy(quads + 4 * x, source + x * step, 4);
+            }
+        } else {
+            for (int x = 0; x < count; x++) {
+                for (int j = 0; j < taps; j++) {
+                    quads[4 * x + j] = source[x * step + j * tapStep];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Computes the output rows [from; to) of a quantized convolution.
+ * 
+ * @param from      First output row.
+ * @param to        End of the output rows (exclusive).
+ * @param *context  The QuantizedContext.
+ */
+static void quantizedConvolutionTask(const size_t from, const size_t to, void* context) {
+    const QuantizedContext* quantized = (QuantizedContext*)context;
+    const QuantizedConvolution* convolution = quantized->convolution;
+    const Tensor* tensorBase = convolution->tensorBase;
+    const int last = tensorBase->dimensions - 1;
+    const int width = quantized->outputWidth;
+    const int block = width < QUANTIZED_BLOCK_OUTPUTS ? width : QUANTIZED_BLOCK_OUTPUTS;
+    const int stride = (block + QUANTIZED_VECTOR_OUTPUTS - 1) / QUANTIZED_VECTOR_OUTPUTS * QUANTIZED_VECTOR_OUTPUTS;
+    const ptrdiff_t step = (ptrdiff_t)convolution->stride * tensorBase->strides[last];
+    uint8_t* patches = (uint8_t*)calloc((size_t)quantized->groups * stride * 4, sizeof(uint8_t));
+    int32_t* accumulators = (int32_t*)malloc((size_t)QUANTIZED_FILTER_CHUNK * stride * sizeof(int32_t));
+
+    if (patches == NULL || accumulators == NULL) {
+        if (patches != NULL) (void)free(patches);
+        if (accumulators != NULL) (void)free(accumulators);
+        (void)throwMemoryAllocationException("Error on allocating memory for the patches (quantized convolution).");
+        return;
+    }
+
+    for (size_t row = from; row < to; row++) {
+        size_t rest = row;
+        ptrdiff_t offset = 0;
+
+        for (int dim = last - 1; dim >= 0; dim--) {
+            offset += (ptrdiff_t)(rest % convolution->outputShape[dim]) * convolution->stride * tensorBase->strides[dim];
+            rest /= convolution->outputShape[dim];
+        }
+
+        for (int x = 0; x < width; x += block) {
+            const int count = width - x < block ? width - x : block;
+            const size_t first = row * width + x;
+
+            (void)lowerQuantizedPatches(patches, convolution->tensor + offset + x * step,
+                quantized, count, stride, step, tensorBase->strides[last]);
+
+            for (int f = 0; f < convolution->filters; f += QUANTIZED_FILTER_CHUNK) {
+                const int filters = convolution->filters - f < QUANTIZED_FILTER_CHUNK
+                                    ? convolution->filters - f : QUANTIZED_FILTER_CHUNK;
+                (void)quantized->dot(accumulators, patches, quantized->weights + (size_t)f * quantized->groups,
+                    quantized->groups, stride, filters);
+
+                for (int i = 0; i < filters; i++) {
+                    (void)quantized->store(convolution, accumulators + (size_t)i * stride,
+                        convolution->tensorZeroPoint * quantized->weightSums[f + i], f + i, first, count);
+                }
+            }
+        }
+    }
+
+    (void)free(patches);
+    (void)free(accumulators);
+}
+
+/**
+ * Executes a convolution of 8-bit activations with signed 8-bit filters.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The patches of a block of outputs are lowered into groups of four taps of
+ * a kernel row, the filters are packed into matching groups of four weights
+ * (kernel rows are padded with zero weights). Every group
+ * is a single `vpdpbusd` on AVX-512 VNNI (`vpmaddwd` on AVX2) for 16 (8)
+ * outputs. The zero point of the activations is not subtracted per value,
+ * `sum((x - z) * w) = sum(x * w) - z * sum(w)` is corrected once per output.
+ * The output rows are distributed over the threads.
+ * </p>
+ * 
+ * @param *convolution  The validated convolution.
+ */
+void convolveQuantized(const QuantizedConvolution* convolution) {
+    const Tensor* tensorBase = convolution->tensorBase;
+    const int dims = tensorBase->dimensions;
+    const int kernelWidth = convolution->kernelShape[dims - 1];
+    const int rowGroups = (kernelWidth + 3) / 4;
+    int kernelRows = 1;
+
+    for (int dim = 0; dim < dims - 1; dim++) {
+        kernelRows *= convolution->kernelShape[dim];
+    }
+
+    const int groups = kernelRows * rowGroups;
+    ptrdiff_t* groupOffsets = (ptrdiff_t*)malloc(groups * sizeof(ptrdiff_t));
+    int* groupTaps = (int*)malloc(groups * sizeof(int));
+    int32_t* weights = (int32_t*)calloc((size_t)convolution->filters * groups, sizeof(int32_t));
+    int* weightSums = (int*)calloc(convolution->filters, sizeof(int));
+
+    if (groupOffsets == NULL || groupTaps == NULL || weights == NULL || weightSums == NULL) {
+        if (groupOffsets != NULL) (void)free(groupOffsets);
+        if (groupTaps != NULL) (void)free(groupTaps);
+        if (weights != NULL) (void)free(weights);
+        if (weightSums != NULL) (void)free(weightSums);
+        (void)throwMemoryAllocationException("Error on allocating memory for the weights (quantized convolution).");
+        return;
+    }
+
+    for (int r = 0; r < kernelRows; r++) {
+        int rest = r;
+        ptrdiff_t offset = 0;
+
+        for (int dim = dims - 2; dim >= 0; dim--) {
+            offset += (ptrdiff_t)(rest % convolution->kernelShape[dim]) * tensorBase->strides[dim];
+            rest /= convolution->kernelShape[dim];
+        }
+
+        for (int q = 0; q < rowGroups; q++) {
+            groupOffsets[r * rowGroups + q] = offset + (ptrdiff_t)4 * q * tensorBase->strides[dims - 1];
+            groupTaps[r * rowGroups + q] = kernelWidth - 4 * q < 4 ? kernelWidth - 4 * q : 4;
+        }
+    }
+
+    // Every kernel row is padded with zero weights to full groups.
+    for (int f = 0; f < convolution->filters; f++) {
+        int8_t* packed = (int8_t*)(weights + (size_t)f * groups);
+        const int8_t* filter = convolution->weights + (size_t)f * kernelRows * kernelWidth;
+
+        for (int r = 0; r < kernelRows; r++) {
+            for (int kx = 0; kx < kernelWidth; kx++) {
+                packed[r * rowGroups * 4 + kx] = filter[r * kernelWidth + kx];
+                weightSums[f] += filter[r * kernelWidth + kx];
+            }
+        }
+    }
+
+    const int outputWidth = convolution->outputShape[dims - 1];
+    const size_t rows = convolution->outputs / outputWidth;
+    const size_t rowOutputs = (size_t)outputWidth * convolution->filters;
+    QuantizedContext context = {convolution, groupOffsets, groupTaps, weights, weightSums, groups,
+        outputWidth, NULL, NULL, NULL};
+    (void)selectQuantizedKernels(&context);
+
+    const size_t grainSize = rowOutputs >= QUANTIZED_GRAIN_OUTPUTS ? 1 : QUANTIZED_GRAIN_OUTPUTS / rowOutputs;
+    (void)parallelFor(0, rows, grainSize, quantizedConvolutionTask, &context);
+
+    (void)free(groupOffsets);
+    (void)free(groupTaps);
+    (void)free(weights);
+    (void)free(weightSums);
+}
\ No newline at end of file
@@ -0,0 +1,703 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Operations/simd.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Number of outputs, that a thread computes at least per task.
+ */
+#define SEPARABLE_GRAIN_OUTPUTS 1024
+
+/**
+ * Relative deviation of a FLOAT kernel from the outer product of its
+ * factors, up to which it is treated as separable.
+ */
+#define SEPARABLE_FLOAT_TOLERANCE 1e-6
+
+/**
+ * Relative deviation of a DOUBLE kernel from the outer product of its
+ * factors, up to which it is treated as separable.
+ */
+#define SEPARABLE_DOUBLE_TOLERANCE 1e-12
+
+/**
+ * Computes `count` outputs of a 1D pass. The output `x` is the sum of
+ * `weights[k] * input[x * step + offsets[k]]` over all taps.
+ */
+typedef void (*SeparableTaps)(void* output, const void* input, const int count, const ptrdiff_t step,
+    const void* weights, const ptrdiff_t* offsets, const int taps);
+
+/**
+ * Parameters of one 1D pass along a dimension.
+ */
+typedef struct {
+    const ConvolutionProblem* problem;
+    SeparableTaps taps;
+    const char* input;
+    char* output;
+    const int* outputShape;
+    const ptrdiff_t* strides;
+    int dim;
+    int last;
+    const char* weights;
+    int size;
+    int first;
+    int end;
+    int width;
+    size_t elementSize;
+} SeparablePass;
+
+/**
+ * Adds a group of up to four taps onto the outputs, the sum of an output
+ * starts with `start`. Merging the taps spares loading and storing every
+ * output once per tap.
+ */
+#define SEPARABLE_ADD_GROUP(type, start, TAPS) \
+    for (int x = 0; x < count; x++) { \
+        type sum = start; \
+        sum += source0[x * step] * w[0]; \
+        if ((TAPS) > 1) sum += source1[x * step] * w[1]; \
+        if ((TAPS) > 2) sum += source2[x * step] * w[2]; \
+        if ((TAPS) > 3) sum += source3[x * step] * w[3]; \
+        output[x] = sum; \
+    }
+
+/**
+ * Adds the group of taps at `k` onto the outputs, the first group
+ * initializes them.
+ */
+#define SEPARABLE_ADD_TAPS(type, group, first) \
+    if (first) { \
+        if ((group) >= 4) { SEPARABLE_ADD_GROUP(type, 0, 4) } \
+        else if ((group) == 3) { SEPARABLE_ADD_GROUP(type, 0, 3) } \
+        else if ((group) == 2) { SEPARABLE_ADD_GROUP(type, 0, 2) } \
+        else { SEPARABLE_ADD_GROUP(type, 0, 1) } \
+    } else { \
+        if ((group) >= 4) { SEPARABLE_ADD_GROUP(type, output[x], 4) } \
+        else if ((group) == 3) { SEPARABLE_ADD_GROUP(type, output[x], 3) } \
+        else if ((group) == 2) { SEPARABLE_ADD_GROUP(type, output[x], 2) } \
+        else { SEPARABLE_ADD_GROUP(type, output[x], 1) } \
+    }
+
+/**
+ * Generates the tap function of one type and SIMD level.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The taps are added in groups of four onto the outputs, the innermost
+ * loop runs over neighbouring outputs and is vectorized. Unit distances are
+ * compiled separately, as every pass of a dense intermediate reads them.
+ * </p>
+ */
+#define DEFINE_SEPARABLE_TAPS(name, attributes, type) \
+    attributes \
+    static inline void name##Outputs(type* restrict output, const type* restrict input, const int count, \
+        const ptrdiff_t step, const type* restrict weights, const ptrdiff_t* restrict offsets, const int taps) { \
+        if (taps == 0) { \
+            for (int x = 0; x < count; x++) { \
+                output[x] = 0; \
+            } \
+        } \
+        for (int k = 0; k < taps; k += 4) { \
+            const int group = taps - k; \
+            const type* w = weights + k; \
+            const type* restrict source0 = input + offsets[k]; \
+            const type* restrict source1 = group > 1 ? input + offsets[k + 1] : source0; \
+            const type* restrict source2 = group > 2 ? input + offsets[k + 2] : source0; \
+            const type* restrict source3 = group > 3 ? input + offsets[k + 3] : source0; \
+            SEPARABLE_ADD_TAPS(type, group, k == 0) \
+        } \
+    } \
+    attributes \
+    static void name(void* output, const void* input, const int count, const ptrdiff_t step, \
+        const void* weights, const ptrdiff_t* offsets, const int taps) { \
+        if (step == 1) { \
+            name##Outputs((type*)output, (const type*)input, count, 1, (const type*)weights, offsets, taps); \
+        } else { \
+            name##Outputs((type*)output, (const type*)input, count, step, (const type*)weights, offsets, taps); \
+        } \
+    }
+
+DEFINE_SEPARABLE_TAPS(Integer_separableTaps, , int)
+DEFINE_SEPARABLE_TAPS(Float_separableTaps, , float)
+DEFINE_SEPARABLE_TAPS(Double_separableTaps, , double)
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_SEPARABLE_TAPS(Integer_separableTaps_avx2, __attribute__((target("avx2"))), int)
+DEFINE_SEPARABLE_TAPS(Float_separableTaps_avx2, __attribute__((target("avx2"))), float)
+DEFINE_SEPARABLE_TAPS(Double_separableTaps_avx2, __attribute__((target("avx2"))), double)
+
+// AVX-512 implies FMA, the results should not depend on the SIMD level.
+DEFINE_SEPARABLE_TAPS(Integer_separableTaps_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), int)
+DEFINE_SEPARABLE_TAPS(Float_separableTaps_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), float)
+DEFINE_SEPARABLE_TAPS(Double_separableTaps_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))), double)
+#endif
+
+/**
+ * Selects the tap function for the type and the active SIMD level.
+ * 
+ * @param tensorType    Type of the tensors.
+ * 
+ * @return The tap function.
+ */
+static SeparableTaps selectSeparableTaps(const TensorType tensorType) {
+    const SimdLevel level = getSimdLevel();
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_separableTaps_avx512 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_separableTaps_avx512 : Double_separableTaps_avx512;
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_separableTaps_avx2 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_separableTaps_avx2 : Double_separableTaps_avx2;
+    }
+#endif
+
+    (void)level;
+    return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_separableTaps :
+            tensorType == _TENSOR_TYPE_FLOAT_ ? Float_separableTaps : Double_separableTaps;
+}
+
+/**
+ * Calculates the greatest common divisor of two integers.
+ * 
+ * @param a     First integer.
+ * @param b     Second integer.
+ * 
+ * @return The non-negative greatest common divisor.
+ */
+static double greatestCommonDivisor(double a, double b) {
+    a = fabs(a);
+    b = fabs(b);
+
+    while (b != 0) {
+        const double rest = fmod(a, b);
+        a = b;
+        b = rest;
+    }
+
+    return a;
+}
+
+/**
+ * Factorizes a dense kernel into one vector per dimension, whose outer
+ * product is the kernel.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The fibers through the element with the largest magnitude are the factors
+ * of a rank-1 kernel. Every factor except the one of the last dimension
+ * larger than 1 (the carrier) is divided by the fiber value at the pivot,
+ * so its value there is 1 and a dimension of size 1 has the factor `[1]`.
+ * INTEGER factors are divided by the signed greatest common divisor of the
+ * fiber instead, so they stay integers. The carrier absorbs the remaining
+ * scale. Finally the outer product is compared with every kernel value.
+ * </p>
+ * 
+ * @param *values       Dense values of the kernel.
+ * @param *shape        Shape of the kernel.
+ * @param dims          Dimensions of the kernel.
+ * @param taps          Number of values of the kernel.
+ * @param tensorType    Type of the kernel.
+ * @param *pivot        Buffer for the coordinates of the pivot (`dims` elements).
+ * @param *factors      Buffer to write the concatenated factors to.
+ * 
+ * @return `true` when the kernel is the outer product of the factors.
+ */
+static int factorizeKernel(const double* values, const int* shape, const int dims, const size_t taps,
+    const TensorType tensorType, int* pivot, double* factors) {
+    size_t pivotIndex = 0;
+    double largest = 0;
+
+    for (size_t k = 0; k < taps; k++) {
+        if (fabs(values[k]) > largest) {
+            largest = fabs(values[k]);
+            pivotIndex = k;
+        }
+    }
+
+    if (largest == 0) {
+        return false;
+    }
+
+    size_t rest = pivotIndex;
+    int carrier = dims - 1;
+
+    for (int dim = dims - 1; dim >= 0; dim--) {
+        pivot[dim] = (int)(rest % shape[dim]);
+        rest /= shape[dim];
+    }
+
+    while (carrier > 0 && shape[carrier] == 1) {
+        carrier--;
+    }
+
+    double scale = 1;
+    double* factor = factors;
+    double* carrierFactor = NULL;
+
+    for (int dim = 0; dim < dims; dim++) {
+        size_t denseStride = 1;
+
+        for (int inner = dim + 1; inner < dims; inner++) {
+            denseStride *= shape[inner];
+        }
+
+        const double* fiber = values + pivotIndex - (size_t)pivot[dim] * denseStride;
+        double divisor = fiber[(size_t)pivot[dim] * denseStride];
+
+        if (dim == carrier) {
+            carrierFactor = factor;
+            divisor = 1;
+        } else if (tensorType == _TENSOR_TYPE_INTEGER_) {
+            double common = 0;
+
+            for (int k = 0; k < shape[dim]; k++) {
+                common = greatestCommonDivisor(common, fiber[(size_t)k * denseStride]);
+            }
+
+            divisor = divisor < 0 ? -common : common;
+        }
+
+        for (int k = 0; k < shape[dim]; k++) {
+            factor[k] = fiber[(size_t)k * denseStride] / divisor;
+            factor[k] = tensorType == _TENSOR_TYPE_FLOAT_ ? (double)(float)factor[k] : factor[k];
+        }
+
+        scale *= dim == carrier ? 1 : factor[pivot[dim]];
+        factor += shape[dim];
+    }
+
+    for (int k = 0; k < shape[carrier]; k++) {
+        if (tensorType == _TENSOR_TYPE_INTEGER_ && fmod(carrierFactor[k], scale) != 0) {
+            return false;
+        }
+
+        carrierFactor[k] /= scale;
+        carrierFactor[k] = tensorType == _TENSOR_TYPE_FLOAT_ ? (double)(float)carrierFactor[k] : carrierFactor[k];
+    }
+
+    const double tolerance = tensorType == _TENSOR_TYPE_INTEGER_ ? 0 :
+                            (tensorType == _TENSOR_TYPE_FLOAT_ ? SEPARABLE_FLOAT_TOLERANCE :
+                            SEPARABLE_DOUBLE_TOLERANCE) * largest;
+
+    for (size_t k = 0; k < taps; k++) {
+        double product = 1;
+        size_t index = k;
+        size_t start = 0;
+
+        for (int dim = 0; dim < dims; dim++) {
+            start += shape[dim];
+        }
+
+        for (int dim = dims - 1; dim >= 0; dim--) {
+            start -= shape[dim];
+            product *= factors[start + index % shape[dim]];
+            index /= shape[dim];
+        }
+
+        if (fabs(product - values[k]) > tolerance) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Decomposes a rank-1 kernel into one 1D kernel per dimension, whose outer
+ * product is the kernel (e.g. a Gaussian blur, a Sobel or a box filter).
+ * 
+ * <p><b>Note:</b><br>
+ * INTEGER kernels are decomposed into integer factors, whose outer product
+ * matches the kernel exactly. FLOAT and DOUBLE kernels are accepted, when
+ * the outer product of their factors deviates at most by a small relative
+ * tolerance. The factors are a copy, later changes of the kernel values are
+ * not reflected.
+ * </p>
+ * 
+ * @param *kernel       The kernel to decompose.
+ * @param tensorType    Type of the kernel (INTEGER, FLOAT or DOUBLE).
+ * 
+ * @return The decomposed kernel or `NULL`, when the kernel is not separable.
+ * 
+ * @throw MemoryAllocationException - When the decomposed kernel could not be allocated.
+ */
+SeparableKernel* createSeparableKernel(const void* kernel, const TensorType tensorType) {
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    const int dims = kernelBase->dimensions;
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const char* kernelData = (const char*)getTensorDataByType(kernel, tensorType);
+    size_t length = 0;
+
+    for (int dim = 0; dim < dims; dim++) {
+        length += kernelBase->shape[dim];
+    }
+
+    double* values = (double*)malloc(kernelBase->dataPoints * sizeof(double));
+    double* factors = (double*)malloc(length * sizeof(double));
+    int* pivot = (int*)malloc(dims * sizeof(int));
+    SeparableKernel* separable = (SeparableKernel*)calloc(1, sizeof(SeparableKernel));
+    int* sizes = (int*)malloc(dims * sizeof(int));
+    char* weights = (char*)malloc(length * elementSize);
+
+    if (values == NULL || factors == NULL || pivot == NULL || separable == NULL || sizes == NULL || weights == NULL) {
+        if (values != NULL) (void)free(values);
+        if (factors != NULL) (void)free(factors);
+        if (pivot != NULL) (void)free(pivot);
+        if (separable != NULL) (void)free(separable);
+        if (sizes != NULL) (void)free(sizes);
+        if (weights != NULL) (void)free(weights);
+        (void)throwMemoryAllocationException("Error on allocating memory for the separable kernel.");
+        return NULL;
+    }
+
+    for (size_t k = 0; k < kernelBase->dataPoints; k++) {
+        const char* value = kernelData + Tensor_getElementOffset(kernelBase, k) * elementSize;
+        values[k] = tensorType == _TENSOR_TYPE_INTEGER_ ? (double)*(const int*)value :
+                    tensorType == _TENSOR_TYPE_FLOAT_ ? (double)*(const float*)value : *(const double*)value;
+    }
+
+    const int isSeparable = factorizeKernel(values, kernelBase->shape, dims, kernelBase->dataPoints,
+                                tensorType, pivot, factors);
+
+    if (isSeparable) {
+        for (size_t k = 0; k < length; k++) {
+            switch (tensorType) {
+            case _TENSOR_TYPE_INTEGER_: ((int*)weights)[k] = (int)factors[k]; break;
+            case _TENSOR_TYPE_FLOAT_: ((float*)weights)[k] = (float)factors[k]; break;
+            default: ((double*)weights)[k] = factors[k]; break;
+            }
+        }
+
+        (void)memcpy(sizes, kernelBase->shape, dims * sizeof(int));
+        separable->tensorType = tensorType;
+        separable->dimensions = dims;
+        separable->sizes = sizes;
+        separable->factors = weights;
+    } else {
+        (void)free(separable);
+        (void)free(sizes);
+        (void)free(weights);
+        separable = NULL;
+    }
+
+    (void)free(values);
+    (void)free(factors);
+    (void)free(pivot);
+    return separable;
+}
+
+/**
+ * Frees a decomposed kernel.
+ * 
+ * @param *kernel   The decomposed kernel, can be `NULL`.
+ */
+void freeSeparableKernel(SeparableKernel* kernel) {
+    if (kernel == NULL) {
+        return;
+    }
+
+    (void)free(kernel->sizes);
+    (void)free(kernel->factors);
+    (void)free(kernel);
+}
+
+/**
+ * Collects the taps of an output of a pass, that read the tensor. Taps in
+ * the zero padding are dropped, the others are mapped by the padding.
+ * 
+ * @param *pass         The 1D pass.
+ * @param position      Output index along the dimension of the pass.
+ * @param step          Distance of neighbouring inputs along the dimension.
+ * @param *offsets      Buffer to write the offsets of the taps to.
+ * @param *weights      Buffer to write the weights of the taps to.
+ * 
+ * @return The number of collected taps.
+ */
+static int gatherSeparableTaps(const SeparablePass* pass, const int position, const ptrdiff_t step,
+    ptrdiff_t* offsets, char* weights) {
+    const ConvolutionProblem* problem = pass->problem;
+    const int size = problem->tensorBase->shape[pass->dim];
+    const int start = position * problem->stride - problem->paddingBefore[pass->dim];
+    int count = 0;
+
+    for (int k = 0; k < pass->size; k++) {
+        const int index = resolvePaddedIndex(start + k, size, problem->padding);
+
+        if (index >= 0) {
+            offsets[count] = (ptrdiff_t)index * step;
+            (void)memcpy(weights + count * pass->elementSize, pass->weights + k * pass->elementSize,
+                pass->elementSize);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Computes the output rows [from; to) of a 1D pass.
+ * 
+ * <p><b>Functionality:</b><br>
+ * A pass along the last dimension computes the outputs of a row, whose
+ * taps lie inside of the tensor, in one call and the border outputs one by
+ * one. A pass along any other dimension combines whole input rows, so the
+ * padding is resolved once per output row.
+ * </p>
+ * 
+ * @param from      First output row.
+ * @param to        End of the output rows (exclusive).
+ * @param *context  The SeparablePass.
+ */
+static void separableTask(const size_t from, const size_t to, void* context) {
+    const SeparablePass* pass = (SeparablePass*)context;
+    const ConvolutionProblem* problem = pass->problem;
+    const size_t elementSize = pass->elementSize;
+    const ptrdiff_t tapStep = pass->strides[pass->last];
+    ptrdiff_t* offsets = (ptrdiff_t*)malloc(pass->size * sizeof(ptrdiff_t));
+    char* weights = (char*)malloc(pass->size * elementSize);
+
+    if (offsets == NULL || weights == NULL) {
+        if (offsets != NULL) (void)free(offsets);
+        if (weights != NULL) (void)free(weights);
+        (void)throwMemoryAllocationException("Error on allocating memory for the taps (separable convolution).");
+        return;
+    }
+
+    for (size_t row = from; row < to; row++) {
+        size_t rest = row;
+        ptrdiff_t base = 0;
+        int position = 0;
+
+        for (int dim = pass->last - 1; dim >= 0; dim--) {
+            const int index = (int)(rest % pass->outputShape[dim]);
+            rest /= pass->outputShape[dim];
+
+            if (dim == pass->dim) {
+                position = index;
+            } else {
+                base += (ptrdiff_t)index * pass->strides[dim];
+            }
+        }
+
+        const char* input = pass->input + base * (ptrdiff_t)elementSize;
+        char* output = pass->output + row * pass->width * elementSize;
+
+        if (pass->dim != pass->last) {
+            const int count = gatherSeparableTaps(pass, position, pass->strides[pass->dim], offsets, weights);
+            (void)pass->taps(output, input, pass->width, tapStep, weights, offsets, count);
+            continue;
+        }
+
+        if (pass->first < pass->end) {
+            const ptrdiff_t start = (ptrdiff_t)pass->first * problem->stride - problem->paddingBefore[pass->dim];
+
+            for (int k = 0; k < pass->size; k++) {
+                offsets[k] = (ptrdiff_t)k * tapStep;
+            }
+
+            (void)pass->taps(output + pass->first * elementSize, input + start * tapStep * (ptrdiff_t)elementSize,
+                pass->end - pass->first, tapStep * problem->stride, pass->weights, offsets, pass->size);
+        }
+
+        const int border = pass->first < pass->end ? pass->end : pass->first;
+
+        for (int x = 0; x < pass->width; x++) {
+            if (x == pass->first) {
+                x = border;
+
+                if (x >= pass->width) {
+                    break;
+                }
+            }
+
+            const int count = gatherSeparableTaps(pass, x, tapStep, offsets, weights);
+            (void)pass->taps(output + x * elementSize, input, 1, 0, weights, offsets, count);
+        }
+    }
+
+    (void)free(offsets);
+    (void)free(weights);
+}
+
+/**
+ * Checks whether the pass along a dimension would copy its input. This is
+ * the case for a factor `[1]` without stride or padding in the dimension.
+ * 
+ * @param *problem      The convolution.
+ * @param *kernel       The decomposed kernel.
+ * @param dim           The dimension.
+ * @param *factor       Factor of the dimension.
+ * 
+ * @return `true` when the pass can be skipped.
+ */
+static int isIdentityPass(const ConvolutionProblem* problem, const SeparableKernel* kernel,
+    const int dim, const void* factor) {
+    const int size = problem->tensorBase->shape[dim];
+
+    if (kernel->sizes[dim] != 1 || problem->outputShape[dim] != size || problem->paddingBefore[dim] != 0
+        || (problem->stride != 1 && size != 1)) {
+        return false;
+    }
+
+    switch (kernel->tensorType) {
+    case _TENSOR_TYPE_INTEGER_: return *(const int*)factor == 1;
+    case _TENSOR_TYPE_FLOAT_: return *(const float*)factor == 1;
+    default: return *(const double*)factor == 1;
+    }
+}
+
+/**
+ * Executes the convolution of the problem with a decomposed kernel as one
+ * 1D convolution per dimension.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The last dimension is convolved first, as it reads the tensor along its
+ * rows and shrinks the intermediate most often. The other dimensions follow
+ * from the back, each pass combines whole rows of its input, so it stays
+ * vectorized along the last dimension. Every pass applies the stride and
+ * the padding of its own dimension, padding each dimension separately is
+ * equal to padding the tensor. The intermediates are dense, the last pass
+ * writes into the destination. Instead of `K^N` multiplications an output
+ * costs about `N * K` ones, the sums are formed in a different order than by
+ * the other engines, so FLOAT and DOUBLE results can differ in the last bits.
+ * </p>
+ * 
+ * @param *problem  The convolution.
+ * @param *kernel   The decomposed kernel of the problem.
+ */
+void convolveSeparable(const ConvolutionProblem* problem, const SeparableKernel* kernel) {
+    const Tensor* tensorBase = problem->tensorBase;
+    const int dims = tensorBase->dimensions;
+    const size_t elementSize = problem->tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    int* shape = (int*)malloc(dims * sizeof(int));
+    int* passes = (int*)malloc(dims * sizeof(int));
+    ptrdiff_t* strides = (ptrdiff_t*)malloc(dims * sizeof(ptrdiff_t));
+    size_t* factorOffsets = (size_t*)malloc(dims * sizeof(size_t));
+
+    if (shape == NULL || passes == NULL || strides == NULL || factorOffsets == NULL) {
+        if (shape != NULL) (void)free(shape);
+        if (passes != NULL) (void)free(passes);
+        if (strides != NULL) (void)free(strides);
+        if (factorOffsets != NULL) (void)free(factorOffsets);
+        (void)throwMemoryAllocationException("Error on allocating memory for the passes (separable convolution).");
+        return;
+    }
+
+    const char* factors = (const char*)kernel->factors;
+    int passCount = 0;
+    size_t intermediate = 0;
+
+    for (int dim = 0; dim < dims; dim++) {
+        factorOffsets[dim] = dim == 0 ? 0 : factorOffsets[dim - 1] + kernel->sizes[dim - 1];
+        shape[dim] = tensorBase->shape[dim];
+        strides[dim] = (ptrdiff_t)tensorBase->strides[dim];
+    }
+
+    for (int dim = dims - 1; dim >= 0; dim--) {
+        if (isIdentityPass(problem, kernel, dim, factors + factorOffsets[dim] * elementSize) == false) {
+            passes[passCount++] = dim;
+        }
+    }
+
+    if (passCount == 0) {
+        passes[passCount++] = dims - 1;
+    }
+
+    for (int p = 0; p + 1 < passCount; p++) {
+        size_t size = 1;
+        shape[passes[p]] = problem->outputShape[passes[p]];
+
+        for (int dim = 0; dim < dims; dim++) {
+            size *= shape[dim];
+        }
+
+        intermediate = size > intermediate ? size : intermediate;
+    }
+
+    char* buffers[2] = {NULL, NULL};
+
+    for (int b = 0; b < 2 && b + 1 < passCount; b++) {
+        buffers[b] = (char*)malloc(intermediate * elementSize);
+
+        if (buffers[b] == NULL) {
+            if (buffers[0] != NULL) (void)free(buffers[0]);
+            (void)free(shape);
+            (void)free(passes);
+            (void)free(strides);
+            (void)free(factorOffsets);
+            (void)throwMemoryAllocationException("Error on allocating memory for the intermediates (separable convolution).");
+            return;
+        }
+    }
+
+    const SeparableTaps taps = selectSeparableTaps(problem->tensorType);
+    const char* input = (const char*)getTensorDataByType(problem->tensor, problem->tensorType);
+    char* dest = (char*)getTensorDataByType(problem->dest, problem->tensorType);
+    (void)memcpy(shape, tensorBase->shape, dims * sizeof(int));
+
+    for (int p = 0; p < passCount; p++) {
+        const int dim = passes[p];
+        char* output = p + 1 == passCount ? dest : buffers[p % 2];
+        shape[dim] = problem->outputShape[dim];
+
+        const int width = shape[dims - 1];
+        size_t outputRows = 1;
+
+        for (int inner = 0; inner < dims - 1; inner++) {
+            outputRows *= shape[inner];
+        }
+
+        SeparablePass pass = {problem, taps, input, output, shape, strides, dim, dims - 1,
+            factors + factorOffsets[dim] * elementSize, kernel->sizes[dim], 0, 0, width, elementSize};
+        (void)getInteriorOutputRange(problem, dim, &pass.first, &pass.end);
+
+        const size_t grainSize = width >= SEPARABLE_GRAIN_OUTPUTS ? 1 : SEPARABLE_GRAIN_OUTPUTS / width;
+        (void)parallelFor(0, outputRows, grainSize, separableTask, &pass);
+
+        ptrdiff_t denseStride = 1;
+
+        for (int inner = dims - 1; inner >= 0; inner--) {
+            strides[inner] = denseStride;
+            denseStride *= shape[inner];
+        }
+
+        input = output;
+    }
+
+    (void)free(buffers[0]);
+    (void)free(buffers[1]);
+    (void)free(shape);
+    (void)free(passes);
+    (void)free(strides);
+    (void)free(factorOffsets);
+}
\ No newline at end of file
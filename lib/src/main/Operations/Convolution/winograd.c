@@ -0,0 +1,499 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/Convolution/engine.h"
+#include "Operations/simd.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Number of horizontally neighbouring tiles, that are transformed at once.
+ * The transforms run over all tiles of a batch in the innermost loop, so
+ * the compiler can vectorize them.
+ */
+#define WINOGRAD_BATCH 16
+
+/**
+ * Input transform B^T of F(2x2,3x3) applied on 4 values with the distance
+ * `inStep`, for all tiles of a batch.
+ */
+#define WINOGRAD_INPUT_2(in, inStep, out, outStep) \
+    for (int t = 0; t < WINOGRAD_BATCH; t++) { \
+        (out)[t] = (in)[t] - (in)[2 * (inStep) + t]; \
+        (out)[(outStep) + t] = (in)[(inStep) + t] + (in)[2 * (inStep) + t]; \
+        (out)[2 * (outStep) + t] = (in)[2 * (inStep) + t] - (in)[(inStep) + t]; \
+        (out)[3 * (outStep) + t] = (in)[(inStep) + t] - (in)[3 * (inStep) + t]; \
+    }
+
+/**
+ * Input transform B^T of F(4x4,3x3) applied on 6 values with the distance
+ * `inStep`, for all tiles of a batch.
+ */
+#define WINOGRAD_INPUT_4(in, inStep, out, outStep) \
+    for (int t = 0; t < WINOGRAD_BATCH; t++) { \
+        (out)[t] = 4 * (in)[t] - 5 * (in)[2 * (inStep) + t] + (in)[4 * (inStep) + t]; \
+        (out)[(outStep) + t] = -4 * (in)[(inStep) + t] - 4 * (in)[2 * (inStep) + t] \
+            + (in)[3 * (inStep) + t] + (in)[4 * (inStep) + t]; \
+        (out)[2 * (outStep) + t] = 4 * (in)[(inStep) + t] - 4 * (in)[2 * (inStep) + t] \
+            - (in)[3 * (inStep) + t] + (in)[4 * (inStep) + t]; \
+        (out)[3 * (outStep) + t] = -2 * (in)[(inStep) + t] - (in)[2 * (inStep) + t] \
+            + 2 * (in)[3 * (inStep) + t] + (in)[4 * (inStep) + t]; \
+        (out)[4 * (outStep) + t] = 2 * (in)[(inStep) + t] - (in)[2 * (inStep) + t] \
+            - 2 * (in)[3 * (inStep) + t] + (in)[4 * (inStep) + t]; \
+        (out)[5 * (outStep) + t] = 4 * (in)[(inStep) + t] - 5 * (in)[3 * (inStep) + t] \
+            + (in)[5 * (inStep) + t]; \
+    }
+
+/**
+ * Output transform A^T of F(2x2,3x3) applied on 4 values with the distance
+ * `inStep`, for all tiles of a batch.
+ */
+#define WINOGRAD_OUTPUT_2(in, inStep, out, outStep) \
+    for (int t = 0; t < WINOGRAD_BATCH; t++) { \
+        (out)[t] = (in)[t] + (in)[(inStep) + t] + (in)[2 * (inStep) + t]; \
+        (out)[(outStep) + t] = (in)[(inStep) + t] - (in)[2 * (inStep) + t] - (in)[3 * (inStep) + t]; \
+    }
+
+/**
+ * Output transform A^T of F(4x4,3x3) applied on 6 values with the distance
+ * `inStep`, for all tiles of a batch.
+ */
+#define WINOGRAD_OUTPUT_4(in, inStep, out, outStep) \
+    for (int t = 0; t < WINOGRAD_BATCH; t++) { \
+        (out)[t] = (in)[t] + (in)[(inStep) + t] + (in)[2 * (inStep) + t] \
+            + (in)[3 * (inStep) + t] + (in)[4 * (inStep) + t]; \
+        (out)[(outStep) + t] = (in)[(inStep) + t] - (in)[2 * (inStep) + t] \
+            + 2 * (in)[3 * (inStep) + t] - 2 * (in)[4 * (inStep) + t]; \
+        (out)[2 * (outStep) + t] = (in)[(inStep) + t] + (in)[2 * (inStep) + t] \
+            + 4 * (in)[3 * (inStep) + t] + 4 * (in)[4 * (inStep) + t]; \
+        (out)[3 * (outStep) + t] = (in)[(inStep) + t] - (in)[2 * (inStep) + t] \
+            + 8 * (in)[3 * (inStep) + t] - 8 * (in)[4 * (inStep) + t] + (in)[5 * (inStep) + t]; \
+    }
+
+/**
+ * Kernel transform G of F(2x2,3x3).
+ */
+static const double WINOGRAD_G_2[4][3] = {
+    {1.0, 0.0, 0.0},
+    {0.5, 0.5, 0.5},
+    {0.5, -0.5, 0.5},
+    {0.0, 0.0, 1.0}
+};
+
+/**
+ * Kernel transform G of F(4x4,3x3).
+ */
+static const double WINOGRAD_G_4[6][3] = {
+    {1.0 / 4.0, 0.0, 0.0},
+    {-1.0 / 6.0, -1.0 / 6.0, -1.0 / 6.0},
+    {-1.0 / 6.0, 1.0 / 6.0, -1.0 / 6.0},
+    {1.0 / 24.0, 1.0 / 12.0, 1.0 / 6.0},
+    {1.0 / 24.0, -1.0 / 12.0, 1.0 / 6.0},
+    {0.0, 0.0, 1.0}
+};
+
+struct WinogradContext;
+
+/**
+ * Computes one row of output tiles of a single output plane.
+ */
+typedef void (*WinogradRow)(const struct WinogradContext* context,
+    const size_t tensorOffset, void* output, const int tileRow);
+
+/**
+ * Parameters of a Winograd convolution that is split across threads.
+ */
+typedef struct WinogradContext {
+    const ConvolutionProblem* problem;
+    const void* data;
+    void* output;
+    const void* weights;
+    int slices;
+    const size_t* sliceOffsets;
+    int height;
+    int width;
+    size_t rowStride;
+    size_t columnStride;
+    int outputHeight;
+    int outputWidth;
+    int tileRows;
+    int tileColumns;
+    WinogradRow row;
+} WinogradContext;
+
+/**
+ * Generates the function, that computes one row of output tiles of
+ * F(m x m, 3x3) with `n = m + 2` input values per tile and axis.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The tiles of the row are processed in batches of `WINOGRAD_BATCH`. For
+ * every kernel slice the `n x n` input tiles are gathered (zero padded at the
+ * borders), transformed by B^T d B and multiplied elementwise with the
+ * transformed kernel slice. The products of all slices are accumulated in the
+ * Winograd domain, so the output transform A^T M A runs once per tile.
+ * </p>
+ */
+#define DEFINE_WINOGRAD_ROW(name, attributes, type, m) \
+    attributes \
+    static void name(const WinogradContext* w, const size_t tensorOffset, \
+        void* outputData, const int tileRow) { \
+        enum { n = (m) + 2 }; \
+        const type* data = (const type*)w->data + tensorOffset; \
+        const type* weights = (const type*)w->weights; \
+        type* output = (type*)outputData; \
+        type d[n * n * WINOGRAD_BATCH]; \
+        type tmp[n * n * WINOGRAD_BATCH]; \
+        type v[n * n * WINOGRAD_BATCH]; \
+        type acc[n * n * WINOGRAD_BATCH]; \
+        const int y0 = tileRow * (m); \
+        for (int tx = 0; tx < w->tileColumns; tx += WINOGRAD_BATCH) { \
+            const int lanes = w->tileColumns - tx < WINOGRAD_BATCH ? w->tileColumns - tx : WINOGRAD_BATCH; \
+            const int inside = lanes == WINOGRAD_BATCH && y0 + n <= w->height \
+                && (tx + WINOGRAD_BATCH - 1) * (m) + n <= w->width; \
+            (void)memset(acc, 0, sizeof(acc)); \
+            for (int s = 0; s < w->slices; s++) { \
+                const type* slice = data + w->sliceOffsets[s]; \
+                if (inside) { \
+                    for (int k = 0; k < n; k++) { \
+                        const type* row = slice + (size_t)(y0 + k) * w->rowStride; \
+                        for (int l = 0; l < n; l++) { \
+                            for (int t = 0; t < WINOGRAD_BATCH; t++) { \
+                                d[(k * n + l) * WINOGRAD_BATCH + t] = \
+                                    row[(size_t)((tx + t) * (m) + l) * w->columnStride]; \
+                            } \
+                        } \
+                    } \
+                } else { \
+                    for (int k = 0; k < n; k++) { \
+                        const type* row = slice + (size_t)(y0 + k) * w->rowStride; \
+                        for (int l = 0; l < n; l++) { \
+                            for (int t = 0; t < WINOGRAD_BATCH; t++) { \
+                                const int x = (tx + t) * (m) + l; \
+                                d[(k * n + l) * WINOGRAD_BATCH + t] = t < lanes && y0 + k < w->height && x < w->width ? \
+                                    row[(size_t)x * w->columnStride] : 0; \
+                            } \
+                        } \
+                    } \
+                } \
+                for (int k = 0; k < n; k++) { \
+                    WINOGRAD_INPUT_##m(d + k * n * WINOGRAD_BATCH, WINOGRAD_BATCH, \
+                        tmp + k * n * WINOGRAD_BATCH, WINOGRAD_BATCH) \
+                } \
+                for (int l = 0; l < n; l++) { \
+                    WINOGRAD_INPUT_##m(tmp + l * WINOGRAD_BATCH, n * WINOGRAD_BATCH, \
+                        v + l * WINOGRAD_BATCH, n * WINOGRAD_BATCH) \
+                } \
+                const type* u = weights + (size_t)s * n * n; \
+                for (int i = 0; i < n * n; i++) { \
+                    for (int t = 0; t < WINOGRAD_BATCH; t++) { \
+                        acc[i * WINOGRAD_BATCH + t] += u[i] * v[i * WINOGRAD_BATCH + t]; \
+                    } \
+                } \
+            } \
+            for (int k = 0; k < n; k++) { \
+                WINOGRAD_OUTPUT_##m(acc + k * n * WINOGRAD_BATCH, WINOGRAD_BATCH, \
+                    tmp + k * n * WINOGRAD_BATCH, WINOGRAD_BATCH) \
+            } \
+            for (int l = 0; l < (m); l++) { \
+                WINOGRAD_OUTPUT_##m(tmp + l * WINOGRAD_BATCH, n * WINOGRAD_BATCH, \
+                    v + l * WINOGRAD_BATCH, n * WINOGRAD_BATCH) \
+            } \
+            for (int r = 0; r < (m) && y0 + r < w->outputHeight; r++) { \
+                type* outputRow = output + (size_t)(y0 + r) * w->outputWidth; \
+                for (int t = 0; t < lanes; t++) { \
+                    for (int c = 0; c < (m) && (tx + t) * (m) + c < w->outputWidth; c++) { \
+                        outputRow[(tx + t) * (m) + c] = v[(r * n + c) * WINOGRAD_BATCH + t]; \
+                    } \
+                } \
+            } \
+        } \
+    }
+
+DEFINE_WINOGRAD_ROW(Float_winogradRow2, , float, 2)
+DEFINE_WINOGRAD_ROW(Float_winogradRow4, , float, 4)
+DEFINE_WINOGRAD_ROW(Double_winogradRow2, , double, 2)
+DEFINE_WINOGRAD_ROW(Double_winogradRow4, , double, 4)
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_WINOGRAD_ROW(Float_winogradRow2_avx2, __attribute__((target("avx2,fma"))), float, 2)
+DEFINE_WINOGRAD_ROW(Float_winogradRow4_avx2, __attribute__((target("avx2,fma"))), float, 4)
+DEFINE_WINOGRAD_ROW(Double_winogradRow2_avx2, __attribute__((target("avx2,fma"))), double, 2)
+DEFINE_WINOGRAD_ROW(Double_winogradRow4_avx2, __attribute__((target("avx2,fma"))), double, 4)
+
+DEFINE_WINOGRAD_ROW(Float_winogradRow2_avx512, __attribute__((target("avx512f"))), float, 2)
+DEFINE_WINOGRAD_ROW(Float_winogradRow4_avx512, __attribute__((target("avx512f"))), float, 4)
+DEFINE_WINOGRAD_ROW(Double_winogradRow2_avx512, __attribute__((target("avx512f"))), double, 2)
+DEFINE_WINOGRAD_ROW(Double_winogradRow4_avx512, __attribute__((target("avx512f"))), double, 4)
+#endif
+
+/**
+ * Selects the row function for the type, the tile size and the active
+ * SIMD level.
+ * 
+ * @param tensorType    Type of the tensors (FLOAT or DOUBLE).
+ * @param tileSize      Output tile size `m` (2 or 4).
+ * 
+ * @return The row function.
+ */
+static WinogradRow selectWinogradRow(const TensorType tensorType, const int tileSize) {
+    const SimdLevel level = getSimdLevel();
+    const int isFloat = tensorType == _TENSOR_TYPE_FLOAT_;
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        if (isFloat) return tileSize == 4 ? Float_winogradRow4_avx512 : Float_winogradRow2_avx512;
+        return tileSize == 4 ? Double_winogradRow4_avx512 : Double_winogradRow2_avx512;
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        if (isFloat) return tileSize == 4 ? Float_winogradRow4_avx2 : Float_winogradRow2_avx2;
+        return tileSize == 4 ? Double_winogradRow4_avx2 : Double_winogradRow2_avx2;
+    }
+#endif
+
+    (void)level;
+
+    if (isFloat) return tileSize == 4 ? Float_winogradRow4 : Float_winogradRow2;
+    return tileSize == 4 ? Double_winogradRow4 : Double_winogradRow2;
+}
+
+/**
+ * Checks whether a convolution with the given kernel and stride can be
+ * executed by the Winograd engine. That is the case for FLOAT and DOUBLE
+ * tensors with stride 1, whose kernels are 3x3 in the two innermost
+ * dimensions (e.g. 3x3 or Cx3x3).
+ * 
+ * @param *kernelBase   Base of the kernel.
+ * @param tensorType    Type of the tensors.
+ * @param stride        Stride of the convolution.
+ * 
+ * @return `true` if the Winograd engine can be used, else `false`.
+ */
+int isWinogradApplicable(const Tensor* kernelBase, const TensorType tensorType, const int stride) {
+    if (tensorType != _TENSOR_TYPE_FLOAT_ && tensorType != _TENSOR_TYPE_DOUBLE_) {
+        return false;
+    } else if (stride != 1 || kernelBase->dimensions < 2) {
+        return false;
+    }
+
+    return kernelBase->shape[kernelBase->dimensions - 2] == 3
+        && kernelBase->shape[kernelBase->dimensions - 1] == 3;
+}
+
+/**
+ * Transforms every 3x3 slice of the kernel by G g G^T into the Winograd
+ * domain of one tile size.
+ * 
+ * @param *kernel       The kernel.
+ * @param tensorType    Type of the kernel (FLOAT or DOUBLE).
+ * @param slices        Number of 3x3 slices.
+ * @param n             Number of transformed values per axis (4 or 6).
+ * @param *G            The `n x 3` kernel transform.
+ * @param *weights      Array of `slices * n * n` values to write to.
+ */
+static void transformWinogradKernel(const void* kernel, const TensorType tensorType,
+    const int slices, const int n, const double (*G)[3], void* weights) {
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    const void* kernelData = getTensorDataByType(kernel, tensorType);
+
+    for (int s = 0; s < slices; s++) {
+        double g[3][3];
+        double gG[3][6];
+
+        for (int i = 0; i < 9; i++) {
+            const size_t offset = Tensor_getElementOffset(kernelBase, (size_t)s * 9 + i);
+            g[i / 3][i % 3] = tensorType == _TENSOR_TYPE_FLOAT_ ?
+                            ((const float*)kernelData)[offset] : ((const double*)kernelData)[offset];
+        }
+
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < n; j++) {
+                gG[i][j] = g[i][0] * G[j][0] + g[i][1] * G[j][1] + g[i][2] * G[j][2];
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                const double u = G[i][0] * gG[0][j] + G[i][1] * gG[1][j] + G[i][2] * gG[2][j];
+                const size_t index = (size_t)s * n * n + i * n + j;
+
+                if (tensorType == _TENSOR_TYPE_FLOAT_) {
+                    ((float*)weights)[index] = (float)u;
+                } else {
+                    ((double*)weights)[index] = u;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Transforms the given kernel once into the Winograd domain of F(2x2,3x3)
+ * and F(4x4,3x3).
+ * 
+ * <p><b>Note:</b><br>
+ * The kernel must be applicable for the Winograd engine. The transformed
+ * kernel is a copy, later changes of the kernel values are not reflected.
+ * </p>
+ * 
+ * @param *kernel       The kernel to transform.
+ * @param tensorType    Type of the kernel (FLOAT or DOUBLE).
+ * 
+ * @return The transformed kernel or `NULL` on failure.
+ * 
+ * @throw IllegalArgumentException - When the kernel cannot be used by the Winograd engine.
+ * @throw MemoryAllocationException - When the transformed kernel could not be allocated.
+ */
+WinogradKernel* createWinogradKernel(const void* kernel, const TensorType tensorType) {
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+
+    if (isWinogradApplicable(kernelBase, tensorType, 1) == false) {
+        (void)throwIllegalArgumentException("Winograd convolutions require a FLOAT or DOUBLE kernel ending in 3x3.");
+        return NULL;
+    }
+
+    const int slices = (int)(kernelBase->dataPoints / 9);
+    const size_t elementSize = tensorType == _TENSOR_TYPE_FLOAT_ ? sizeof(float) : sizeof(double);
+    WinogradKernel* transformed = (WinogradKernel*)calloc(1, sizeof(WinogradKernel));
+    void* weights2 = malloc((size_t)slices * 16 * elementSize);
+    void* weights4 = malloc((size_t)slices * 36 * elementSize);
+
+    if (transformed == NULL || weights2 == NULL || weights4 == NULL) {
+        if (transformed != NULL) (void)free(transformed);
+        if (weights2 != NULL) (void)free(weights2);
+        if (weights4 != NULL) (void)free(weights4);
+        (void)throwMemoryAllocationException("Error on allocating memory for the Winograd kernel.");
+        return NULL;
+    }
+
+    (void)transformWinogradKernel(kernel, tensorType, slices, 4, WINOGRAD_G_2, weights2);
+    (void)transformWinogradKernel(kernel, tensorType, slices, 6, WINOGRAD_G_4, weights4);
+
+    transformed->tensorType = tensorType;
+    transformed->slices = slices;
+    transformed->weights2 = weights2;
+    transformed->weights4 = weights4;
+    return transformed;
+}
+
+/**
+ * Frees a transformed Winograd kernel.
+ * 
+ * @param *kernel   The kernel to free.
+ */
+void freeWinogradKernel(WinogradKernel* kernel) {
+    if (kernel == NULL) {
+        return;
+    }
+
+    (void)free(kernel->weights2);
+    (void)free(kernel->weights4);
+    (void)free(kernel);
+}
+
+/**
+ * Computes the tile rows [from; to) of all output planes.
+ * 
+ * @param from      First tile row (counted over all planes).
+ * @param to        End of the tile rows (exclusive).
+ * @param *context  The WinogradContext.
+ */
+static void winogradTask(const size_t from, const size_t to, void* context) {
+    const WinogradContext* w = (WinogradContext*)context;
+    const ConvolutionProblem* problem = w->problem;
+    const int planeDimensions = problem->tensorBase->dimensions - 2;
+    const size_t planeOutputs = (size_t)w->outputHeight * w->outputWidth;
+    const size_t elementSize = problem->tensorType == _TENSOR_TYPE_FLOAT_ ? sizeof(float) : sizeof(double);
+
+    for (size_t item = from; item < to; item++) {
+        const size_t plane = item / w->tileRows;
+        const int tileRow = (int)(item % w->tileRows);
+        size_t rest = plane;
+        size_t tensorOffset = 0;
+
+        for (int dim = planeDimensions - 1; dim >= 0; dim--) {
+            tensorOffset += (rest % problem->outputShape[dim]) * problem->tensorBase->strides[dim];
+            rest /= problem->outputShape[dim];
+        }
+
+        (void)w->row(w, tensorOffset, (char*)w->output + plane * planeOutputs * elementSize, tileRow);
+    }
+}
+
+/**
+ * Executes the convolution of the problem with the Winograd algorithm.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The two innermost dimensions are convolved with F(4x4,3x3), or with
+ * F(2x2,3x3) when an output plane is smaller than 4 in either dimension.
+ * Every leading dimension of the kernel (e.g. the channels of a Cx3x3 kernel)
+ * selects a 3x3 slice, whose products are summed up in the Winograd domain.
+ * Output planes and their tile rows are distributed over the threads.
+ * </p>
+ * 
+ * @param *problem  The convolution, it must be applicable for the Winograd engine.
+ * @param *kernel   The transformed kernel of the problem.
+ */
+void convolveWinograd(const ConvolutionProblem* problem, const WinogradKernel* kernel) {
+    const Tensor* tensorBase = problem->tensorBase;
+    const Tensor* kernelBase = problem->kernelBase;
+    const int dims = tensorBase->dimensions;
+    size_t* sliceOffsets = (size_t*)malloc(kernel->slices * sizeof(size_t));
+
+    if (sliceOffsets == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the slice offsets (convolution).");
+        return;
+    }
+
+    for (int s = 0; s < kernel->slices; s++) {
+        size_t rest = s;
+        size_t offset = 0;
+
+        for (int dim = dims - 3; dim >= 0; dim--) {
+            offset += (rest % kernelBase->shape[dim]) * tensorBase->strides[dim];
+            rest /= kernelBase->shape[dim];
+        }
+
+        sliceOffsets[s] = offset;
+    }
+
+    const int outputHeight = problem->outputShape[dims - 2];
+    const int outputWidth = problem->outputShape[dims - 1];
+    const int tileSize = outputHeight >= 4 && outputWidth >= 4 ? 4 : 2;
+    const int tileRows = (outputHeight + tileSize - 1) / tileSize;
+    const size_t planes = problem->outputs / ((size_t)outputHeight * outputWidth);
+
+    WinogradContext context = {problem, getTensorDataByType(problem->tensor, problem->tensorType),
+        getTensorDataByType(problem->dest, problem->tensorType),
+        tileSize == 4 ? kernel->weights4 : kernel->weights2, kernel->slices, sliceOffsets,
+        tensorBase->shape[dims - 2], tensorBase->shape[dims - 1],
+        tensorBase->strides[dims - 2], tensorBase->strides[dims - 1],
+        outputHeight, outputWidth, tileRows, (outputWidth + tileSize - 1) / tileSize,
+        selectWinogradRow(problem->tensorType, tileSize)};
+
+    (void)parallelFor(0, planes * tileRows, 1, winogradTask, &context);
+    (void)free(sliceOffsets);
+}
\ No newline at end of file
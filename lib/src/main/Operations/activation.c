@@ -24,21 +24,90 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Tensor/tensor.h"
 #include "Operations/activation.h"
 #include "mathUtils.h"
+#include "Utils/threadPool.h"
 #include "Error/exceptions.h"
 
 /**
- * Calculates the ReLU of a given data tensor and sets the results back
- * into the data tensor.
+ * Minimum number of elements a thread processes per chunk of a
+ * cheap activation function.
+ */
+#define ACTIVATION_GRAIN_SIZE 65536
+
+/**
+ * Minimum number of elements a thread processes per chunk of an
+ * activation function, that evaluates `exp` per element.
+ */
+#define EXPONENTIAL_ACTIVATION_GRAIN_SIZE 8192
+
+/**
+ * Parameters of an activation function that is split across threads.
+ */
+typedef struct {
+    void* data;
+    double alpha;
+    TensorType tensorType;
+    const Tensor* base;
+    size_t runLength;
+    ParallelTask task;
+} ActivationContext;
+
+/**
+ * Applies the activation task of the given context on the runs [from; to)
+ * of a strided tensor.
  * 
- * <p><b>Definition:</b><br>
- * ReLU(x) = `0` when `x <= 0`, but `x` when `x > 0`.
+ * @param from      First run to process.
+ * @param to        End of the runs to process (exclusive).
+ * @param *context  The ActivationContext.
+ */
+static void stridedActivationTask(const size_t from, const size_t to, void* context) {
+    const ActivationContext* activation = (ActivationContext*)context;
+
+    for (size_t run = from; run < to; run++) {
+        const size_t offset = Tensor_getElementOffset(activation->base, run * activation->runLength);
+        (void)activation->task(offset, offset + activation->runLength, context);
+    }
+}
+
+/**
+ * Distributes the given activation task over the threads.
+ * 
+ * <p><b>Functionality:</b><br>
+ * A contiguous tensor is processed as one range. A strided view is split
+ * into runs of consecutive elements, on which the task is applied.
  * </p>
+ * 
+ * @param *context      The ActivationContext with the data and base of the tensor.
+ * @param grainSize     Minimum number of elements per chunk.
+ * @param task          The activation task, that processes a consecutive range.
  */
-void ReLU(void* data, const Tensor* base, const TensorType tensorType) {
-    switch (tensorType) {
+static void executeActivation(ActivationContext* context, const size_t grainSize, const ParallelTask task) {
+    const Tensor* base = context->base;
+
+    if (Tensor_isContiguous(base)) {
+        (void)parallelFor(0, base->dataPoints, grainSize, task, context);
+        return;
+    }
+
+    context->runLength = Tensor_getContiguousLength(base);
+    context->task = task;
+    const size_t runGrainSize = context->runLength >= grainSize ? 1 : grainSize / context->runLength;
+    (void)parallelFor(0, base->dataPoints / context->runLength, runGrainSize, stridedActivationTask, context);
+}
+
+/**
+ * Applies the ReLU function on the elements in the range [from; to).
+ * 
+ * @param from      First element to process.
+ * @param to        End of the elements to process (exclusive).
+ * @param *context  The ActivationContext.
+ */
+static void ReLU_task(const size_t from, const size_t to, void* context) {
+    const ActivationContext* activation = (ActivationContext*)context;
+
+    switch (activation->tensorType) {
     case _TENSOR_TYPE_INTEGER_: {
-        int* start = (int*)data;
-        const int* end = start + base->dataPoints;
+        int* start = (int*)activation->data + from;
+        const int* end = (int*)activation->data + to;
 
         while (start < end) {
             *start = (int)int_max(0, *start);
@@ -47,8 +116,8 @@ void ReLU(void* data, const Tensor* base, const TensorType tensorType) {
         break;
     }
     case _TENSOR_TYPE_FLOAT_: {
-        float* start = (float*)data;
-        const float* end = start + base->dataPoints;
+        float* start = (float*)activation->data + from;
+        const float* end = (float*)activation->data + to;
 
         while (start < end) {
             *start = (float)float_max(0, *start);
@@ -57,8 +126,8 @@ void ReLU(void* data, const Tensor* base, const TensorType tensorType) {
         break;
     }
     case _TENSOR_TYPE_DOUBLE_: {
-        double* start = (double*)data;
-        const double* end = start + base->dataPoints;
+        double* start = (double*)activation->data + from;
+        const double* end = (double*)activation->data + to;
 
         while (start < end) {
             *start = (double)double_max(0, *start);
@@ -69,6 +138,19 @@ void ReLU(void* data, const Tensor* base, const TensorType tensorType) {
     }
 }
 
+/**
+ * Calculates the ReLU of a given data tensor and sets the results back
+ * into the data tensor.
+ * 
+ * <p><b>Definition:</b><br>
+ * ReLU(x) = `0` when `x <= 0`, but `x` when `x > 0`.
+ * </p>
+ */
+void ReLU(void* data, const Tensor* base, const TensorType tensorType) {
+    ActivationContext context = {data, 0, tensorType, base, 0, NULL};
+    (void)executeActivation(&context, ACTIVATION_GRAIN_SIZE, ReLU_task);
+}
+
 /**
  * Calculates the ReLU activation function values for each
  * element of the given tensor and sets the element to the
@@ -103,45 +185,45 @@ void DoubleTensor_ReLU(DoubleTensor* tensor) {
 }
 
 /**
- * Calculates the Leaky ReLU of a given data tensor and sets the results back
- * into the data tensor.
+ * Applies the Leaky ReLU function on the elements in the range [from; to).
  * 
- * <p><b>Definition:</b><br>
- * Leaky_ReLU(x) = `alpha * x` when `x <= 0` or `x` when `x > 0`.
- * </p>
+ * @param from      First element to process.
+ * @param to        End of the elements to process (exclusive).
+ * @param *context  The ActivationContext.
  */
-void Leaky_ReLU(void* data, const double alpha, const Tensor* base,
-    const TensorType tensorType) {
-    switch (tensorType) {
+static void Leaky_ReLU_task(const size_t from, const size_t to, void* context) {
+    const ActivationContext* activation = (ActivationContext*)context;
+
+    switch (activation->tensorType) {
     case _TENSOR_TYPE_INTEGER_: {
-        int* start = (int*)data;
-        const int* end = start + base->dataPoints;
+        int* start = (int*)activation->data + from;
+        const int* end = (int*)activation->data + to;
 
         while (start < end) {
             const int max = (int)int_max(0, *start);
-            *start = max == 0 ? alpha * *start : max;
+            *start = max == 0 ? activation->alpha * *start : max;
             start++;
         }
         break;
     }
     case _TENSOR_TYPE_FLOAT_: {
-        float* start = (float*)data;
-        const float* end = start + base->dataPoints;
+        float* start = (float*)activation->data + from;
+        const float* end = (float*)activation->data + to;
 
         while (start < end) {
             const float max = (float)float_max(0, *start);
-            *start = max == 0 ? alpha * *start : max;
+            *start = max == 0 ? activation->alpha * *start : max;
             start++;
         }
         break;
     }
     case _TENSOR_TYPE_DOUBLE_: {
-        double* start = (double*)data;
-        const double* end = start + base->dataPoints;
+        double* start = (double*)activation->data + from;
+        const double* end = (double*)activation->data + to;
 
         while (start < end) {
             const double max = (double)double_max(0, *start);
-            *start = max == 0 ? alpha * *start : max;
+            *start = max == 0 ? activation->alpha * *start : max;
             start++;
         }
         break;
@@ -149,6 +231,20 @@ void Leaky_ReLU(void* data, const double alpha, const Tensor* base,
     }
 }
 
+/**
+ * Calculates the Leaky ReLU of a given data tensor and sets the results back
+ * into the data tensor.
+ * 
+ * <p><b>Definition:</b><br>
+ * Leaky_ReLU(x) = `alpha * x` when `x <= 0` or `x` when `x > 0`.
+ * </p>
+ */
+void Leaky_ReLU(void* data, const double alpha, const Tensor* base,
+    const TensorType tensorType) {
+    ActivationContext context = {data, alpha, tensorType, base, 0, NULL};
+    (void)executeActivation(&context, ACTIVATION_GRAIN_SIZE, Leaky_ReLU_task);
+}
+
 /**
  * Calculates the Leaky ReLU activation function values for each
  * element of the given tensor and sets the element to the
@@ -186,18 +282,19 @@ void DoubleTensor_LeakyReLU(DoubleTensor* tensor, const double alpha) {
 }
 
 /**
- * Calculates the Sigmoid of a given data tensor and sets the results back
- * into the data tensor.
+ * Applies the Sigmoid function on the elements in the range [from; to).
  * 
- * <p><b>Definition:</b><br>
- * Sigmoid(x) = `1.0 / (1.0 + e^-x)`.
- * </p>
+ * @param from      First element to process.
+ * @param to        End of the elements to process (exclusive).
+ * @param *context  The ActivationContext.
  */
-void Sigmoid(void* data, const Tensor* base, const TensorType tensorType) {
-    switch (tensorType) {
+static void Sigmoid_task(const size_t from, const size_t to, void* context) {
+    const ActivationContext* activation = (ActivationContext*)context;
+
+    switch (activation->tensorType) {
     case _TENSOR_TYPE_INTEGER_: {
-        int* start = (int*)data;
-        const int* end = start + base->dataPoints;
+        int* start = (int*)activation->data + from;
+        const int* end = (int*)activation->data + to;
 
         while (start < end) {
             *start = (1.0) / (1.0 + (double)exp(-*start));
@@ -206,8 +303,8 @@ void Sigmoid(void* data, const Tensor* base, const TensorType tensorType) {
         break;
     }
     case _TENSOR_TYPE_FLOAT_: {
-        float* start = (float*)data;
-        const float* end = start + base->dataPoints;
+        float* start = (float*)activation->data + from;
+        const float* end = (float*)activation->data + to;
 
         while (start < end) {
             *start = (1.0) / (1.0 + (double)exp(-*start));
@@ -216,8 +313,8 @@ void Sigmoid(void* data, const Tensor* base, const TensorType tensorType) {
         break;
     }
     case _TENSOR_TYPE_DOUBLE_: {
-        double* start = (double*)data;
-        const double* end = start + base->dataPoints;
+        double* start = (double*)activation->data + from;
+        const double* end = (double*)activation->data + to;
 
         while (start < end) {
             *start = (1.0) / (1.0 + (double)exp(-*start));
@@ -228,6 +325,19 @@ void Sigmoid(void* data, const Tensor* base, const TensorType tensorType) {
     }
 }
 
+/**
+ * Calculates the Sigmoid of a given data tensor and sets the results back
+ * into the data tensor.
+ * 
+ * <p><b>Definition:</b><br>
+ * Sigmoid(x) = `1.0 / (1.0 + e^-x)`.
+ * </p>
+ */
+void Sigmoid(void* data, const Tensor* base, const TensorType tensorType) {
+    ActivationContext context = {data, 0, tensorType, base, 0, NULL};
+    (void)executeActivation(&context, EXPONENTIAL_ACTIVATION_GRAIN_SIZE, Sigmoid_task);
+}
+
 /**
  * Calculates the Sigmoid activation function values for each
  * element of the given tensor and sets the element to the
@@ -262,22 +372,19 @@ void DoubleTensor_Sigmoid(DoubleTensor* tensor) {
 }
 
 /**
- * Calculates the Tanh of a given data tensor and sets the results back
- * into the data tensor.
- * 
- * <p><b>Definition:</b><br>
- * Tanh(x) = `(e^x - e^-x) / (e^x + e^-x)`.
- * 
- * Equal to
+ * Applies the Tanh function on the elements in the range [from; to).
  * 
- * Tanh(x) = `1.0 - (2.0 / (e^2x + 1))`
- * </p>
+ * @param from      First element to process.
+ * @param to        End of the elements to process (exclusive).
+ * @param *context  The ActivationContext.
  */
-void Tanh(void* data, const Tensor* base, const TensorType tensorType) {
-    switch (tensorType) {
+static void Tanh_task(const size_t from, const size_t to, void* context) {
+    const ActivationContext* activation = (ActivationContext*)context;
+
+    switch (activation->tensorType) {
     case _TENSOR_TYPE_INTEGER_: {
-        int* start = (int*)data;
-        const int* end = start + base->dataPoints;
+        int* start = (int*)activation->data + from;
+        const int* end = (int*)activation->data + to;
 
         while (start < end) {
             *start = 1.0 - (2.0 / ((double)exp(2 * *start) + 1.0));
@@ -286,8 +393,8 @@ void Tanh(void* data, const Tensor* base, const TensorType tensorType) {
         break;
     }
     case _TENSOR_TYPE_FLOAT_: {
-        float* start = (float*)data;
-        const float* end = start + base->dataPoints;
+        float* start = (float*)activation->data + from;
+        const float* end = (float*)activation->data + to;
 
         while (start < end) {
             *start = 1.0 - (2.0 / ((double)exp(2 * *start) + 1.0));
@@ -296,8 +403,8 @@ void Tanh(void* data, const Tensor* base, const TensorType tensorType) {
         break;
     }
     case _TENSOR_TYPE_DOUBLE_: {
-        double* start = (double*)data;
-        const double* end = start + base->dataPoints;
+        double* start = (double*)activation->data + from;
+        const double* end = (double*)activation->data + to;
 
         while (start < end) {
             *start = 1.0 - (2.0 / ((double)exp(2 * *start) + 1.0));
@@ -308,6 +415,23 @@ void Tanh(void* data, const Tensor* base, const TensorType tensorType) {
     }
 }
 
+/**
+ * Calculates the Tanh of a given data tensor and sets the results back
+ * into the data tensor.
+ * 
+ * <p><b>Definition:</b><br>
+ * Tanh(x) = `(e^x - e^-x) / (e^x + e^-x)`.
+ * 
+ * Equal to
+ * 
+ * Tanh(x) = `1.0 - (2.0 / (e^2x + 1))`
+ * </p>
+ */
+void Tanh(void* data, const Tensor* base, const TensorType tensorType) {
+    ActivationContext context = {data, 0, tensorType, base, 0, NULL};
+    (void)executeActivation(&context, EXPONENTIAL_ACTIVATION_GRAIN_SIZE, Tanh_task);
+}
+
 /**
  * Calculates the Tanh activation function values for each
  * element of the given tensor and sets the element to the
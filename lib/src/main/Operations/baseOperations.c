@@ -22,29 +22,206 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 #include "Tensor/tensor.h"
 #include "Operations/baseOperations.h"
+#include "Operations/simd.h"
+#include "Utils/threadPool.h"
 #include "Error/exceptions.h"
 
-typedef int (*IntegerBinaryOperator)(int, int);
-typedef float (*FloatBinaryOperator)(float, float);
-typedef double (*DoubleBinaryOperator)(double, double);
+/**
+ * Minimum number of elements a thread processes per chunk of an
+ * elementwise operation.
+ */
+#define ELEMENTWISE_GRAIN_SIZE 65536
+
+/**
+ * Parameters of an elementwise operation that is split across threads.
+ */
+typedef struct {
+    const void* a;
+    const void* b;
+    void* destination;
+    double scalar;
+    ElementwiseOperation operation;
+    TensorType tensorType;
+    const Tensor* aBase;
+    const Tensor* bBase;
+    const Tensor* destinationBase;
+    size_t runLength;
+} ElementwiseContext;
 
-int Integer_multiply(int a, int b) {return a * b;}
-int Integer_add(int a, int b) {return a + b;}
-int Integer_subtract(int a, int b) {return a - b;}
-int Integer_divide(int a, int b) {return a / b;}
+/**
+ * Applies the elementwise kernel of the given context on `length` elements
+ * starting at the given offsets of the operands.
+ * 
+ * @param *operation            The ElementwiseContext.
+ * @param aOffset               Offset of the first element in `a`.
+ * @param bOffset               Offset of the first element in `b`.
+ * @param destinationOffset     Offset of the first element in the destination.
+ * @param length                Number of elements to process.
+ */
+static void applyElementwiseKernel(const ElementwiseContext* operation, const size_t aOffset,
+    const size_t bOffset, const size_t destinationOffset, const size_t length) {
+    switch (operation->tensorType) {
+    case _TENSOR_TYPE_INTEGER_: {
+        const Integer_ElementwiseKernel kernel = (Integer_ElementwiseKernel)getIntegerElementwiseKernel(operation->operation);
+        (void)kernel((const int*)operation->a + aOffset, (const int*)operation->b + bOffset,
+            (int*)operation->destination + destinationOffset, length);
+        break;
+    }
+    case _TENSOR_TYPE_FLOAT_: {
+        const Float_ElementwiseKernel kernel = (Float_ElementwiseKernel)getFloatElementwiseKernel(operation->operation);
+        (void)kernel((const float*)operation->a + aOffset, (const float*)operation->b + bOffset,
+            (float*)operation->destination + destinationOffset, length);
+        break;
+    }
+    case _TENSOR_TYPE_DOUBLE_: {
+        const Double_ElementwiseKernel kernel = (Double_ElementwiseKernel)getDoubleElementwiseKernel(operation->operation);
+        (void)kernel((const double*)operation->a + aOffset, (const double*)operation->b + bOffset,
+            (double*)operation->destination + destinationOffset, length);
+        break;
+    }
+    }
+}
+
+/**
+ * Multiplies `length` elements starting at the given offset with the
+ * scalar of the given context.
+ * 
+ * @param *operation            The ElementwiseContext.
+ * @param aOffset               Offset of the first element in `a`.
+ * @param destinationOffset     Offset of the first element in the destination.
+ * @param length                Number of elements to process.
+ */
+static void applyScalarMultiplyKernel(const ElementwiseContext* operation, const size_t aOffset,
+    const size_t destinationOffset, const size_t length) {
+    switch (operation->tensorType) {
+    case _TENSOR_TYPE_INTEGER_: {
+        const Integer_ScalarKernel kernel = (Integer_ScalarKernel)getIntegerScalarMultiplyKernel();
+        (void)kernel((const int*)operation->a + aOffset, (int)operation->scalar,
+            (int*)operation->destination + destinationOffset, length);
+        break;
+    }
+    case _TENSOR_TYPE_FLOAT_: {
+        const Float_ScalarKernel kernel = (Float_ScalarKernel)getFloatScalarMultiplyKernel();
+        (void)kernel((const float*)operation->a + aOffset, (float)operation->scalar,
+            (float*)operation->destination + destinationOffset, length);
+        break;
+    }
+    case _TENSOR_TYPE_DOUBLE_: {
+        const Double_ScalarKernel kernel = (Double_ScalarKernel)getDoubleScalarMultiplyKernel();
+        (void)kernel((const double*)operation->a + aOffset, operation->scalar,
+            (double*)operation->destination + destinationOffset, length);
+        break;
+    }
+    }
+}
+
+/**
+ * Applies the elementwise kernel of the given context on the elements
+ * in the range [start; end).
+ * 
+ * @param start     First element to process.
+ * @param end       End of the elements to process (exclusive).
+ * @param *context  The ElementwiseContext.
+ */
+static void elementwiseTask(const size_t start, const size_t end, void* context) {
+    (void)applyElementwiseKernel((ElementwiseContext*)context, start, start, start, end - start);
+}
+
+/**
+ * Multiplies the elements in the range [start; end) with the scalar
+ * of the given context.
+ * 
+ * @param start     First element to process.
+ * @param end       End of the elements to process (exclusive).
+ * @param *context  The ElementwiseContext.
+ */
+static void scalarMultiplyTask(const size_t start, const size_t end, void* context) {
+    (void)applyScalarMultiplyKernel((ElementwiseContext*)context, start, start, end - start);
+}
+
+/**
+ * Applies the elementwise kernel of the given context on the runs
+ * [from; to) of strided operands.
+ * 
+ * @param from      First run to process.
+ * @param to        End of the runs to process (exclusive).
+ * @param *context  The ElementwiseContext.
+ */
+static void stridedElementwiseTask(const size_t from, const size_t to, void* context) {
+    const ElementwiseContext* operation = (ElementwiseContext*)context;
+
+    for (size_t run = from; run < to; run++) {
+        const size_t index = run * operation->runLength;
+        (void)applyElementwiseKernel(operation,
+            Tensor_getElementOffset(operation->aBase, index),
+            Tensor_getElementOffset(operation->bBase, index),
+            Tensor_getElementOffset(operation->destinationBase, index),
+            operation->runLength);
+    }
+}
+
+/**
+ * Multiplies the runs [from; to) of a strided operand with the scalar
+ * of the given context.
+ * 
+ * @param from      First run to process.
+ * @param to        End of the runs to process (exclusive).
+ * @param *context  The ElementwiseContext.
+ */
+static void stridedScalarMultiplyTask(const size_t from, const size_t to, void* context) {
+    const ElementwiseContext* operation = (ElementwiseContext*)context;
+
+    for (size_t run = from; run < to; run++) {
+        const size_t index = run * operation->runLength;
+        (void)applyScalarMultiplyKernel(operation,
+            Tensor_getElementOffset(operation->aBase, index),
+            Tensor_getElementOffset(operation->destinationBase, index),
+            operation->runLength);
+    }
+}
 
-float Float_multiply(float a, float b) {return a * b;}
-float Float_add(float a, float b) {return a + b;}
-float Float_subtract(float a, float b) {return a - b;}
-float Float_divide(float a, float b) {return a / b;}
+/**
+ * Distributes the given elementwise operation over the threads.
+ * 
+ * <p><b>Functionality:</b><br>
+ * Contiguous operands are processed as one range. If any operand is a
+ * strided view, the elements are split into runs, which are consecutive
+ * in all operands, and the kernel is applied on each run.
+ * </p>
+ * 
+ * @param *context          The ElementwiseContext with the data and bases of the operands.
+ * @param contiguousTask    Task for contiguous operands.
+ * @param stridedTask       Task for runs of strided operands.
+ */
+static void executeElementwise(ElementwiseContext* context,
+    const ParallelTask contiguousTask, const ParallelTask stridedTask) {
+    const Tensor* a = context->aBase;
+    const Tensor* b = context->bBase != NULL ? context->bBase : a;
+    const Tensor* destination = context->destinationBase;
+
+    if (Tensor_isContiguous(a) && Tensor_isContiguous(b) && Tensor_isContiguous(destination)) {
+        (void)parallelFor(0, a->dataPoints, ELEMENTWISE_GRAIN_SIZE, contiguousTask, context);
+        return;
+    } else if (a->dataPoints == 0) {
+        return;
+    }
 
-double Double_multiply(double a, double b) {return a * b;}
-double Double_add(double a, double b) {return a + b;}
-double Double_subtract(double a, double b) {return a - b;}
-double Double_divide(double a, double b) {return a / b;}
+    // The run lengths are products of the innermost dimensions, so the
+    // shortest one divides the others.
+    size_t runLength = Tensor_getContiguousLength(a);
+    const size_t bLength = Tensor_getContiguousLength(b);
+    const size_t destinationLength = Tensor_getContiguousLength(destination);
+    runLength = bLength < runLength ? bLength : runLength;
+    runLength = destinationLength < runLength ? destinationLength : runLength;
+
+    context->runLength = runLength;
+    const size_t grainSize = runLength >= ELEMENTWISE_GRAIN_SIZE ? 1 : ELEMENTWISE_GRAIN_SIZE / runLength;
+    (void)parallelFor(0, a->dataPoints / runLength, grainSize, stridedTask, context);
+}
 
 /**
  * Returns the element index in the given tensors data for
@@ -63,11 +240,9 @@ double Double_divide(double a, double b) {return a / b;}
  */
 int getElementIndex(const Tensor* tensor, const int* indices) {
     int index = 0;
-    int stride = 1;
 
     for (int i = tensor->dimensions - 1; i >= 0; i--) {
-        index += indices[i] * stride;
-        stride *= tensor->shape[i];
+        index += indices[i] * tensor->strides[i];
     }
 
     return index;
@@ -106,33 +281,67 @@ void checkTensorCompatability(const Tensor* a, const Tensor* b, const char *oper
     }
 }
 
+/**
+ * Checks whether an integer division of tensor a by tensor b is undefined
+ * for any element, which is a division by zero or `INT_MIN / -1`.
+ * 
+ * @param *a    The dividend tensor.
+ * @param *b    The divisor tensor.
+ * 
+ * @return `1` when any element can't be divided, `0` otherwise.
+ */
+static int hasUndefinedIntegerDivision(const IntegerTensor* a, const IntegerTensor* b) {
+    const int contiguous = Tensor_isContiguous(a->base) && Tensor_isContiguous(b->base);
+
+    for (size_t i = 0; i < b->base->dataPoints; i++) {
+        const int divisor = b->data[contiguous ? i : Tensor_getElementOffset(b->base, i)];
+        const int dividend = a->data[contiguous ? i : Tensor_getElementOffset(a->base, i)];
+
+        if (divisor == 0 || (divisor == -1 && dividend == INT_MIN)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 /**
  * Executes the given operations between tensor a and b and writes the results
  * to the destination tensor.
  * 
  * <p><b>Important:</b><br>
  * This function only allows operations between two identically
- * shaped tensors.
+ * shaped tensors. All tensors can be strided views.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * Integer divisions by zero and `INT_MIN / -1` are rejected before any
+ * kernel runs, so the result does not depend on whether an element lands
+ * in a vector lane or in the scalar tail. The destination is left unchanged.
  * </p>
  * 
  * @param *a            Tensor to apply operation.
  * @param *b            Tensor to apply operation.
  * @param *destination  Tensor to write to.
  * @param operation     The operation to execute.
+ * 
+ * @throws IllegalArgumentException - When an integer division is undefined for any element.
+ * 
+ * @see "Operations/simd.h" for the vectorized kernels.
  */
 void IntegerTensor_operate(const IntegerTensor* a, const IntegerTensor* b,
-    const IntegerTensor* destination, const IntegerBinaryOperator operation) {
+    const IntegerTensor* destination, const ElementwiseOperation operation) {
     (void)checkTensorCompatability(a->base, b->base, "binary operation");
     (void)checkTensorCompatability(a->base, destination->base, "binary operation");
 
-    const int* data_a = a->data;
-    const int* data_b = b->data;
-    int* dest = destination->data;
-    const int* endPtr = data_a + a->base->dataPoints;
-
-    while (data_a < endPtr) {
-        *dest++ = operation((*data_a++), (*data_b++));
+    if (operation == ELEMENTWISE_DIVIDE && hasUndefinedIntegerDivision(a, b)) {
+        (void)throwIllegalArgumentException("Integer division by zero or overflow (INT_MIN / -1)!");
+        return;
     }
+
+    ElementwiseContext context = {a->data, b->data, destination->data, 0, operation, _TENSOR_TYPE_INTEGER_,
+        a->base, b->base, destination->base, 0};
+    (void)executeElementwise(&context, elementwiseTask, stridedElementwiseTask);
 }
 
 /**
@@ -141,27 +350,24 @@ void IntegerTensor_operate(const IntegerTensor* a, const IntegerTensor* b,
  * 
  * <p><b>Important:</b><br>
  * This function only allows operations between two identically
- * shaped tensors.
+ * shaped tensors. All tensors can be strided views.
  * </p>
  * 
  * @param *a            Tensor to apply operation.
  * @param *b            Tensor to apply operation.
  * @param *destination  Tensor to write to.
  * @param operation     The operation to execute.
+ * 
+ * @see "Operations/simd.h" for the vectorized kernels.
  */
 void FloatTensor_operate(const FloatTensor* a, const FloatTensor* b,
-    const FloatTensor* destination, const FloatBinaryOperator operation) {
+    const FloatTensor* destination, const ElementwiseOperation operation) {
     (void)checkTensorCompatability(a->base, b->base, "binary operation");
     (void)checkTensorCompatability(a->base, destination->base, "binary operation");
 
-    const float* data_a = a->data;
-    const float* data_b = b->data;
-    float* dest = destination->data;
-    const float* endPtr = data_a + a->base->dataPoints;
-
-    while (data_a < endPtr) {
-        *dest++ = operation((*data_a++), (*data_b++));
-    }
+    ElementwiseContext context = {a->data, b->data, destination->data, 0, operation, _TENSOR_TYPE_FLOAT_,
+        a->base, b->base, destination->base, 0};
+    (void)executeElementwise(&context, elementwiseTask, stridedElementwiseTask);
 }
 
 /**
@@ -170,27 +376,24 @@ void FloatTensor_operate(const FloatTensor* a, const FloatTensor* b,
  * 
  * <p><b>Important:</b><br>
  * This function only allows operations between two identically
- * shaped tensors.
+ * shaped tensors. All tensors can be strided views.
  * </p>
  * 
  * @param *a            Tensor to apply operation.
  * @param *b            Tensor to apply operation.
  * @param *destination  Tensor to write to.
  * @param operation     The operation to execute.
+ * 
+ * @see "Operations/simd.h" for the vectorized kernels.
  */
 void DoubleTensor_operate(const DoubleTensor* a, const DoubleTensor* b,
-    const DoubleTensor* destination, const DoubleBinaryOperator operation) {
+    const DoubleTensor* destination, const ElementwiseOperation operation) {
     (void)checkTensorCompatability(a->base, b->base, "binary operation");
     (void)checkTensorCompatability(a->base, destination->base, "binary operation");
 
-    const double* data_a = a->data;
-    const double* data_b = b->data;
-    double* dest = destination->data;
-    const double* endPtr = data_a + a->base->dataPoints;
-
-    while (data_a < endPtr) {
-        *dest++ = operation((*data_a++), (*data_b++));
-    }
+    ElementwiseContext context = {a->data, b->data, destination->data, 0, operation, _TENSOR_TYPE_DOUBLE_,
+        a->base, b->base, destination->base, 0};
+    (void)executeElementwise(&context, elementwiseTask, stridedElementwiseTask);
 }
 
 /**
@@ -208,7 +411,7 @@ void DoubleTensor_operate(const DoubleTensor* a, const DoubleTensor* b,
  */
 void IntegerTensor_multiply(const IntegerTensor* a, const IntegerTensor* b,
     const IntegerTensor* destination) {
-    (void)IntegerTensor_operate(a, b, destination, Integer_multiply);
+    (void)IntegerTensor_operate(a, b, destination, ELEMENTWISE_MULTIPLY);
 }
 
 /**
@@ -226,7 +429,7 @@ void IntegerTensor_multiply(const IntegerTensor* a, const IntegerTensor* b,
  */
 void IntegerTensor_divide(const IntegerTensor* a, const IntegerTensor* b,
     const IntegerTensor* destination) {
-    (void)IntegerTensor_operate(a, b, destination, Integer_divide);
+    (void)IntegerTensor_operate(a, b, destination, ELEMENTWISE_DIVIDE);
 }
 
 /**
@@ -244,7 +447,7 @@ void IntegerTensor_divide(const IntegerTensor* a, const IntegerTensor* b,
  */
 void IntegerTensor_add(const IntegerTensor* a, const IntegerTensor* b,
     const IntegerTensor* destination) {
-    (void)IntegerTensor_operate(a, b, destination, Integer_add);
+    (void)IntegerTensor_operate(a, b, destination, ELEMENTWISE_ADD);
 }
 
 /**
@@ -262,7 +465,7 @@ void IntegerTensor_add(const IntegerTensor* a, const IntegerTensor* b,
  */
 void IntegerTensor_subtract(const IntegerTensor* a, const IntegerTensor* b,
     const IntegerTensor* destination) {
-    (void)IntegerTensor_operate(a, b, destination, Integer_subtract);
+    (void)IntegerTensor_operate(a, b, destination, ELEMENTWISE_SUBTRACT);
 }
 
 /**
@@ -277,13 +480,9 @@ void IntegerTensor_scalarMultiply(const IntegerTensor* a, const int scalar,
     const IntegerTensor* destination) {
     (void)checkTensorCompatability(a->base, destination->base, "scalar multiply");
 
-    const int* data_a = a->data;
-    int* dest = destination->data;
-    const int* endPtr = data_a + a->base->dataPoints;
-
-    while (data_a < endPtr) {
-        *dest++ = scalar * (*data_a++);
-    }
+    ElementwiseContext context = {a->data, NULL, destination->data, scalar, ELEMENTWISE_MULTIPLY, _TENSOR_TYPE_INTEGER_,
+        a->base, NULL, destination->base, 0};
+    (void)executeElementwise(&context, scalarMultiplyTask, stridedScalarMultiplyTask);
 }
 
 /**
@@ -301,7 +500,7 @@ void IntegerTensor_scalarMultiply(const IntegerTensor* a, const int scalar,
  */
 void FloatTensor_multiply(const FloatTensor* a, const FloatTensor* b,
     const FloatTensor* destination) {
-    (void)FloatTensor_operate(a, b, destination, Float_multiply);
+    (void)FloatTensor_operate(a, b, destination, ELEMENTWISE_MULTIPLY);
 }
 
 /**
@@ -319,7 +518,7 @@ void FloatTensor_multiply(const FloatTensor* a, const FloatTensor* b,
  */
 void FloatTensor_divide(const FloatTensor* a, const FloatTensor* b,
     const FloatTensor* destination) {
-    (void)FloatTensor_operate(a, b, destination, Float_divide);
+    (void)FloatTensor_operate(a, b, destination, ELEMENTWISE_DIVIDE);
 }
 
 /**
@@ -337,7 +536,7 @@ void FloatTensor_divide(const FloatTensor* a, const FloatTensor* b,
  */
 void FloatTensor_add(const FloatTensor* a, const FloatTensor* b,
     const FloatTensor* destination) {
-    (void)FloatTensor_operate(a, b, destination, Float_add);
+    (void)FloatTensor_operate(a, b, destination, ELEMENTWISE_ADD);
 }
 
 /**
@@ -355,7 +554,7 @@ void FloatTensor_add(const FloatTensor* a, const FloatTensor* b,
  */
 void FloatTensor_subtract(const FloatTensor* a, const FloatTensor* b,
     const FloatTensor* destination) {
-    (void)FloatTensor_operate(a, b, destination, Float_subtract);
+    (void)FloatTensor_operate(a, b, destination, ELEMENTWISE_SUBTRACT);
 }
 
 /**
@@ -370,13 +569,9 @@ void FloatTensor_scalarMultiply(const FloatTensor* a, const float scalar,
     const FloatTensor* destination) {
     (void)checkTensorCompatability(a->base, destination->base, "scalar multiply");
 
-    const float* data_a = a->data;
-    float* dest = destination->data;
-    const float* endPtr = data_a + a->base->dataPoints;
-
-    while (data_a < endPtr) {
-        *dest++ = scalar * (*data_a++);
-    }
+    ElementwiseContext context = {a->data, NULL, destination->data, scalar, ELEMENTWISE_MULTIPLY, _TENSOR_TYPE_FLOAT_,
+        a->base, NULL, destination->base, 0};
+    (void)executeElementwise(&context, scalarMultiplyTask, stridedScalarMultiplyTask);
 }
 
 /**
@@ -394,7 +589,7 @@ void FloatTensor_scalarMultiply(const FloatTensor* a, const float scalar,
  */
 void DoubleTensor_multiply(const DoubleTensor* a, const DoubleTensor* b,
     const DoubleTensor* destination) {
-    (void)DoubleTensor_operate(a, b, destination, Double_multiply);
+    (void)DoubleTensor_operate(a, b, destination, ELEMENTWISE_MULTIPLY);
 }
 
 /**
@@ -412,7 +607,7 @@ void DoubleTensor_multiply(const DoubleTensor* a, const DoubleTensor* b,
  */
 void DoubleTensor_divide(const DoubleTensor* a, const DoubleTensor* b,
     const DoubleTensor* destination) {
-    (void)DoubleTensor_operate(a, b, destination, Double_divide);
+    (void)DoubleTensor_operate(a, b, destination, ELEMENTWISE_DIVIDE);
 }
 
 /**
@@ -430,7 +625,7 @@ void DoubleTensor_divide(const DoubleTensor* a, const DoubleTensor* b,
  */
 void DoubleTensor_add(const DoubleTensor* a, const DoubleTensor* b,
     const DoubleTensor* destination) {
-    (void)DoubleTensor_operate(a, b, destination, Double_add);
+    (void)DoubleTensor_operate(a, b, destination, ELEMENTWISE_ADD);
 }
 
 /**
@@ -448,7 +643,7 @@ void DoubleTensor_add(const DoubleTensor* a, const DoubleTensor* b,
  */
 void DoubleTensor_subtract(const DoubleTensor* a, const DoubleTensor* b,
     const DoubleTensor* destination) {
-    (void)DoubleTensor_operate(a, b, destination, Double_subtract);
+    (void)DoubleTensor_operate(a, b, destination, ELEMENTWISE_SUBTRACT);
 }
 
 /**
@@ -463,11 +658,7 @@ void DoubleTensor_scalarMultiply(const DoubleTensor* a, const double scalar,
     const DoubleTensor* destination) {
     (void)checkTensorCompatability(a->base, destination->base, "scalar multiply");
 
-    const double* data_a = a->data;
-    double* dest = destination->data;
-    const double* endPtr = data_a + a->base->dataPoints;
-
-    while (data_a < endPtr) {
-        *dest++ = scalar * (*data_a++);
-    }
+    ElementwiseContext context = {a->data, NULL, destination->data, scalar, ELEMENTWISE_MULTIPLY, _TENSOR_TYPE_DOUBLE_,
+        a->base, NULL, destination->base, 0};
+    (void)executeElementwise(&context, scalarMultiplyTask, stridedScalarMultiplyTask);
 }
\ No newline at end of file
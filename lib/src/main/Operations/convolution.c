@@ -20,464 +20,2735 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 #include "Error/exceptions.h"
 #include "Tensor/tensor.h"
+#include "Tensor/view.h"
 #include "Operations/convolution.h"
+#include "Operations/Convolution/engine.h"
 #include "Network/layer.h"
+#include "Utils/threadPool.h"
 
 #define true 1
 #define false 0
 
 /**
- * Calculates the dot product of a 1D stripe in a tensor with the given
- * kernel. This function will always use the last dimension as the measurement
- * of the "width" of the tensor and kernel.
+ * Minimum number of outputs, from which on the automatic engine
+ * selection uses the Winograd engine.
+ */
+#define CONVOLUTION_WINOGRAD_MIN_OUTPUTS 256
+
+/**
+ * Maximum number of 3x3 kernel slices, up to which the automatic engine
+ * selection prefers the Winograd engine over the GEMM.
+ */
+#define CONVOLUTION_WINOGRAD_MAX_SLICES 8
+
+/**
+ * Minimum number of kernel taps, from which on the automatic engine
+ * selection convolves FLOAT and DOUBLE tensors by FFTs.
+ */
+#define CONVOLUTION_FFT_MIN_TAPS 128
+
+/**
+ * Minimum ratio of the taps of a kernel to the taps of its 1D factors, from
+ * which on the automatic engine selection convolves a decomposed kernel by
+ * successive 1D passes.
+ */
+#define CONVOLUTION_SEPARABLE_MIN_RATIO 2
+
+/**
+ * Minimum sum of the kernel sizes of all dimensions, from which on the
+ * automatic engine selection answers constant kernels from a summed-area
+ * table instead of 1D passes.
+ */
+#define CONVOLUTION_BOX_MIN_SIZES 32
+
+/**
+ * Number of measured runs of every engine, when a problem is tuned. The
+ * fastest run counts, the first one pays for cold caches.
+ */
+#define CONVOLUTION_TUNING_RUNS 3
+
+/**
+ * Factor of the fastest time so far, from which on an engine is not measured
+ * again while tuning, since it cannot catch up.
+ */
+#define CONVOLUTION_TUNING_CUTOFF 2.0
+
+/**
+ * Edge length of the tiles in every dimension, in which changes between two
+ * inputs are detected by an incremental convolution.
+ */
+#define CONVOLUTION_CHANGE_TILE 32
+
+/**
+ * Calculates the taps of the 1D kernels of a rank-1 kernel, which is the
+ * sum of its sizes.
+ * 
+ * @param *kernelBase   The kernel.
+ * 
+ * @return The taps of all 1D kernels.
+ */
+static size_t getSeparableTaps(const Tensor* kernelBase) {
+    size_t separableTaps = 0;
+
+    for (int dim = 0; dim < kernelBase->dimensions; dim++) {
+        separableTaps += kernelBase->shape[dim];
+    }
+
+    return separableTaps;
+}
+
+/**
+ * Checks whether 1D passes with the factors of a kernel would save enough
+ * taps, when the kernel is rank-1.
+ * 
+ * @param *kernelBase   The kernel.
+ * 
+ * @return `true` when a decomposition pays off.
+ */
+static int isSeparationProfitable(const Tensor* kernelBase) {
+    return kernelBase->dataPoints >= CONVOLUTION_SEPARABLE_MIN_RATIO * getSeparableTaps(kernelBase);
+}
+
+/**
+ * Chooses the engine for a convolution with `CONVOLUTION_ALGORITHM_AUTO`.
+ * <p><b>Note:</b><br>
+ * 3x3 kernels with few slices use the Winograd engine, with many slices the
+ * per-slice input transforms cost more than the direct walker. Large FLOAT
+ * and DOUBLE kernels are convolved by FFTs, whose cost barely grows with the
+ * kernel size. With a single filter the GEMM is not faster than the
+ * vectorized direct walker, so it is only used on request. Padded
+ * convolutions always use the direct walker, whose border path reads the
+ * padding virtually. Common small kernels (1D 3/5/7, 2D 1x1 to 7x7) also
+ * use the direct walker, which has fully unrolled kernels for them.
+ * Decomposed kernels are convolved by 1D passes, when these save enough
+ * taps to pay for the intermediates. Large constant kernels without
+ * mirrored padding are answered from a summed-area table, whose cost does
+ * not grow with the kernel size at all, but building the table costs more
+ * than the 1D passes of small kernels. Per-dimension strides and dilated
+ * kernels always use the direct walker.</p>
+ * 
+ * @param *problem      The validated convolution.
+ * @param *separable    Optional decomposition of the kernel.
+ * 
+ * @return The engine to use.
+ */
+static ConvolutionAlgorithm chooseConvolutionAlgorithm(const ConvolutionProblem* problem,
+    const SeparableKernel* separable) {
+    if (problem->stride > 0 && getSeparableTaps(problem->kernelBase) >= CONVOLUTION_BOX_MIN_SIZES
+        && (problem->padding == CONVOLUTION_PADDING_VALID || problem->padding == CONVOLUTION_PADDING_ZERO)
+        && isConstantKernel(problem->kernel, problem->tensorType)) {
+        return CONVOLUTION_ALGORITHM_BOX;
+    } else if (problem->stride > 0 && separable != NULL && isSeparationProfitable(problem->kernelBase)) {
+        return CONVOLUTION_ALGORITHM_SEPARABLE;
+    } else if (problem->padding != CONVOLUTION_PADDING_VALID || isDirectFixedKernel(problem->kernelBase)) {
+        return CONVOLUTION_ALGORITHM_DIRECT;
+    } else if (problem->outputs >= CONVOLUTION_WINOGRAD_MIN_OUTPUTS
+        && isWinogradApplicable(problem->kernelBase, problem->tensorType, problem->stride)
+        && problem->kernelBase->dataPoints / 9 <= CONVOLUTION_WINOGRAD_MAX_SLICES) {
+        return CONVOLUTION_ALGORITHM_WINOGRAD;
+    } else if (problem->stride == 1 && isFftApplicable(problem->tensorType)
+        && problem->kernelBase->dataPoints >= CONVOLUTION_FFT_MIN_TAPS) {
+        return CONVOLUTION_ALGORITHM_FFT;
+    }
+
+    return CONVOLUTION_ALGORITHM_DIRECT;
+}
+
+/**
+ * Checks whether an engine can execute the given convolution.
+ * 
+ * @param *problem      The validated convolution.
+ * @param algorithm     The engine.
+ * @param *separable    Optional decomposition of the kernel.
+ * 
+ * @return `true` when the engine supports the problem.
+ */
+static int isAlgorithmApplicable(const ConvolutionProblem* problem, const ConvolutionAlgorithm algorithm,
+    const SeparableKernel* separable) {
+    switch (algorithm) {
+    case CONVOLUTION_ALGORITHM_DIRECT:
+    case CONVOLUTION_ALGORITHM_GEMM:
+        return true;
+    case CONVOLUTION_ALGORITHM_WINOGRAD:
+        return problem->padding == CONVOLUTION_PADDING_VALID
+            && isWinogradApplicable(problem->kernelBase, problem->tensorType, problem->stride);
+    case CONVOLUTION_ALGORITHM_FFT:
+        return problem->stride > 0 && problem->padding == CONVOLUTION_PADDING_VALID
+            && isFftApplicable(problem->tensorType);
+    case CONVOLUTION_ALGORITHM_SEPARABLE:
+        return problem->stride > 0 && separable != NULL;
+    case CONVOLUTION_ALGORITHM_BOX:
+        return problem->stride > 0 && (problem->padding == CONVOLUTION_PADDING_VALID || problem->padding == CONVOLUTION_PADDING_ZERO)
+            && isConstantKernel(problem->kernel, problem->tensorType);
+    default:
+        return false;
+    }
+}
+
+/**
+ * Returns the settings of a convolution with the given stride, that
+ * chooses the engine automatically.
+ * 
+ * @param stride    Stride of the kernel.
+ * 
+ * @return The settings.
+ */
+ConvolutionSettings getDefaultConvolutionSettings(const int stride) {
+    const ConvolutionSettings settings = {stride, CONVOLUTION_ALGORITHM_AUTO, CONVOLUTION_PADDING_VALID, 0, NULL, NULL};
+    return settings;
+}
+
+/**
+ * Returns the settings of a padded convolution with the given stride, that
+ * chooses the engine automatically.
+ * 
+ * @param stride        Stride of the kernel.
+ * @param padding       Values, that are read outside of the tensor.
+ * @param paddingSize   Padded elements before and after every dimension or `CONVOLUTION_PADDING_SAME`.
+ * 
+ * @return The settings.
+ */
+ConvolutionSettings getPaddedConvolutionSettings(const int stride,
+    const ConvolutionPadding padding, const int paddingSize) {
+    const ConvolutionSettings settings = {stride, CONVOLUTION_ALGORITHM_AUTO, padding, paddingSize, NULL, NULL};
+    return settings;
+}
+
+/**
+ * Returns the settings of a convolution with a stride and a dilation per
+ * dimension, that chooses the engine automatically.
+ * 
+ * <p><b>Note:</b><br>
+ * The arrays are not copied, they must outlive the settings. A dilated
+ * kernel reads its taps `dilations[dim]` elements apart, so it covers
+ * `(size - 1) * dilation + 1` elements of the tensor.
+ * </p>
+ * 
+ * @param *strides      Stride of every dimension of the kernel or `NULL` for `1`.
+ * @param *dilations    Dilation of every dimension of the kernel or `NULL` for `1`.
+ * @param padding       Values, that are read outside of the tensor.
+ * @param paddingSize   Padded elements before and after every dimension or `CONVOLUTION_PADDING_SAME`.
+ * 
+ * @return The settings.
+ */
+ConvolutionSettings getDilatedConvolutionSettings(const int* strides, const int* dilations,
+    const ConvolutionPadding padding, const int paddingSize) {
+    const ConvolutionSettings settings = {1, CONVOLUTION_ALGORITHM_AUTO, padding, paddingSize, strides, dilations};
+    return settings;
+}
+
+/**
+ * Returns the stride of a dimension of the kernel.
+ * 
+ * @param *settings     Settings of the convolution.
+ * @param dim           Dimension of the kernel.
+ * 
+ * @return The stride.
+ */
+static int getSettingsStride(const ConvolutionSettings* settings, const int dim) {
+    return settings->strides != NULL ? settings->strides[dim] : settings->stride;
+}
+
+/**
+ * Returns the dilation of a dimension of the kernel.
+ * 
+ * @param *settings     Settings of the convolution.
+ * @param dim           Dimension of the kernel.
+ * 
+ * @return The dilation.
+ */
+static int getSettingsDilation(const ConvolutionSettings* settings, const int dim) {
+    return settings->dilations != NULL ? settings->dilations[dim] : 1;
+}
+
+/**
+ * Returns the stride shared by all dimensions of a convolution.
+ * 
+ * @param *strides      Stride of every dimension.
+ * @param *dilations    Dilation of every dimension.
+ * @param first         First dimension to check, the leading ones are spanned by the kernel.
+ * @param dims          Number of dimensions.
+ * 
+ * @return The stride or `0`, when the strides differ or a dimension is dilated.
+ */
+static int getUniformStride(const int* strides, const int* dilations, const int first, const int dims) {
+    int stride = first < dims ? strides[first] : 1;
+
+    for (int dim = first; dim < dims; dim++) {
+        stride = strides[dim] == stride && dilations[dim] == 1 ? stride : 0;
+    }
+
+    return stride;
+}
+
+/**
+ * Calculates the number of outputs of a dimension and the number of
+ * padded elements before it.
+ * 
+ * @param size          Size of the tensor in the dimension.
+ * @param kernelSize    Size of the kernel in the dimension.
+ * @param stride        Stride of the kernel.
+ * @param padding       Padding of the convolution.
+ * @param paddingSize   Padded elements before and after the dimension or `CONVOLUTION_PADDING_SAME`.
+ * @param *before       Pointer to write the number of padded elements before the dimension to.
+ * 
+ * @return The number of outputs.
+ */
+static int computeConvolutionOutputSize(const int size, const int kernelSize, const int stride,
+    const ConvolutionPadding padding, const int paddingSize, int* before) {
+    *before = 0;
+
+    if (padding == CONVOLUTION_PADDING_VALID) {
+        return size < kernelSize ? 0 : (size - kernelSize) / stride + 1;
+    } else if (paddingSize == CONVOLUTION_PADDING_SAME) {
+        const int outputs = (size + stride - 1) / stride;
+        const int total = (outputs - 1) * stride + kernelSize - size;
+        *before = total > 0 ? total / 2 : 0;
+        return outputs;
+    }
+
+    *before = paddingSize;
+    const int paddedSize = size + 2 * paddingSize;
+    return paddedSize < kernelSize ? 0 : (paddedSize - kernelSize) / stride + 1;
+}
+
+/**
+ * Validates a convolution and calculates its output shape, the padding
+ * before every dimension and the stride and dilation of every dimension.
+ * 
+ * @param *tensorBase   Base of the tensor to convolve.
+ * @param *kernelBase   Base of the kernel.
+ * @param *destBase     Base of the destination.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param channelDims   Number of leading dimensions, that the kernel spans completely.
+ *                      They are never padded, strided or dilated and have a single output.
+ * @param *outputs      Pointer to write the number of outputs to.
+ * @param *padding      Pointer to write the padding to, that is `CONVOLUTION_PADDING_VALID`
+ *                      when no kernel reaches outside of the tensor.
+ * 
+ * @return The output shape followed by the padding before, the stride and
+ * the dilation of every dimension (must be freed) or `NULL` when the
+ * convolution is invalid.
+ * 
+ * @throw IllegalArgumentException - When a stride is not a positive integer.
+ * @throw IllegalArgumentException - When a dilation is not a positive integer.
+ * @throw IllegalArgumentException - When the padding size is negative.
+ * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
+ * @throw IllegalArgumentException - When the destination size at the dimension is to small.
+ * @throw IllegalArgumentException - When the destination is not contiguous.
+ */
+static int* prepareConvolution(const Tensor* tensorBase, const Tensor* kernelBase, const Tensor* destBase,
+    const ConvolutionSettings* settings, const int channelDims, size_t* outputs, ConvolutionPadding* padding) {
+    if (settings->padding != CONVOLUTION_PADDING_VALID && settings->paddingSize < 0
+        && settings->paddingSize != CONVOLUTION_PADDING_SAME) {
+        (void)throwIllegalArgumentException("Padding size must not be negative.");
+        return NULL;
+    } else if (tensorBase->dimensions != kernelBase->dimensions) {
+        (void)throwIllegalArgumentException("Convolution is only allowed for equal dimensional tensors.");
+        return NULL;
+    } else if (Tensor_isContiguous(destBase) == false) {
+        (void)throwIllegalArgumentException("The destination of a convolution must be contiguous.");
+        return NULL;
+    }
+
+    int* outputShape = (int*)calloc(4 * tensorBase->dimensions, sizeof(int));
+
+    if (outputShape == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the output shape (convolution).");
+        return NULL;
+    }
+
+    int* paddingBefore = outputShape + tensorBase->dimensions;
+    int* strides = outputShape + 2 * tensorBase->dimensions;
+    int* dilations = outputShape + 3 * tensorBase->dimensions;
+    *padding = CONVOLUTION_PADDING_VALID;
+    *outputs = 1;
+
+    for (int i = 0; i < tensorBase->dimensions; i++) {
+        const int t_size = tensorBase->shape[i];
+        // The filters span the channel dimensions, which are neither strided nor dilated.
+        const int stride = i < channelDims ? 1 : getSettingsStride(settings, i);
+        strides[i] = stride;
+        dilations[i] = i < channelDims ? 1 : getSettingsDilation(settings, i);
+
+        if (stride <= 0) {
+            (void)free(outputShape);
+            (void)throwIllegalArgumentException("Stride must be a positive integer.");
+            return NULL;
+        } else if (dilations[i] <= 0) {
+            (void)free(outputShape);
+            (void)throwIllegalArgumentException("Dilation must be a positive integer.");
+            return NULL;
+        }
+
+        // A dilated kernel covers its taps and the gaps between them.
+        const int k_size = (kernelBase->shape[i] - 1) * dilations[i] + 1;
+
+        if (i < channelDims) {
+            if (t_size != k_size) {
+                (void)free(outputShape);
+                (void)throwIllegalArgumentException("The filters must span all channels of the tensor.");
+                return NULL;
+            }
+
+            outputShape[i] = 1;
+            continue;
+        }
+
+        outputShape[i] = computeConvolutionOutputSize(t_size, k_size, stride,
+                            settings->padding, settings->paddingSize, &paddingBefore[i]);
+        *outputs *= outputShape[i];
+
+        // Only keep the padding, when a kernel actually reaches outside of the tensor.
+        if (outputShape[i] > 0 && (paddingBefore[i] > 0
+            || (outputShape[i] - 1) * stride - paddingBefore[i] + k_size > t_size)) {
+            *padding = settings->padding;
+        }
+
+        if (destBase->shape[i] < outputShape[i]) {
+            (void)free(outputShape);
+            (void)throwIllegalArgumentException("The destination tensor is smaller than allowed!");
+            return NULL;
+        }
+    }
+
+    return outputShape;
+}
+
+/**
+ * Frames of a convolution and the engine, that convolves each of them. All
+ * frames of a batch share the output shape, the padding and the prepared
+ * kernel, only the tensor and the destination differ.
+ */
+typedef struct {
+    ConvolutionProblem problem;
+    ConvolutionAlgorithm algorithm;
+    const WinogradKernel* winograd;
+    const SeparableKernel* separable;
+    const void* weights;
+    int filters;
+    int depthwise;
+    const void* tensor;
+    const void* dest;
+    int frames;
+} ConvolutionBatch;
+
+/**
+ * Creates the view of one frame of a batch, which is one index of its
+ * leading dimension.
+ * 
+ * @param *tensor       The batch.
+ * @param frame         Index of the frame.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The view of the frame or `NULL` on failure.
+ */
+static void* createFrameView(const void* tensor, const int frame, const TensorType tensorType) {
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    return createTensorView(tensor, base->dimensions - 1, base->shape + 1, base->strides + 1,
+            (size_t)frame * base->strides[0], tensorType);
+}
+
+/**
+ * Checks whether the tensor is a batch of frames (`N x ...`), which has one
+ * dimension more than a single kernel, and creates the views of its first
+ * frame and of the first frame of the destination.
+ * 
+ * @param *tensor       Tensor to convolve.
+ * @param *dest         Destination of the convolution.
+ * @param kernelDims    Dimensions of a single kernel.
+ * @param tensorType    Type of the tensors.
+ * @param **tensorFrame Pointer to write the first frame of the tensor to, `NULL` without batch.
+ * @param **destFrame   Pointer to write the first frame of the destination to, `NULL` without batch.
+ * 
+ * @return `false` when the batch is invalid or a view could not be created.
+ * 
+ * @throw IllegalArgumentException - When the destination has not a frame for every frame of the tensor.
+ */
+static int createFirstFrames(const void* tensor, const void* dest, const int kernelDims,
+    const TensorType tensorType, void** tensorFrame, void** destFrame) {
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    *tensorFrame = NULL;
+    *destFrame = NULL;
+
+    if (tensorBase->dimensions != kernelDims + 1) {
+        return true;
+    } else if (destBase->dimensions != tensorBase->dimensions || destBase->shape[0] < tensorBase->shape[0]) {
+        (void)throwIllegalArgumentException("The destination must have a frame for every frame of the batch.");
+        return false;
+    }
+
+    *tensorFrame = createFrameView(tensor, 0, tensorType);
+    *destFrame = *tensorFrame == NULL ? NULL : createFrameView(dest, 0, tensorType);
+
+    if (*destFrame == NULL) {
+        if (*tensorFrame != NULL) (void)freeTensorByType(*tensorFrame, tensorType);
+        *tensorFrame = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Executes the engine of the batch on a single problem.
+ * 
+ * @param *problem  The convolution of one frame.
+ * @param *batch    The batch with the engine and the prepared kernel.
+ */
+static void runConvolutionEngine(const ConvolutionProblem* problem, const ConvolutionBatch* batch) {
+    if (batch->depthwise) {
+        (void)convolveDepthwise(problem, batch->weights, batch->filters);
+        return;
+    } else if (batch->weights != NULL) {
+        (void)convolveGemmWithWeights(problem, batch->weights, batch->filters);
+        return;
+    }
+
+    switch (batch->algorithm) {
+    case CONVOLUTION_ALGORITHM_GEMM:
+        (void)convolveGemm(problem);
+        break;
+    case CONVOLUTION_ALGORITHM_FFT:
+        (void)convolveFft(problem);
+        break;
+    case CONVOLUTION_ALGORITHM_SEPARABLE:
+        (void)convolveSeparable(problem, batch->separable);
+        break;
+    case CONVOLUTION_ALGORITHM_BOX:
+        (void)convolveBox(problem);
+        break;
+    case CONVOLUTION_ALGORITHM_WINOGRAD:
+        (void)convolveWinograd(problem, batch->winograd);
+        break;
+    default:
+        (void)convolveDirect(problem);
+        break;
+    }
+}
+
+/**
+ * Convolves the frames [from; to) of a batch.
+ * 
+ * @param from      First frame.
+ * @param to        End of the frames (exclusive).
+ * @param *context  The ConvolutionBatch.
+ */
+static void convolutionFrameTask(const size_t from, const size_t to, void* context) {
+    const ConvolutionBatch* batch = (ConvolutionBatch*)context;
+    const TensorType tensorType = batch->problem.tensorType;
+
+    for (size_t frame = from; frame < to; frame++) {
+        void* tensorFrame = createFrameView(batch->tensor, (int)frame, tensorType);
+        void* destFrame = tensorFrame == NULL ? NULL : createFrameView(batch->dest, (int)frame, tensorType);
+
+        if (destFrame != NULL) {
+            ConvolutionProblem problem = batch->problem;
+            problem.tensor = tensorFrame;
+            problem.tensorBase = (Tensor*)getTensorBaseByType(tensorFrame, tensorType);
+            problem.dest = destFrame;
+            problem.destBase = (Tensor*)getTensorBaseByType(destFrame, tensorType);
+            (void)runConvolutionEngine(&problem, batch);
+            (void)freeTensorByType(destFrame, tensorType);
+        }
+
+        if (tensorFrame != NULL) {
+            (void)freeTensorByType(tensorFrame, tensorType);
+        }
+    }
+}
+
+/**
+ * Executes a prepared convolution on all frames.
+ * 
+ * <p><b>Functionality:</b><br>
+ * A single tensor is convolved by the engine directly. With at least as
+ * many frames as threads, the frames are distributed over the threads and
+ * every engine runs serially on its frame, otherwise the frames are
+ * convolved one after another by the parallel engines.
+ * </p>
+ * 
+ * @param *batch    The prepared convolution.
+ */
+static void runConvolutionBatch(ConvolutionBatch* batch) {
+    if (batch->problem.outputs == 0) {
+        return;
+    } else if (batch->frames == 0) {
+        (void)runConvolutionEngine(&batch->problem, batch);
+    } else if (batch->frames >= ThreadPool_getWorkerCount(getDefaultThreadPool())) {
+        (void)parallelFor(0, batch->frames, 1, convolutionFrameTask, batch);
+    } else {
+        (void)convolutionFrameTask(0, batch->frames, batch);
+    }
+}
+
+/**
+ * Measures the time of a prepared convolution.
+ * 
+ * @param *batch    The prepared convolution.
+ * @param limit     Fastest time of another engine or a negative value.
+ * 
+ * @return The fastest run in seconds.
+ */
+static double measureConvolution(ConvolutionBatch* batch, const double limit) {
+    double fastest = -1.0;
+
+    for (int run = 0; run < CONVOLUTION_TUNING_RUNS; run++) {
+        struct timespec start, end;
+        (void)clock_gettime(CLOCK_MONOTONIC, &start);
+        (void)runConvolutionBatch(batch);
+        (void)clock_gettime(CLOCK_MONOTONIC, &end);
+
+        const double time = (double)(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+        fastest = fastest < 0.0 || time < fastest ? time : fastest;
+
+        if (limit >= 0.0 && fastest > CONVOLUTION_TUNING_CUTOFF * limit) {
+            break;
+        }
+    }
+
+    return fastest;
+}
+
+/**
+ * Chooses the engine for a convolution with `CONVOLUTION_ALGORITHM_TUNED`.
+ * 
+ * <p><b>Functionality:</b><br>
+ * A problem, that was tuned before (or loaded from a file), uses its stored
+ * engine. Otherwise every applicable engine convolves the problem into the
+ * destination a few times and the fastest one is stored. The destination is
+ * overwritten by the actual convolution afterwards.
+ * </p>
+ * 
+ * @param *problem      The validated convolution.
+ * @param *winograd     Optional kernel, that is already transformed for the Winograd engine.
+ * @param *separable    Optional decomposition of the kernel.
+ * 
+ * @return The engine to use.
+ */
+static ConvolutionAlgorithm tuneConvolutionAlgorithm(const ConvolutionProblem* problem,
+    const WinogradKernel* winograd, const SeparableKernel* separable) {
+    const int tuned = getTunedAlgorithm(problem);
+
+    if (tuned >= 0 && isAlgorithmApplicable(problem, (ConvolutionAlgorithm)tuned, separable)) {
+        return (ConvolutionAlgorithm)tuned;
+    } else if (problem->outputs == 0) {
+        return chooseConvolutionAlgorithm(problem, separable);
+    }
+
+    ConvolutionAlgorithm fastest = chooseConvolutionAlgorithm(problem, separable);
+    double fastestTime = -1.0;
+    WinogradKernel* transformed = NULL;
+
+    for (int algorithm = CONVOLUTION_ALGORITHM_DIRECT; algorithm <= CONVOLUTION_ALGORITHM_BOX; algorithm++) {
+        if (isAlgorithmApplicable(problem, (ConvolutionAlgorithm)algorithm, separable) == false) {
+            continue;
+        } else if (algorithm == CONVOLUTION_ALGORITHM_WINOGRAD && winograd == NULL) {
+            transformed = (WinogradKernel*)createWinogradKernel(problem->kernel, problem->tensorType);
+            winograd = transformed;
+
+            if (winograd == NULL) {
+                continue;
+            }
+        }
+
+        ConvolutionBatch batch = {*problem, (ConvolutionAlgorithm)algorithm, winograd, separable,
+            NULL, 0, false, problem->tensor, problem->dest, 0};
+        const double time = measureConvolution(&batch, fastestTime);
+
+        if (fastestTime < 0.0 || time < fastestTime) {
+            fastest = (ConvolutionAlgorithm)algorithm;
+            fastestTime = time;
+        }
+    }
+
+    (void)freeWinogradKernel(transformed);
+    (void)setTunedAlgorithm(problem, fastest);
+    return fastest;
+}
+
+/**
+ * Chooses the engine of a validated convolution and prepares its kernel.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The kernel is decomposed, when the separable engine is requested, tuned
+ * or pays off for `AUTO`. `TUNED` measures the engines, `AUTO` prefers
+ * tuned or loaded choices over the heuristics. An engine, that does not
+ * apply to the problem, falls back to the automatic choice. Finally the
+ * kernel is transformed, when the Winograd engine was chosen.
+ * </p>
+ * 
+ * @param *problem      The validated convolution.
+ * @param requested     The engine of the settings.
+ * @param **winograd    Optional transformed kernel, is set to the created one.
+ * @param **separable   Optional decomposed kernel, is set to the created one.
+ * @param **transformed Pointer to write the created transformed kernel to, which must be freed.
+ * @param **decomposed  Pointer to write the created decomposed kernel to, which must be freed.
+ * 
+ * @return The engine to use.
+ */
+static ConvolutionAlgorithm planConvolution(const ConvolutionProblem* problem, const ConvolutionAlgorithm requested,
+    const WinogradKernel** winograd, const SeparableKernel** separable, WinogradKernel** transformed,
+    SeparableKernel** decomposed) {
+    // Decomposing costs a pass over the kernel, which is negligible against
+    // the convolution, as long as the passes can save enough taps.
+    if (*separable == NULL && problem->outputs > 0 && problem->stride > 0 && (requested == CONVOLUTION_ALGORITHM_SEPARABLE
+        || requested == CONVOLUTION_ALGORITHM_TUNED
+        || (requested == CONVOLUTION_ALGORITHM_AUTO && isSeparationProfitable(problem->kernelBase)))) {
+        *decomposed = (SeparableKernel*)createSeparableKernel(problem->kernel, problem->tensorType);
+        *separable = *decomposed;
+    }
+
+    ConvolutionAlgorithm algorithm = requested;
+
+    if (algorithm == CONVOLUTION_ALGORITHM_TUNED) {
+        algorithm = tuneConvolutionAlgorithm(problem, *winograd, *separable);
+    } else if (algorithm == CONVOLUTION_ALGORITHM_AUTO) {
+        // Tuned or loaded choices take precedence over the heuristics.
+        const int tuned = getTuningTableSize() > 0 ? getTunedAlgorithm(problem) : -1;
+        algorithm = tuned >= 0 ? (ConvolutionAlgorithm)tuned : chooseConvolutionAlgorithm(problem, *separable);
+    }
+
+    if (isAlgorithmApplicable(problem, algorithm, *separable) == false) {
+        algorithm = chooseConvolutionAlgorithm(problem, NULL);
+    }
+
+    if (algorithm == CONVOLUTION_ALGORITHM_WINOGRAD && *winograd == NULL && problem->outputs > 0) {
+        *transformed = (WinogradKernel*)createWinogradKernel(problem->kernel, problem->tensorType);
+        *winograd = *transformed;
+    }
+
+    return algorithm;
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * 
+ * <p><b>Note:</b><br>
+ * The tensor and kernel can be strided views (e.g. one frame of a batch),
+ * they are read through their strides without copying. The padding is
+ * virtual, it is never materialized. A tensor with one dimension more than
+ * the kernel is a batch of frames (`N x ...`), every frame is convolved into
+ * the same frame of the destination. The engine is chosen and the kernel is
+ * prepared once for all frames.
+ * </p>
+ * 
+ * @param *tensor       Tensor or batch to convolve.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination tensor in which to write the results.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param tensorType    Datatype type of the tensor data (INTEGER, FLOAT, DOUBLE)
+ * @param *winograd     Optional kernel, that is already transformed for the Winograd engine.
+ * @param *separable    Optional kernel, that is already decomposed for the separable engine.
+ * 
+ * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ * 
+ * @see #prepareConvolution(const Tensor* tensorBase, const Tensor* kernelBase, const Tensor* destBase,
+    const ConvolutionSettings* settings, const int channelDims, size_t* outputs, ConvolutionPadding* padding)
+ */
+static void executeConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const WinogradKernel* winograd,
+    const SeparableKernel* separable) {
+    if (tensor == NULL || kernel == NULL || dest == NULL || settings == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
+        return;
+    }
+
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    void* tensorFrame = NULL;
+    void* destFrame = NULL;
+
+    if (createFirstFrames(tensor, dest, kernelBase->dimensions, tensorType, &tensorFrame, &destFrame) == false) {
+        return;
+    }
+
+    const void* frame = tensorFrame != NULL ? tensorFrame : tensor;
+    const void* frameDest = destFrame != NULL ? destFrame : dest;
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(frame, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(frameDest, tensorType);
+    size_t outputs = 0;
+    ConvolutionPadding padding = CONVOLUTION_PADDING_VALID;
+    int* outputShape = (int*)prepareConvolution(tensorBase, kernelBase, destBase, settings, 0, &outputs, &padding);
+    SeparableKernel* decomposed = NULL;
+    WinogradKernel* transformed = NULL;
+
+    if (outputShape != NULL) {
+        const int dims = tensorBase->dimensions;
+        const int* strides = outputShape + 2 * dims;
+        const int* dilations = outputShape + 3 * dims;
+        const ConvolutionProblem problem = {frame, kernel, frameDest, tensorBase, kernelBase, destBase,
+            tensorType, getUniformStride(strides, dilations, 0, dims), outputShape, outputs, padding,
+            outputShape + dims, strides, dilations};
+
+        const ConvolutionAlgorithm algorithm = planConvolution(&problem, settings->algorithm,
+                                                &winograd, &separable, &transformed, &decomposed);
+        ConvolutionBatch batch = {problem, algorithm, winograd, separable, NULL, 0, false,
+            tensor, dest, tensorFrame != NULL ? ((Tensor*)getTensorBaseByType(tensor, tensorType))->shape[0] : 0};
+
+        if (algorithm != CONVOLUTION_ALGORITHM_WINOGRAD || winograd != NULL) {
+            (void)runConvolutionBatch(&batch);
+        }
+    }
+
+    if (tensorFrame != NULL) (void)freeTensorByType(tensorFrame, tensorType);
+    if (destFrame != NULL) (void)freeTensorByType(destFrame, tensorType);
+    (void)freeWinogradKernel(transformed);
+    (void)freeSeparableKernel(decomposed);
+    (void)free(outputShape);
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * 
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination tensor in which to write the results.
+ * @param *settings     Stride and engine of the convolution.
+ * @param tensorType    Datatype type of the tensor data (INTEGER, FLOAT, DOUBLE)
+ * 
+ * @see #executeConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const WinogradKernel* winograd,
+    const SeparableKernel* separable)
+ */
+void convolve(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType) {
+    (void)executeConvolution(tensor, kernel, dest, settings, tensorType, NULL, NULL);
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel with
+ * the given settings.
+ * 
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination tensor in which to write the results.
+ * @param *settings     Stride and engine of the convolution.
+ * 
+ * @see #convolve(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void IntegerTensor_convolveWithSettings(const IntegerTensor* tensor,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    (void)convolve(tensor, kernel, dest, settings, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel with
+ * the given settings.
+ * 
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination tensor in which to write the results.
+ * @param *settings     Stride and engine of the convolution.
+ * 
+ * @see #convolve(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void FloatTensor_convolveWithSettings(const FloatTensor* tensor,
+    const FloatTensor* kernel, const FloatTensor* dest, const ConvolutionSettings* settings) {
+    (void)convolve(tensor, kernel, dest, settings, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel with
+ * the given settings.
+ * 
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination tensor in which to write the results.
+ * @param *settings     Stride and engine of the convolution.
+ * 
+ * @see #convolve(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void DoubleTensor_convolveWithSettings(const DoubleTensor* tensor,
+    const DoubleTensor* kernel, const DoubleTensor* dest, const ConvolutionSettings* settings) {
+    (void)convolve(tensor, kernel, dest, settings, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * 
+ * @param *tensor   Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel   Kernel to use.
+ * @param *dest     Destination tensor in which to write the results.
+ * @param stride    Stride of the kernel.
+ * 
+ * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
+ * @throw IllegalArgumentException - When the destination size at the dimension is to small.
+ * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ */
+void IntegerTensor_convolve(const IntegerTensor* tensor,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const int stride) {
+    const ConvolutionSettings settings = getDefaultConvolutionSettings(stride);
+    (void)convolve(tensor, kernel, dest, &settings, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * 
+ * @param *tensor   Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel   Kernel to use.
+ * @param *dest     Destination tensor in which to write the results.
+ * @param stride    Stride of the kernel.
+ * 
+ * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
+ * @throw IllegalArgumentException - When the destination size at the dimension is to small.
+ * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ */
+void FloatTensor_convolve(const FloatTensor* tensor,
+    const FloatTensor* kernel, const FloatTensor* dest, const int stride) {
+    const ConvolutionSettings settings = getDefaultConvolutionSettings(stride);
+    (void)convolve(tensor, kernel, dest, &settings, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * 
+ * @param *tensor   Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel   Kernel to use.
+ * @param *dest     Destination tensor in which to write the results.
+ * @param stride    Stride of the kernel.
+ * 
+ * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
+ * @throw IllegalArgumentException - When the destination size at the dimension is to small.
+ * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ */
+void DoubleTensor_convolve(const DoubleTensor* tensor,
+    const DoubleTensor* kernel, const DoubleTensor* dest, const int stride) {
+    const ConvolutionSettings settings = getDefaultConvolutionSettings(stride);
+    (void)convolve(tensor, kernel, dest, &settings, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Executes a convolution of a tensor with every filter of a filter bank.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The filters span the leading (channel) dimension of the tensor, so every
+ * filter produces one output channel. All filters are applied in a single
+ * pass of the GEMM engine, which keeps the sums of several output channels
+ * in registers, so every lowered input value is loaded once per block of
+ * output channels instead of once per filter.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * A batch of tensors (`N x C_in x ...`) is convolved frame by frame into a
+ * destination of `N x C_out x ...`, the filters are packed only once.
+ * </p>
+ * 
+ * @param *tensor       Tensor (`C_in x ...`) or batch (`N x C_in x ...`) to convolve.
+ * @param *filters      Filter bank (`C_out x C_in x ...`).
+ * @param *dest         Destination tensor (`C_out x ...` or `N x C_out x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the convolution, the engine is ignored.
+ * @param tensorType    Datatype type of the tensor data (INTEGER, FLOAT, DOUBLE)
+ * 
+ * @throw IllegalArgumentException - When the filter bank does not have one dimension more than the tensor.
+ * @throw IllegalArgumentException - When the destination has less channels than filters.
+ * @throw IllegalArgumentException - When the destination has not a frame for every frame of the batch.
+ * @throw NullPointerException - When either the tensor, filters or the destination is `NULL`.
+ * 
+ * @see #prepareConvolution(const Tensor* tensorBase, const Tensor* kernelBase, const Tensor* destBase,
+    const ConvolutionSettings* settings, const int channelDims, size_t* outputs, ConvolutionPadding* padding)
+ */
+static void executeFilterConvolution(const void* tensor, const void* filters, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType) {
+    if (tensor == NULL || filters == NULL || dest == NULL || settings == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
+        return;
+    }
+
+    const Tensor* filtersBase = (Tensor*)getTensorBaseByType(filters, tensorType);
+    void* tensorFrame = NULL;
+    void* destFrame = NULL;
+
+    if (createFirstFrames(tensor, dest, filtersBase->dimensions - 1, tensorType, &tensorFrame, &destFrame) == false) {
+        return;
+    }
+
+    const void* frame = tensorFrame != NULL ? tensorFrame : tensor;
+    const void* frameDest = destFrame != NULL ? destFrame : dest;
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(frame, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(frameDest, tensorType);
+    const int dims = tensorBase->dimensions;
+    void* kernel = NULL;
+
+    if (filtersBase->dimensions != dims + 1 || destBase->dimensions != dims) {
+        (void)throwIllegalArgumentException("A filter bank must have one dimension more than the tensor.");
+    } else if (destBase->shape[0] < filtersBase->shape[0]) {
+        (void)throwIllegalArgumentException("The destination has less channels than filters!");
+    } else {
+        // View of the first filter, all filters share its shape.
+        kernel = createTensorView(filters, dims, filtersBase->shape + 1,
+                    filtersBase->strides + 1, 0, tensorType);
+    }
+
+    if (kernel != NULL) {
+        const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+        const int count = filtersBase->shape[0];
+        const size_t taps = kernelBase->dataPoints;
+        const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+        size_t outputs = 0;
+        ConvolutionPadding padding = CONVOLUTION_PADDING_VALID;
+        int* outputShape = (int*)prepareConvolution(tensorBase, kernelBase, destBase, settings, 1, &outputs, &padding);
+        char* weights = outputShape == NULL ? NULL : (char*)malloc(count * taps * elementSize);
+
+        if (outputShape != NULL && weights == NULL) {
+            (void)throwMemoryAllocationException("Error on allocating memory for the weights (convolution).");
+        }
+
+        if (weights != NULL) {
+            const char* filterData = (const char*)getTensorDataByType(filters, tensorType);
+
+            // Pack the filters densely, since the bank might be a strided view.
+            // The packed weights are shared by all frames of a batch.
+            for (size_t k = 0; k < count * taps; k++) {
+                (void)memcpy(weights + k * elementSize,
+                    filterData + Tensor_getElementOffset(filtersBase, k) * elementSize, elementSize);
+            }
+
+            const ConvolutionProblem problem = {frame, kernel, frameDest, tensorBase, kernelBase, destBase,
+                tensorType, getUniformStride(outputShape + 2 * dims, outputShape + 3 * dims, 1, dims),
+                outputShape, outputs, padding, outputShape + dims, outputShape + 2 * dims, outputShape + 3 * dims};
+            ConvolutionBatch batch = {problem, CONVOLUTION_ALGORITHM_GEMM, NULL, NULL, weights, count, false,
+                tensor, dest, tensorFrame != NULL ? ((Tensor*)getTensorBaseByType(tensor, tensorType))->shape[0] : 0};
+
+            (void)runConvolutionBatch(&batch);
+            (void)free(weights);
+        }
+
+        (void)free(outputShape);
+        (void)freeTensorByType(kernel, tensorType);
+    }
+
+    if (tensorFrame != NULL) (void)freeTensorByType(tensorFrame, tensorType);
+    if (destFrame != NULL) (void)freeTensorByType(destFrame, tensorType);
+}
+
+/**
+ * Executes a convolution of the tensor with every filter of the filter bank.
+ * The output of filter `n` is written to channel `n` of the destination.
+ * 
+ * @param *tensor       Tensor (`C_in x ...`) or batch (`N x C_in x ...`) to convolve.
+ * @param *filters      Filter bank (`C_out x C_in x ...`).
+ * @param *dest         Destination tensor (`C_out x ...` or `N x C_out x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeFilterConvolution(const void* tensor, const void* filters, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void IntegerTensor_convolveFilters(const IntegerTensor* tensor,
+    const IntegerTensor* filters, const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeFilterConvolution(tensor, filters, dest, settings, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Executes a convolution of the tensor with every filter of the filter bank.
+ * The output of filter `n` is written to channel `n` of the destination.
+ * 
+ * @param *tensor       Tensor (`C_in x ...`) or batch (`N x C_in x ...`) to convolve.
+ * @param *filters      Filter bank (`C_out x C_in x ...`).
+ * @param *dest         Destination tensor (`C_out x ...` or `N x C_out x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeFilterConvolution(const void* tensor, const void* filters, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void FloatTensor_convolveFilters(const FloatTensor* tensor,
+    const FloatTensor* filters, const FloatTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeFilterConvolution(tensor, filters, dest, settings, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Executes a convolution of the tensor with every filter of the filter bank.
+ * The output of filter `n` is written to channel `n` of the destination.
+ * 
+ * @param *tensor       Tensor (`C_in x ...`) or batch (`N x C_in x ...`) to convolve.
+ * @param *filters      Filter bank (`C_out x C_in x ...`).
+ * @param *dest         Destination tensor (`C_out x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeFilterConvolution(const void* tensor, const void* filters, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void DoubleTensor_convolveFilters(const DoubleTensor* tensor,
+    const DoubleTensor* filters, const DoubleTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeFilterConvolution(tensor, filters, dest, settings, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Executes a depthwise convolution, that convolves every channel of the
+ * tensor with its own channel of the kernel, optionally followed by a
+ * pointwise (1x1) convolution, that combines the channels.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The depthwise convolution is executed by the direct walker, the output
+ * rows of all channels are distributed over the threads. With pointwise
+ * filters, the depthwise outputs of a band of rows are combined by the
+ * filters, while they are still in the cache, the intermediate tensor of
+ * all depthwise outputs is never created.
+ * </p>
+ * 
+ * <p><b>Note:</b><br>
+ * A batch of tensors (`N x C x ...`) is convolved frame by frame, the
+ * weights are packed only once. The channel dimension is neither padded
+ * nor strided, the engine of the settings is ignored.
+ * </p>
+ * 
+ * @param *tensor       Tensor (`C x ...`) or batch (`N x C x ...`) to convolve.
+ * @param *kernel       Depthwise kernel (`C x ...`) with one channel per channel of the tensor.
+ * @param *pointwise    Optional pointwise filters (`C_out x C`, trailing dimensions of size `1` are allowed).
+ * @param *dest         Destination (`C x ...` or `C_out x ...`, with a leading `N` for a batch).
+ * @param *settings     Stride and padding of the convolution.
+ * @param tensorType    Datatype type of the tensor data (INTEGER, FLOAT, DOUBLE)
+ * 
+ * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ * @throw IllegalArgumentException - When the kernel has not one channel per channel of the tensor.
+ * @throw IllegalArgumentException - When the pointwise filters do not have the shape `C_out x C`.
+ * @throw IllegalArgumentException - When the destination has less channels than outputs.
+ * 
+ * @see #prepareConvolution(const Tensor* tensorBase, const Tensor* kernelBase, const Tensor* destBase,
+    const ConvolutionSettings* settings, const int channelDims, size_t* outputs, ConvolutionPadding* padding)
+ */
+static void executeDepthwiseConvolution(const void* tensor, const void* kernel, const void* pointwise,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType) {
+    if (tensor == NULL || kernel == NULL || dest == NULL || settings == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
+        return;
+    }
+
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    const Tensor* pointwiseBase = pointwise != NULL ? (Tensor*)getTensorBaseByType(pointwise, tensorType) : NULL;
+    const int channels = kernelBase->shape[0];
+    int filters = pointwiseBase != NULL && pointwiseBase->dimensions >= 2 && pointwiseBase->shape[1] == channels
+                    ? pointwiseBase->shape[0] : 0;
+
+    for (int dim = 2; pointwiseBase != NULL && dim < pointwiseBase->dimensions; dim++) {
+        filters = pointwiseBase->shape[dim] == 1 ? filters : 0;
+    }
+
+    if (pointwiseBase != NULL && filters == 0) {
+        (void)throwIllegalArgumentException("The pointwise filters must have the shape C_out x C of the channels.");
+        return;
+    }
+
+    void* tensorFrame = NULL;
+    void* destFrame = NULL;
+
+    if (createFirstFrames(tensor, dest, kernelBase->dimensions, tensorType, &tensorFrame, &destFrame) == false) {
+        return;
+    }
+
+    const void* frame = tensorFrame != NULL ? tensorFrame : tensor;
+    const void* frameDest = destFrame != NULL ? destFrame : dest;
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(frame, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(frameDest, tensorType);
+    const int dims = tensorBase->dimensions;
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    size_t outputs = 0;
+    ConvolutionPadding padding = CONVOLUTION_PADDING_VALID;
+    int* outputShape = NULL;
+    char* weights = NULL;
+
+    if (destBase->dimensions != dims || destBase->shape[0] < (pointwise != NULL ? filters : channels)) {
+        (void)throwIllegalArgumentException("The destination has less channels than outputs!");
+    } else {
+        outputShape = (int*)prepareConvolution(tensorBase, kernelBase, destBase, settings, 1, &outputs, &padding);
+    }
+
+    if (outputShape != NULL && pointwise != NULL) {
+        const char* pointwiseData = (const char*)getTensorDataByType(pointwise, tensorType);
+        weights = (char*)malloc((size_t)filters * channels * elementSize);
+
+        if (weights == NULL) {
+            (void)free(outputShape);
+            outputShape = NULL;
+            (void)throwMemoryAllocationException("Error on allocating memory for the weights (convolution).");
+        }
+
+        // Pack the filters densely and transposed (`C x C_out`), the weights
+        // of all filters for a channel are read together.
+        for (size_t k = 0; weights != NULL && k < (size_t)filters * channels; k++) {
+            (void)memcpy(weights + ((k % channels) * filters + k / channels) * elementSize,
+                pointwiseData + Tensor_getElementOffset(pointwiseBase, k) * elementSize, elementSize);
+        }
+    }
+
+    if (outputShape != NULL) {
+        // Every channel has its own outputs. prepareConvolution already set the
+        // stride and the dilation of the channels to 1, the engine never sees others.
+        outputShape[0] = channels;
+
+        const ConvolutionProblem problem = {frame, kernel, frameDest, tensorBase, kernelBase, destBase,
+            tensorType, getUniformStride(outputShape + 2 * dims, outputShape + 3 * dims, 1, dims),
+            outputShape, outputs * channels, padding, outputShape + dims, outputShape + 2 * dims,
+            outputShape + 3 * dims};
+        ConvolutionBatch batch = {problem, CONVOLUTION_ALGORITHM_DIRECT, NULL, NULL, weights, filters, true,
+            tensor, dest, tensorFrame != NULL ? ((Tensor*)getTensorBaseByType(tensor, tensorType))->shape[0] : 0};
+
+        (void)runConvolutionBatch(&batch);
+        (void)free(outputShape);
+    }
+
+    if (weights != NULL) (void)free(weights);
+    if (tensorFrame != NULL) (void)freeTensorByType(tensorFrame, tensorType);
+    if (destFrame != NULL) (void)freeTensorByType(destFrame, tensorType);
+}
+
+/**
+ * Executes a depthwise convolution, channel `c` of the tensor is convolved
+ * with channel `c` of the kernel into channel `c` of the destination.
+ * 
+ * @param *tensor       Tensor (`C x ...`) or batch (`N x C x ...`) to convolve.
+ * @param *kernel       Kernel (`C x ...`) with one channel per channel of the tensor.
+ * @param *dest         Destination tensor (`C x ...` or `N x C x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeDepthwiseConvolution(const void* tensor, const void* kernel, const void* pointwise,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void IntegerTensor_convolveDepthwise(const IntegerTensor* tensor,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeDepthwiseConvolution(tensor, kernel, NULL, dest, settings, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Executes a depthwise convolution, channel `c` of the tensor is convolved
+ * with channel `c` of the kernel into channel `c` of the destination.
+ * 
+ * @param *tensor       Tensor (`C x ...`) or batch (`N x C x ...`) to convolve.
+ * @param *kernel       Kernel (`C x ...`) with one channel per channel of the tensor.
+ * @param *dest         Destination tensor (`C x ...` or `N x C x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeDepthwiseConvolution(const void* tensor, const void* kernel, const void* pointwise,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void FloatTensor_convolveDepthwise(const FloatTensor* tensor,
+    const FloatTensor* kernel, const FloatTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeDepthwiseConvolution(tensor, kernel, NULL, dest, settings, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Executes a depthwise convolution, channel `c` of the tensor is convolved
+ * with channel `c` of the kernel into channel `c` of the destination.
+ * 
+ * @param *tensor       Tensor (`C x ...`) or batch (`N x C x ...`) to convolve.
+ * @param *kernel       Kernel (`C x ...`) with one channel per channel of the tensor.
+ * @param *dest         Destination tensor (`C x ...` or `N x C x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeDepthwiseConvolution(const void* tensor, const void* kernel, const void* pointwise,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void DoubleTensor_convolveDepthwise(const DoubleTensor* tensor,
+    const DoubleTensor* kernel, const DoubleTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeDepthwiseConvolution(tensor, kernel, NULL, dest, settings, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Executes a depthwise convolution followed by a pointwise (1x1)
+ * convolution, that combines the channels (depthwise separable
+ * convolution). Output channel `n` is the sum of the depthwise outputs
+ * of all channels `c` weighted by `pointwise[n][c]`.
+ * 
+ * @param *tensor       Tensor (`C x ...`) or batch (`N x C x ...`) to convolve.
+ * @param *depthwise    Depthwise kernel (`C x ...`) with one channel per channel of the tensor.
+ * @param *pointwise    Pointwise filters (`C_out x C`).
+ * @param *dest         Destination tensor (`C_out x ...` or `N x C_out x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the depthwise convolution.
+ * 
+ * @see #executeDepthwiseConvolution(const void* tensor, const void* kernel, const void* pointwise,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void IntegerTensor_convolveDepthwiseSeparable(const IntegerTensor* tensor, const IntegerTensor* depthwise,
+    const IntegerTensor* pointwise, const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    if (pointwise == NULL) {
+        (void)throwNullPointerException("The pointwise filters must not be NULL.");
+        return;
+    }
+
+    (void)executeDepthwiseConvolution(tensor, depthwise, pointwise, dest, settings, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Executes a depthwise convolution followed by a pointwise (1x1)
+ * convolution, that combines the channels (depthwise separable
+ * convolution). Output channel `n` is the sum of the depthwise outputs
+ * of all channels `c` weighted by `pointwise[n][c]`.
+ * 
+ * @param *tensor       Tensor (`C x ...`) or batch (`N x C x ...`) to convolve.
+ * @param *depthwise    Depthwise kernel (`C x ...`) with one channel per channel of the tensor.
+ * @param *pointwise    Pointwise filters (`C_out x C`).
+ * @param *dest         Destination tensor (`C_out x ...` or `N x C_out x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the depthwise convolution.
+ * 
+ * @see #executeDepthwiseConvolution(const void* tensor, const void* kernel, const void* pointwise,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void FloatTensor_convolveDepthwiseSeparable(const FloatTensor* tensor, const FloatTensor* depthwise,
+    const FloatTensor* pointwise, const FloatTensor* dest, const ConvolutionSettings* settings) {
+    if (pointwise == NULL) {
+        (void)throwNullPointerException("The pointwise filters must not be NULL.");
+        return;
+    }
+
+    (void)executeDepthwiseConvolution(tensor, depthwise, pointwise, dest, settings, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Executes a depthwise convolution followed by a pointwise (1x1)
+ * convolution, that combines the channels (depthwise separable
+ * convolution). Output channel `n` is the sum of the depthwise outputs
+ * of all channels `c` weighted by `pointwise[n][c]`.
+ * 
+ * @param *tensor       Tensor (`C x ...`) or batch (`N x C x ...`) to convolve.
+ * @param *depthwise    Depthwise kernel (`C x ...`) with one channel per channel of the tensor.
+ * @param *pointwise    Pointwise filters (`C_out x C`).
+ * @param *dest         Destination tensor (`C_out x ...` or `N x C_out x ...`) in which to write the results.
+ * @param *settings     Stride and padding of the depthwise convolution.
+ * 
+ * @see #executeDepthwiseConvolution(const void* tensor, const void* kernel, const void* pointwise,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void DoubleTensor_convolveDepthwiseSeparable(const DoubleTensor* tensor, const DoubleTensor* depthwise,
+    const DoubleTensor* pointwise, const DoubleTensor* dest, const ConvolutionSettings* settings) {
+    if (pointwise == NULL) {
+        (void)throwNullPointerException("The pointwise filters must not be NULL.");
+        return;
+    }
+
+    (void)executeDepthwiseConvolution(tensor, depthwise, pointwise, dest, settings, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a dense tensor of zeros of the given type.
+ * 
+ * @param dimensions    Number of dimensions.
+ * @param *shape        Shape of the tensor.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The tensor or `NULL` on failure.
+ */
+static void* createZerosByType(const int dimensions, const int* shape, const TensorType tensorType) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        return IntegerTensor_zeros(dimensions, shape);
+    case _TENSOR_TYPE_FLOAT_:
+        return FloatTensor_zeros(dimensions, shape);
+    default:
+        return DoubleTensor_zeros(dimensions, shape);
+    }
+}
+
+/**
+ * Copies the output gradient into a dense tensor of zeros, `stride` values
+ * apart in every dimension (the gradient of a strided convolution is a
+ * convolution of the spread gradient with stride 1).
+ * 
+ * @param *gradient     The output gradient, can be a strided view.
+ * @param *spread       Dense zeros of the spread shape `(size - 1) * stride + 1`.
+ * @param stride        Stride of the convolution.
+ * @param tensorType    Type of the tensors.
+ */
+static void spreadGradient(const void* gradient, const void* spread, const int stride, const TensorType tensorType) {
+    const Tensor* gradientBase = (Tensor*)getTensorBaseByType(gradient, tensorType);
+    const Tensor* spreadBase = (Tensor*)getTensorBaseByType(spread, tensorType);
+    const int dims = gradientBase->dimensions;
+    const int width = gradientBase->shape[dims - 1];
+    const size_t rows = gradientBase->dataPoints / width;
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const ptrdiff_t sourceStep = gradientBase->strides[dims - 1];
+    const char* source = (const char*)getTensorDataByType(gradient, tensorType);
+    char* target = (char*)getTensorDataByType(spread, tensorType);
+
+    for (size_t row = 0; row < rows; row++) {
+        const char* values = source + Tensor_getElementOffset(gradientBase, row * width) * elementSize;
+        size_t rest = row;
+        size_t offset = 0;
+
+        for (int dim = dims - 2; dim >= 0; dim--) {
+            offset += (rest % gradientBase->shape[dim]) * stride * spreadBase->strides[dim];
+            rest /= gradientBase->shape[dim];
+        }
+
+        char* spreadRow = target + offset * elementSize;
+
+        // Copied bitwise, the sizes are constant to let the copies inline.
+        if (elementSize == sizeof(double)) {
+            for (int x = 0; x < width; x++) {
+                (void)memcpy(spreadRow + (size_t)x * stride * sizeof(double),
+                    values + x * sourceStep * sizeof(double), sizeof(double));
+            }
+        } else {
+            for (int x = 0; x < width; x++) {
+                (void)memcpy(spreadRow + (size_t)x * stride * sizeof(int),
+                    values + x * sourceStep * sizeof(int), sizeof(int));
+            }
+        }
+    }
+}
+
+/**
+ * Adds the gradient of the padded input onto the input, which it was read
+ * from. Zeros of the padding drop their gradient, mirrored paddings add it
+ * onto the mirrored input.
+ * 
+ * @param *padded       Dense gradient of the padded input.
+ * @param *dest         Dense gradient of the input, which is overwritten.
+ * @param *before       Padding before every dimension.
+ * @param padding       The padding of the convolution.
+ * @param tensorType    Type of the tensors.
+ */
+static void foldPaddedGradient(const void* padded, const void* dest, const int* before,
+    const ConvolutionPadding padding, const TensorType tensorType) {
+    const Tensor* paddedBase = (Tensor*)getTensorBaseByType(padded, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const char* source = (const char*)getTensorDataByType(padded, tensorType);
+    char* target = (char*)getTensorDataByType(dest, tensorType);
+
+    (void)memset(target, 0, destBase->dataPoints * elementSize);
+
+    for (size_t e = 0; e < paddedBase->dataPoints; e++) {
+        size_t rest = e;
+        size_t offset = 0;
+        size_t stride = 1;
+        int index = 0;
+
+        for (int dim = paddedBase->dimensions - 1; dim >= 0 && index >= 0; dim--) {
+            index = resolvePaddedIndex((int)(rest % paddedBase->shape[dim]) - before[dim],
+                        destBase->shape[dim], padding);
+            rest /= paddedBase->shape[dim];
+            offset += (size_t)index * stride;
+            stride *= destBase->shape[dim];
+        }
+
+        if (index < 0) {
+            continue;
+        }
+
+        switch (tensorType) {
+        case _TENSOR_TYPE_INTEGER_:
+            ((int*)target)[offset] += ((const int*)source)[e];
+            break;
+        case _TENSOR_TYPE_FLOAT_:
+            ((float*)target)[offset] += ((const float*)source)[e];
+            break;
+        default:
+            ((double*)target)[offset] += ((const double*)source)[e];
+            break;
+        }
+    }
+}
+
+/**
+ * Computes the gradient of the loss with respect to the input of a
+ * convolution from the gradient of its outputs.
+ * 
+ * <p><b>Functionality:</b><br>
+ * Every input receives the output gradients times the taps, that read it.
+ * This is a convolution of the output gradient, whose values are spread
+ * `stride` apart, with the flipped kernel, padded by the kernel size minus
+ * one. It runs on the forward engines (with the same engine choice), which
+ * read that padding virtually. With zero padding the input gradient is
+ * computed directly, mirrored paddings (and paddings larger than the
+ * kernel) compute the gradient of the whole padded input first and fold it
+ * back onto the inputs.
+ * </p>
+ * 
+ * @param *gradient     Gradient of the outputs of the forward convolution.
+ * @param *kernel       Kernel of the forward convolution.
+ * @param *dest         Contiguous destination with the shape of the forward input.
+ * @param *settings     Settings of the forward convolution.
+ * @param tensorType    Datatype type of the tensor data (INTEGER, FLOAT, DOUBLE)
+ * 
+ * @throw NullPointerException - When either the gradient, kernel or the destination is `NULL`.
+ * @throw IllegalArgumentException - When the gradient does not have the shape of the forward outputs.
+ * @throw IllegalArgumentException - When the strides differ or a dimension is dilated.
+ * @throw IllegalArgumentException - When the destination is not contiguous.
+ */
+static void executeBackwardData(const void* gradient, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType) {
+    if (gradient == NULL || kernel == NULL || dest == NULL || settings == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
+        return;
+    }
+
+    const Tensor* gradientBase = (Tensor*)getTensorBaseByType(gradient, tensorType);
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+
+    if (gradientBase->dimensions != kernelBase->dimensions) {
+        (void)throwIllegalArgumentException("The gradient must have the shape of the outputs.");
+        return;
+    } else if (Tensor_isContiguous(destBase) == false) {
+        (void)throwIllegalArgumentException("The destination of a convolution must be contiguous.");
+        return;
+    }
+
+    const int dims = kernelBase->dimensions;
+    size_t outputs = 0;
+    ConvolutionPadding padding = CONVOLUTION_PADDING_VALID;
+    int* outputShape = (int*)prepareConvolution(destBase, kernelBase, gradientBase, settings, 0, &outputs, &padding);
+    const int stride = outputShape == NULL ? 0 : getUniformStride(outputShape + 2 * dims, outputShape + 3 * dims, 0, dims);
+
+    if (outputShape == NULL) {
+        return;
+    } else if (memcmp(outputShape, gradientBase->shape, dims * sizeof(int)) != 0) {
+        (void)free(outputShape);
+        (void)throwIllegalArgumentException("The gradient must have the shape of the outputs.");
+        return;
+    } else if (stride == 0) {
+        (void)free(outputShape);
+        (void)throwIllegalArgumentException("The backward convolutions need one stride for all dimensions and no dilation.");
+        return;
+    }
+
+    const int* before = outputShape + dims;
+    int* geometry = (int*)malloc(4 * dims * sizeof(int));
+    int folded = padding == CONVOLUTION_PADDING_REFLECT || padding == CONVOLUTION_PADDING_REPLICATE;
+
+    if (geometry == NULL) {
+        (void)free(outputShape);
+        (void)throwMemoryAllocationException("Error on allocating memory for the output shape (convolution).");
+        return;
+    }
+
+    for (int dim = 0; dim < dims; dim++) {
+        folded = folded || before[dim] > kernelBase->shape[dim] - 1;
+    }
+
+    // Spread gradient, backward outputs and their padding.
+    int* spreadShape = geometry;
+    int* extent = geometry + dims;
+    int* backwardBefore = geometry + 2 * dims;
+    int* unit = geometry + 3 * dims;
+    size_t extentPoints = 1;
+
+    for (int dim = 0; dim < dims; dim++) {
+        unit[dim] = 1;
+        spreadShape[dim] = outputs == 0 ? 1 : (outputShape[dim] - 1) * stride + 1;
+        extent[dim] = folded ? (outputShape[dim] - 1) * stride + kernelBase->shape[dim] : destBase->shape[dim];
+        backwardBefore[dim] = kernelBase->shape[dim] - 1 - (folded ? 0 : before[dim]);
+        extentPoints *= extent[dim];
+    }
+
+    void* spread = stride > 1 && outputs > 0 ? createZerosByType(dims, spreadShape, tensorType) : NULL;
+    void* flipped = (void*)createZerosByType(dims, kernelBase->shape, tensorType);
+    void* padded = folded && outputs > 0 ? createZerosByType(dims, extent, tensorType) : NULL;
+
+    if (outputs == 0) {
+        (void)memset(getTensorDataByType(dest, tensorType), 0,
+            destBase->dataPoints * (tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int)));
+    } else if (flipped != NULL && (stride == 1 || spread != NULL) && (folded == false || padded != NULL)) {
+        const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+        const char* kernelData = (const char*)getTensorDataByType(kernel, tensorType);
+        char* flippedData = (char*)getTensorDataByType(flipped, tensorType);
+        const size_t taps = kernelBase->dataPoints;
+
+        for (size_t k = 0; k < taps; k++) {
+            (void)memcpy(flippedData + (taps - 1 - k) * elementSize,
+                kernelData + Tensor_getElementOffset(kernelBase, k) * elementSize, elementSize);
+        }
+
+        if (spread != NULL) {
+            (void)spreadGradient(gradient, spread, stride, tensorType);
+        }
+
+        const void* source = spread != NULL ? spread : gradient;
+        const void* target = padded != NULL ? padded : dest;
+        const ConvolutionProblem problem = {source, flipped, target,
+            (Tensor*)getTensorBaseByType(source, tensorType), (Tensor*)getTensorBaseByType(flipped, tensorType),
+            (Tensor*)getTensorBaseByType(target, tensorType), tensorType, 1, extent, extentPoints,
+            CONVOLUTION_PADDING_ZERO, backwardBefore, unit, unit};
+        const WinogradKernel* winograd = NULL;
+        const SeparableKernel* separable = NULL;
+        WinogradKernel* transformed = NULL;
+        SeparableKernel* decomposed = NULL;
+        const ConvolutionAlgorithm algorithm = planConvolution(&problem, settings->algorithm,
+                                                &winograd, &separable, &transformed, &decomposed);
+        ConvolutionBatch batch = {problem, algorithm, winograd, separable, NULL, 0, false, source, target, 0};
+
+        (void)runConvolutionBatch(&batch);
+
+        if (padded != NULL) {
+            (void)foldPaddedGradient(padded, dest, before, padding, tensorType);
+        }
+
+        (void)freeWinogradKernel(transformed);
+        (void)freeSeparableKernel(decomposed);
+    }
+
+    if (spread != NULL) (void)freeTensorByType(spread, tensorType);
+    if (flipped != NULL) (void)freeTensorByType(flipped, tensorType);
+    if (padded != NULL) (void)freeTensorByType(padded, tensorType);
+    (void)free(geometry);
+    (void)free(outputShape);
+}
+
+/**
+ * Computes the gradient of the input of a convolution from the gradient of
+ * its outputs.
+ * 
+ * @param *gradient     Gradient of the outputs.
+ * @param *kernel       Kernel of the convolution.
+ * @param *dest         Destination with the shape of the input.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * 
+ * @see #executeBackwardData(const void* gradient, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void IntegerTensor_convolveBackwardData(const IntegerTensor* gradient,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeBackwardData(gradient, kernel, dest, settings, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Computes the gradient of the input of a convolution from the gradient of
+ * its outputs.
+ * 
+ * @param *gradient     Gradient of the outputs.
+ * @param *kernel       Kernel of the convolution.
+ * @param *dest         Destination with the shape of the input.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * 
+ * @see #executeBackwardData(const void* gradient, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void FloatTensor_convolveBackwardData(const FloatTensor* gradient,
+    const FloatTensor* kernel, const FloatTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeBackwardData(gradient, kernel, dest, settings, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Computes the gradient of the input of a convolution from the gradient of
+ * its outputs.
+ * 
+ * @param *gradient     Gradient of the outputs.
+ * @param *kernel       Kernel of the convolution.
+ * @param *dest         Destination with the shape of the input.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * 
+ * @see #executeBackwardData(const void* gradient, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void DoubleTensor_convolveBackwardData(const DoubleTensor* gradient,
+    const DoubleTensor* kernel, const DoubleTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeBackwardData(gradient, kernel, dest, settings, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Computes the gradient of the loss with respect to the kernel of a
+ * convolution from its input and the gradient of its outputs.
  * 
- * @param *tensor       The tensor from which to get the dot product.
- * @param *kernel       The kernel that should be used as the multiplicant.
- * @param tensorOffset  Offset of the tensor at which to start getting the dot product.
- * @param kernelOffset  Offset of the kernels values that function as the multiplicants.
+ * @param *tensor       Input of the forward convolution, can be a strided view.
+ * @param *gradient     Contiguous gradient of the outputs of the forward convolution.
+ * @param *dest         Contiguous destination with the shape of the kernel.
+ * @param *settings     Settings of the forward convolution, the engine is ignored.
+ * @param tensorType    Datatype type of the tensor data (INTEGER, FLOAT, DOUBLE)
+ * 
+ * @throw NullPointerException - When either the tensor, gradient or the destination is `NULL`.
+ * @throw IllegalArgumentException - When the gradient does not have the shape of the forward outputs.
+ * @throw IllegalArgumentException - When the strides differ or a dimension is dilated.
+ * @throw IllegalArgumentException - When the destination is not contiguous.
  * 
- * @return The dot product of the tensor and the kernel with the set offset.
+ * @see #convolveWeightGradient(const ConvolutionProblem* problem)
  */
-int IntegerTensor_dotProduct1D(const IntegerTensor* tensor,
-    const IntegerTensor* kernel, const int tensorOffset,
-    const int kernelOffset) {
-    const int kernelWidth = kernel->base->shape[kernel->base->dimensions - 1];
-    int dotProduct = 0;
+static void executeBackwardWeights(const void* tensor, const void* gradient, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType) {
+    if (tensor == NULL || gradient == NULL || dest == NULL || settings == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
+        return;
+    }
+
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* gradientBase = (Tensor*)getTensorBaseByType(gradient, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+
+    if (gradientBase->dimensions != tensorBase->dimensions) {
+        (void)throwIllegalArgumentException("The gradient must have the shape of the outputs.");
+        return;
+    } else if (Tensor_isContiguous(destBase) == false) {
+        (void)throwIllegalArgumentException("The destination of a convolution must be contiguous.");
+        return;
+    }
 
-    for (int kx = 0; kx < kernelWidth; kx++) {
-        const int t_val = tensorOffset + kx >= tensor->base->dataPoints ?
-                            0 : tensor->data[tensorOffset + kx];
-        const int k_val = kernel->data[kernelOffset + kx];
-        dotProduct += t_val * k_val;
+    size_t outputs = 0;
+    ConvolutionPadding padding = CONVOLUTION_PADDING_VALID;
+    int* outputShape = (int*)prepareConvolution(tensorBase, destBase, gradientBase, settings, 0, &outputs, &padding);
+
+    const int dims = tensorBase->dimensions;
+    const int stride = outputShape == NULL ? 0 : getUniformStride(outputShape + 2 * dims, outputShape + 3 * dims, 0, dims);
+
+    if (outputShape == NULL) {
+        return;
+    } else if (memcmp(outputShape, gradientBase->shape, dims * sizeof(int)) != 0) {
+        (void)free(outputShape);
+        (void)throwIllegalArgumentException("The gradient must have the shape of the outputs.");
+        return;
+    } else if (stride == 0) {
+        (void)free(outputShape);
+        (void)throwIllegalArgumentException("The backward convolutions need one stride for all dimensions and no dilation.");
+        return;
     }
 
-    return dotProduct;
+    const ConvolutionProblem problem = {tensor, dest, gradient, tensorBase, destBase, gradientBase,
+        tensorType, stride, outputShape, outputs, padding, outputShape + dims, outputShape + 2 * dims,
+        outputShape + 3 * dims};
+
+    (void)convolveWeightGradient(&problem);
+    (void)free(outputShape);
+}
+
+/**
+ * Computes the gradient of the kernel of a convolution from its input and
+ * the gradient of its outputs.
+ * 
+ * @param *tensor       Input of the convolution.
+ * @param *gradient     Gradient of the outputs.
+ * @param *dest         Destination with the shape of the kernel.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeBackwardWeights(const void* tensor, const void* gradient, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void IntegerTensor_convolveBackwardWeights(const IntegerTensor* tensor,
+    const IntegerTensor* gradient, const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeBackwardWeights(tensor, gradient, dest, settings, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Computes the gradient of the kernel of a convolution from its input and
+ * the gradient of its outputs.
+ * 
+ * @param *tensor       Input of the convolution.
+ * @param *gradient     Gradient of the outputs.
+ * @param *dest         Destination with the shape of the kernel.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeBackwardWeights(const void* tensor, const void* gradient, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void FloatTensor_convolveBackwardWeights(const FloatTensor* tensor,
+    const FloatTensor* gradient, const FloatTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeBackwardWeights(tensor, gradient, dest, settings, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Computes the gradient of the kernel of a convolution from its input and
+ * the gradient of its outputs.
+ * 
+ * @param *tensor       Input of the convolution.
+ * @param *gradient     Gradient of the outputs.
+ * @param *dest         Destination with the shape of the kernel.
+ * @param *settings     Stride and padding of the convolution.
+ * 
+ * @see #executeBackwardWeights(const void* tensor, const void* gradient, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType)
+ */
+void DoubleTensor_convolveBackwardWeights(const DoubleTensor* tensor,
+    const DoubleTensor* gradient, const DoubleTensor* dest, const ConvolutionSettings* settings) {
+    (void)executeBackwardWeights(tensor, gradient, dest, settings, _TENSOR_TYPE_DOUBLE_);
 }
 
 /**
- * Calculates the dot product of a 1D stripe in a tensor with the given
- * kernel. This function will always use the last dimension as the measurement
- * of the "width" of the tensor and kernel.
+ * Executes a convolution of an Uint8Tensor with a single Int8Tensor kernel
+ * (same dimensions as the tensor) or with a filter bank (one dimension
+ * more, `C_out x C_in x ...`), whose outputs are written to channel `n` of
+ * the destination.
  * 
- * @param *tensor       The tensor from which to get the dot product.
- * @param *kernel       The kernel that should be used as the multiplicant.
- * @param tensorOffset  Offset of the tensor at which to start getting the dot product.
- * @param kernelOffset  Offset of the kernels values that function as the multiplicants.
+ * <p><b>Note:</b><br>
+ * Only valid convolutions are supported. The activations must have a
+ * single zero point, a filter bank may have one scale per filter.
+ * </p>
  * 
- * @return The dot product of the tensor and the kernel with the set offset.
+ * @param *tensor       The quantized tensor.
+ * @param *kernel       The quantized kernel or filter bank.
+ * @param *dest         IntegerTensor for the 32-bit accumulations or Uint8Tensor for requantized outputs.
+ * @param stride        Stride of the kernel in every dimension.
+ * @param requantize    Whether the destination is an Uint8Tensor.
+ * 
+ * @throw NullPointerException - When a tensor is `NULL`.
+ * @throw IllegalArgumentException - When the stride is not positive or the kernel does not fit into the tensor.
+ * @throw IllegalArgumentException - When the tensors are quantized per channel where it is not supported.
+ * @throw IllegalArgumentException - When the destination does not have the output shape or is not contiguous.
  */
-float FloatTensor_dotProduct1D(const FloatTensor* tensor,
-    const FloatTensor* kernel, const int tensorOffset,
-    const int kernelOffset) {
-    const int kernelWidth = kernel->base->shape[kernel->base->dimensions - 1];
-    float dotProduct = 0;
+static void executeQuantizedConvolution(const Uint8Tensor* tensor, const Int8Tensor* kernel,
+    const void* dest, const int stride, const int requantize) {
+    if (tensor == NULL || kernel == NULL || dest == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
+        return;
+    }
+
+    const Tensor* tensorBase = tensor->base;
+    const Tensor* kernelBase = kernel->base;
+    const Tensor* destBase = requantize ? ((const Uint8Tensor*)dest)->base : ((const IntegerTensor*)dest)->base;
+    const int dims = tensorBase->dimensions;
+    const int filterBank = kernelBase->dimensions == dims + 1;
+    const int filters = filterBank ? kernelBase->shape[0] : 1;
+    const int* kernelShape = filterBank ? kernelBase->shape + 1 : kernelBase->shape;
+    const int channels = kernel->quantization.channels;
+
+    if (stride < 1) {
+        (void)throwIllegalArgumentException("The stride of a convolution must be positive.");
+        return;
+    } else if (kernelBase->dimensions != dims && filterBank == false) {
+        (void)throwIllegalArgumentException("The kernel must have the dimensions of the tensor (or one more).");
+        return;
+    } else if (tensor->quantization.channels != 1 || (channels != 1 && channels != (filterBank ? filters : 0))
+                || (requantize && ((const Uint8Tensor*)dest)->quantization.channels != 1)) {
+        (void)throwIllegalArgumentException("Only filter banks can be quantized per channel at a convolution.");
+        return;
+    } else if (destBase->dimensions != dims || Tensor_isContiguous(destBase) == false) {
+        (void)throwIllegalArgumentException("The destination must have the output shape and be contiguous.");
+        return;
+    }
+
+    int* outputShape = (int*)malloc(dims * sizeof(int));
+    float* multipliers = (float*)malloc(filters * sizeof(float));
+    size_t outputs = 1;
+
+    if (outputShape == NULL || multipliers == NULL) {
+        if (outputShape != NULL) (void)free(outputShape);
+        if (multipliers != NULL) (void)free(multipliers);
+        (void)throwMemoryAllocationException("Error on allocating memory for a quantized convolution.");
+        return;
+    }
+
+    for (int dim = 0; dim < dims; dim++) {
+        if (kernelShape[dim] > tensorBase->shape[dim]) {
+            (void)free(outputShape);
+            (void)free(multipliers);
+            (void)throwIllegalArgumentException("The kernel does not fit into the tensor.");
+            return;
+        }
+
+        outputShape[dim] = (tensorBase->shape[dim] - kernelShape[dim]) / stride + 1;
+        outputs *= outputShape[dim];
+
+        // The channels of a filter bank replace the (single) output channel.
+        const int expected = filterBank && dim == 0 ? filters : outputShape[dim];
+
+        if (destBase->shape[dim] != expected || (filterBank && dim == 0 && outputShape[0] != 1)) {
+            (void)free(outputShape);
+            (void)free(multipliers);
+            (void)throwIllegalArgumentException("The destination must have the output shape and be contiguous.");
+            return;
+        }
+    }
 
-    for (int kx = 0; kx < kernelWidth; kx++) {
-        const float t_val = tensorOffset + kx >= tensor->base->dataPoints ?
-                            0 : tensor->data[tensorOffset + kx];
-        const float k_val = kernel->data[kernelOffset + kx];
-        dotProduct += t_val * k_val;
+    for (int f = 0; f < filters && requantize; f++) {
+        multipliers[f] = tensor->quantization.scales[0] * kernel->quantization.scales[channels == 1 ? 0 : f]
+                        / ((const Uint8Tensor*)dest)->quantization.scales[0];
     }
 
-    return dotProduct;
+    if (outputs > 0) {
+        const QuantizedConvolution convolution = {tensorBase, tensor->data, tensor->quantization.zeroPoints[0],
+            kernelShape, kernel->data, filters, stride, outputShape, outputs,
+            requantize ? NULL : ((const IntegerTensor*)dest)->data,
+            requantize ? ((const Uint8Tensor*)dest)->data : NULL, multipliers,
+            requantize ? ((const Uint8Tensor*)dest)->quantization.zeroPoints[0] : 0};
+        (void)convolveQuantized(&convolution);
+    }
+
+    (void)free(outputShape);
+    (void)free(multipliers);
+}
+
+/**
+ * Convolves 8-bit activations with signed 8-bit weights and writes the exact
+ * 32-bit accumulations of `(value - zeroPoint) * weight`. Multiplied with the
+ * scales of the tensor and the kernel they give the real convolution.
+ * 
+ * @param *tensor   The quantized tensor.
+ * @param *kernel   The quantized kernel or filter bank (`C_out x C_in x ...`).
+ * @param *dest     Destination of the accumulations (`C_out x ...` for filter banks).
+ * @param stride    Stride of the kernel in every dimension.
+ * 
+ * @see #executeQuantizedConvolution(const Uint8Tensor* tensor, const Int8Tensor* kernel,
+    const void* dest, const int stride, const int requantize)
+ */
+void Uint8Tensor_convolveInt8(const Uint8Tensor* tensor, const Int8Tensor* kernel,
+    const IntegerTensor* dest, const int stride) {
+    (void)executeQuantizedConvolution(tensor, kernel, dest, stride, false);
 }
 
 /**
- * Calculates the dot product of a 1D stripe in a tensor with the given
- * kernel. This function will always use the last dimension as the measurement
- * of the "width" of the tensor and kernel.
+ * Convolves 8-bit activations with signed 8-bit weights and requantizes the
+ * results with the scale and zero point of the destination, so they can be
+ * the input of the next quantized convolution. Real values below the range
+ * of the destination are saturated, with a zero point of `0` this is a fused
+ * ReLU.
  * 
- * @param *tensor       The tensor from which to get the dot product.
- * @param *kernel       The kernel that should be used as the multiplicant.
- * @param tensorOffset  Offset of the tensor at which to start getting the dot product.
- * @param kernelOffset  Offset of the kernels values that function as the multiplicants.
+ * @param *tensor   The quantized tensor.
+ * @param *kernel   The quantized kernel or filter bank (`C_out x C_in x ...`).
+ * @param *dest     Destination with the calibrated output range (`C_out x ...` for filter banks).
+ * @param stride    Stride of the kernel in every dimension.
  * 
- * @return The dot product of the tensor and the kernel with the set offset.
+ * @see #executeQuantizedConvolution(const Uint8Tensor* tensor, const Int8Tensor* kernel,
+    const void* dest, const int stride, const int requantize)
  */
-double DoubleTensor_dotProduct1D(const DoubleTensor* tensor,
-    const DoubleTensor* kernel, const int tensorOffset,
-    const int kernelOffset) {
-    const int kernelWidth = kernel->base->shape[kernel->base->dimensions - 1];
-    double dotProduct = 0;
+void Uint8Tensor_convolveRequantized(const Uint8Tensor* tensor, const Int8Tensor* kernel,
+    const Uint8Tensor* dest, const int stride) {
+    (void)executeQuantizedConvolution(tensor, kernel, dest, stride, true);
+}
 
-    for (int kx = 0; kx < kernelWidth; kx++) {
-        const double t_val = tensorOffset + kx >= tensor->base->dataPoints ?
-                            0 : tensor->data[tensorOffset + kx];
-        const double k_val = kernel->data[kernelOffset + kx];
-        dotProduct += t_val * k_val;
+/**
+ * Saves the engines, that `CONVOLUTION_ALGORITHM_TUNED` chose on this host,
+ * to a text file, so later processes can skip the measurements.
+ * 
+ * @param *path     Path of the file, an existing file is replaced.
+ * 
+ * @return `true` on success, `false` when the file could not be written.
+ * 
+ * @throw NullPointerException - When the path is `NULL`.
+ */
+int saveConvolutionTuning(const char* path) {
+    if (path == NULL) {
+        (void)throwNullPointerException("The path of the tuning file must not be NULL.");
+        return false;
     }
 
-    return dotProduct;
+    return saveTuningTable(path);
 }
 
 /**
- * Recursively gets the dot product of a N-Dimensional kernel and writes the
- * result to the given destination tensor.
+ * Loads the engines of a file written by `saveConvolutionTuning`. They are
+ * used by `CONVOLUTION_ALGORITHM_TUNED` and `CONVOLUTION_ALGORITHM_AUTO`.
  * 
- * <p><b>Functionality:</b><br>
- * Goes down from the highest dimension to the lowest and checks if the current
- * dimension is the first, if true, the dot product from the 1D stripe is calculated
- * and returned. If not a new recursion call happens and the process repeats until
- * the function reaches the first dimension.
+ * <p><b>Note:</b><br>
+ * A missing file is not an error of the library, it only returns `false`,
+ * so deployments can load a table optionally. Loaded engines, that do not
+ * apply to their problem, fall back to the automatic choice.
+ * </p>
+ * 
+ * @param *path     Path of the file.
+ * 
+ * @return `true` when the whole file was loaded, `false` when it could
+ * not be read or is malformed.
+ * 
+ * @throw NullPointerException - When the path is `NULL`.
+ */
+int loadConvolutionTuning(const char* path) {
+    if (path == NULL) {
+        (void)throwNullPointerException("The path of the tuning file must not be NULL.");
+        return false;
+    }
+
+    return loadTuningTable(path);
+}
+
+/**
+ * Removes all engines, that were tuned or loaded.
+ */
+void clearConvolutionTuning() {
+    (void)clearTuningTable();
+}
+
+/**
+ * Returns the number of convolution problems with a tuned engine.
+ * 
+ * @return The number of tuned problems.
+ */
+size_t getConvolutionTuningSize() {
+    return getTuningTableSize();
+}
+
+/**
+ * Computes the summed-area table (integral image) of a tensor.
+ * 
+ * @param *tensor       The tensor, can be a strided view.
+ * @param *dest         Destination with the shape of the tensor.
+ * @param tensorType    Type of the tensors.
+ * 
+ * @throw NullPointerException - When the tensor or the destination is `NULL`.
+ * @throw IllegalArgumentException - When the shapes of the tensor and the destination differ.
+ */
+static void executeIntegralImage(const void* tensor, const void* dest, const TensorType tensorType) {
+    if (tensor == NULL || dest == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at an integral image.");
+        return;
+    }
+
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+
+    if (tensorBase->dimensions != destBase->dimensions
+        || memcmp(tensorBase->shape, destBase->shape, tensorBase->dimensions * sizeof(int)) != 0) {
+        (void)throwIllegalArgumentException("The destination of an integral image must have the shape of the tensor.");
+        return;
+    }
+
+    (void)computeIntegralImage(tensor, dest, tensorType);
+}
+
+/**
+ * Computes the summed-area table (integral image) of the tensor. Every
+ * value of the destination is the sum of all tensor values, whose indices
+ * are at most its own ones in every dimension.
  * 
- * All dot products are returned to the highest dimension, where it'll be written
- * out to the destination tensor.
+ * <p><b>Note:</b><br>
+ * The sums are formed in `long long` and wrap around, when they exceed the
+ * range of an `int`.
  * </p>
  * 
- * @param *tensor                   Tensor that should be convolved.
- * @param *kernel                   The kernel that should be used for the convolution.
- * @param *dest                     Destination tensor in which to write the dot products.
- * @param dim                       The current dimension.
- * @param tensorPtr                 Index to the data start in the tensor.
- * @param kernelPtr                 Index to the kernel start.
- * @param *destPtr                  Pointer to the destination index.
- * @param *tensorDimJumpTable       Cummulative jump table with the entries of the offsets of each tensor dimension.
- * @param *kernelJumpTable          Cummulative jump table with the entries of the offsets of each kernel dimension.
- * @param highesternelDimension     Whether the call is from the highest dimension or not.
+ * @param *tensor   The tensor.
+ * @param *dest     Destination with the shape of the tensor.
  * 
- * @return The dot product of the current dimension.
+ * @see #executeIntegralImage(const void* tensor, const void* dest, const TensorType tensorType)
  */
-int IntegerTensor_convolve_kernelDotProduct(const IntegerTensor* tensor,
-    const IntegerTensor* kernel, const IntegerTensor* dest, const int dim,
-    const int tensorPtr, const int kernelPtr, int* destPtr,
-    const int* tensorDimJumpTable, const int* kernelJumpTable, const int highestKernelDimension) {
-    int dotProduct = 0;
+void IntegerTensor_integralImage(const IntegerTensor* tensor, const IntegerTensor* dest) {
+    (void)executeIntegralImage(tensor, dest, _TENSOR_TYPE_INTEGER_);
+}
 
-    if (dim + 1 >= kernel->base->dimensions) {
-        dotProduct = (int)IntegerTensor_dotProduct1D(tensor, kernel, tensorPtr, kernelPtr);
+/**
+ * Computes the summed-area table (integral image) of the tensor. Every
+ * value of the destination is the sum of all tensor values, whose indices
+ * are at most its own ones in every dimension.
+ * 
+ * <p><b>Note:</b><br>
+ * The sums are formed in `double` and rounded at the end.
+ * </p>
+ * 
+ * @param *tensor   The tensor.
+ * @param *dest     Destination with the shape of the tensor.
+ * 
+ * @see #executeIntegralImage(const void* tensor, const void* dest, const TensorType tensorType)
+ */
+void FloatTensor_integralImage(const FloatTensor* tensor, const FloatTensor* dest) {
+    (void)executeIntegralImage(tensor, dest, _TENSOR_TYPE_FLOAT_);
+}
 
-        if (highestKernelDimension == true) {
-            dest->data[(*destPtr)++] = dotProduct;
-        }
+/**
+ * Computes the summed-area table (integral image) of the tensor. Every
+ * value of the destination is the sum of all tensor values, whose indices
+ * are at most its own ones in every dimension.
+ * 
+ * @param *tensor   The tensor.
+ * @param *dest     Destination with the shape of the tensor.
+ * 
+ * @see #executeIntegralImage(const void* tensor, const void* dest, const TensorType tensorType)
+ */
+void DoubleTensor_integralImage(const DoubleTensor* tensor, const DoubleTensor* dest) {
+    (void)executeIntegralImage(tensor, dest, _TENSOR_TYPE_DOUBLE_);
+}
 
-        return dotProduct;
+/**
+ * Copies a box of a tensor into another tensor. Indices of the source
+ * outside of the tensor are resolved by the padding, zeros are written for
+ * `CONVOLUTION_PADDING_VALID` and `CONVOLUTION_PADDING_ZERO`.
+ * 
+ * @param *source       Tensor to copy from, can be a strided view.
+ * @param *sourceStart  First index of the box in every dimension of the source, can be negative.
+ * @param *dest         Tensor to copy to, can be a strided view.
+ * @param *destStart    First index of the box in every dimension of the destination.
+ * @param *shape        Shape of the box.
+ * @param padding       Values, that are read outside of the source.
+ * @param tensorType    Type of the tensors.
+ */
+static void copyTensorBox(const void* source, const int* sourceStart, const void* dest, const int* destStart,
+    const int* shape, const ConvolutionPadding padding, const TensorType tensorType) {
+    const Tensor* sourceBase = (Tensor*)getTensorBaseByType(source, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    const char* sourceData = (const char*)getTensorDataByType(source, tensorType);
+    char* destData = (char*)getTensorDataByType(dest, tensorType);
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const int last = destBase->dimensions - 1;
+    const int rowStart = sourceStart[last];
+    const int rowInside = rowStart >= 0 && rowStart + shape[last] <= sourceBase->shape[last];
+    size_t rows = 1;
+
+    for (int dim = 0; dim < last; dim++) {
+        rows *= shape[dim];
     }
 
-    const int k_size = kernel->base->shape[dim];
-    const int k_off = kernelJumpTable[dim];
-    const int t_off = tensorDimJumpTable[dim];
-    
-    for (int i = 0; i < k_size; i++) {
-        int newKernelPtr = i * k_off + kernelPtr;
-        int newTensorPtr = i * t_off + tensorPtr;
+    for (size_t row = 0; row < rows; row++) {
+        ptrdiff_t sourceOffset = 0;
+        ptrdiff_t destOffset = 0;
+        int inside = true;
+        size_t rest = row;
+
+        for (int dim = last - 1; dim >= 0; dim--) {
+            const int i = (int)(rest % shape[dim]);
+            const int index = resolvePaddedIndex(sourceStart[dim] + i, sourceBase->shape[dim], padding);
+            rest /= shape[dim];
+            inside = inside && index >= 0;
+            sourceOffset += (ptrdiff_t)index * sourceBase->strides[dim];
+            destOffset += (ptrdiff_t)(destStart[dim] + i) * destBase->strides[dim];
+        }
+
+        const char* sourceRow = sourceData + sourceOffset * (ptrdiff_t)elementSize;
+        char* destRow = destData + (destOffset + (ptrdiff_t)destStart[last] * destBase->strides[last]) * (ptrdiff_t)elementSize;
 
-        dotProduct += (int)IntegerTensor_convolve_kernelDotProduct(tensor,
-            kernel, dest, dim + 1, newTensorPtr, newKernelPtr, destPtr,
-            tensorDimJumpTable, kernelJumpTable, false);
+        if (inside && rowInside && sourceBase->strides[last] == 1 && destBase->strides[last] == 1) {
+            (void)memcpy(destRow, sourceRow + (ptrdiff_t)rowStart * (ptrdiff_t)elementSize, shape[last] * elementSize);
+            continue;
+        }
+
+        for (int i = 0; i < shape[last]; i++) {
+            const int index = inside ? resolvePaddedIndex(rowStart + i, sourceBase->shape[last], padding) : -1;
+            char* value = destRow + (ptrdiff_t)i * destBase->strides[last] * (ptrdiff_t)elementSize;
+
+            if (index < 0) {
+                (void)memset(value, 0, elementSize);
+            } else {
+                (void)memcpy(value, sourceRow + (ptrdiff_t)index * sourceBase->strides[last] * (ptrdiff_t)elementSize,
+                    elementSize);
+            }
+        }
+    }
+}
+
+/**
+ * Marks the tiles of a band, whose values differ between two tensors of
+ * the same shape. The values are compared bitwise, so `-0.0` and `0.0`
+ * count as a change.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The band is compared row by row, every row is split into the tiles of the
+ * last dimension and a tile is skipped, once it is marked. So both tensors
+ * are streamed in memory order and a change ends the comparison of its
+ * tile early.
+ * </p>
+ * 
+ * @param *tensor       The first tensor, can be a strided view.
+ * @param *other        The second tensor, can be a strided view.
+ * @param *start        First index of the band in every dimension, the last one is ignored.
+ * @param *shape        Shape of the band, the last one is ignored.
+ * @param tileCount     Number of tiles in the last dimension.
+ * @param *changed      Flag of every tile, that is set when the tile differs.
+ * @param tensorType    Type of the tensors.
+ * 
+ * @return The number of changed tiles.
+ */
+static int markChangedTiles(const void* tensor, const void* other, const int* start, const int* shape,
+    const int tileCount, unsigned char* changed, const TensorType tensorType) {
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* otherBase = (Tensor*)getTensorBaseByType(other, tensorType);
+    const char* tensorData = (const char*)getTensorDataByType(tensor, tensorType);
+    const char* otherData = (const char*)getTensorDataByType(other, tensorType);
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const int last = tensorBase->dimensions - 1;
+    const int size = tensorBase->shape[last];
+    const int isDense = tensorBase->strides[last] == 1 && otherBase->strides[last] == 1;
+    int count = 0;
+    size_t rows = 1;
+
+    (void)memset(changed, 0, tileCount);
+
+    for (int dim = 0; dim < last; dim++) {
+        rows *= shape[dim];
     }
 
-    if (highestKernelDimension == true) {
-        dest->data[(*destPtr)++] = dotProduct;
+    for (size_t row = 0; row < rows && count < tileCount; row++) {
+        ptrdiff_t tensorOffset = 0;
+        ptrdiff_t otherOffset = 0;
+        size_t rest = row;
+
+        for (int dim = last - 1; dim >= 0; dim--) {
+            const int index = start[dim] + (int)(rest % shape[dim]);
+            rest /= shape[dim];
+            tensorOffset += (ptrdiff_t)index * tensorBase->strides[dim];
+            otherOffset += (ptrdiff_t)index * otherBase->strides[dim];
+        }
+
+        const char* tensorRow = tensorData + tensorOffset * (ptrdiff_t)elementSize;
+        const char* otherRow = otherData + otherOffset * (ptrdiff_t)elementSize;
+
+        for (int tile = 0; tile < tileCount; tile++) {
+            if (changed[tile]) {
+                continue;
+            }
+
+            const int first = tile * CONVOLUTION_CHANGE_TILE;
+            const int end = first + CONVOLUTION_CHANGE_TILE < size ? first + CONVOLUTION_CHANGE_TILE : size;
+
+            if (isDense) {
+                changed[tile] = memcmp(tensorRow + first * elementSize, otherRow + first * elementSize,
+                                    (end - first) * elementSize) != 0;
+            }
+
+            for (int i = first; i < end && isDense == false && changed[tile] == false; i++) {
+                changed[tile] = memcmp(tensorRow + (ptrdiff_t)i * tensorBase->strides[last] * (ptrdiff_t)elementSize,
+                                    otherRow + (ptrdiff_t)i * otherBase->strides[last] * (ptrdiff_t)elementSize,
+                                    elementSize) != 0;
+            }
+
+            count += changed[tile];
+        }
     }
 
-    return dotProduct;
+    return count;
 }
 
 /**
- * Recursively gets the dot product of a N-Dimensional kernel and writes the
- * result to the given destination tensor.
+ * Calculates the outputs of a dimension, that read at least one changed
+ * input element.
  * 
- * @param *tensor                   Tensor that should be convolved.
- * @param *kernel                   The kernel that should be used for the convolution.
- * @param *dest                     Destination tensor in which to write the dot products.
- * @param dim                       The current dimension.
- * @param tensorPtr                 Index to the data start in the tensor.
- * @param kernelPtr                 Index to the kernel start.
- * @param *destPtr                  Pointer to the destination index.
- * @param *tensorDimJumpTable       Cummulative jump table with the entries of the offsets of each tensor dimension.
- * @param *kernelJumpTable          Cummulative jump table with the entries of the offsets of each kernel dimension.
- * @param highesternelDimension     Whether the call is from the highest dimension or not.
+ * <p><b>Functionality:</b><br>
+ * The changed elements `[start; end)` are read at their own padded
+ * positions. Mirrored and replicated padding reads elements near the border
+ * a second time, so the padded positions before or after the tensor are
+ * added, as soon as the change reaches the elements they can read. The
+ * outputs, whose kernel overlaps the hull of these positions, are affected.
+ * </p>
+ * 
+ * @param start         First changed index.
+ * @param end           End of the changed indices (exclusive).
+ * @param size          Size of the tensor in the dimension.
+ * @param kernelSize    Size of the kernel in the dimension.
+ * @param stride        Stride of the kernel.
+ * @param outputs       Number of outputs of the dimension.
+ * @param before        Padded elements before the dimension.
+ * @param padding       Values, that are read outside of the tensor.
+ * @param *first        Pointer to write the first affected output to.
+ * @param *last         Pointer to write the last affected output to, less than `first` when none is affected.
+ */
+static void getChangedOutputRange(const int start, const int end, const int size, const int kernelSize,
+    const int stride, const int outputs, const int before, const ConvolutionPadding padding, int* first, int* last) {
+    const int readEnd = (outputs - 1) * stride - before + kernelSize;
+    const int after = readEnd > size ? readEnd - size : 0;
+    int low = start;
+    int high = end;
+
+    if (padding == CONVOLUTION_PADDING_REPLICATE || padding == CONVOLUTION_PADDING_REFLECT) {
+        const int mirrored = padding == CONVOLUTION_PADDING_REFLECT;
+
+        if (before > 0 && start <= (mirrored ? before : 0)) {
+            low = -before;
+        }
+
+        if (after > 0 && end >= (mirrored ? size - after : size)) {
+            high = readEnd;
+        }
+    }
+
+    const int firstTap = low - kernelSize + 1 + before;
+    *first = firstTap <= 0 ? 0 : (firstTap + stride - 1) / stride;
+    *last = (high - 1 + before) / stride;
+    *last = *last < outputs - 1 ? *last : outputs - 1;
+}
+
+/**
+ * Recomputes the outputs of a convolution, that read a changed box of the
+ * tensor, and leaves all other outputs of the destination untouched.
  * 
- * @return The dot product of the current dimension.
+ * <p><b>Functionality:</b><br>
+ * The box is widened by the kernel extent and mapped through the stride to
+ * the box of affected outputs. The tensor window, that these outputs read,
+ * is convolved without padding into a dense scratch destination, which is
+ * copied into the destination afterwards. The window is a view of the
+ * tensor, only a window reaching into the padding is copied with the padding
+ * resolved. So the cost is proportional to the changed box and not to the
+ * tensor. Batch dimensions map one to one, the channels of a filter bank are
+ * all recomputed.
+ * </p>
  * 
- * @see #IntegerTensor_convolve_kernelDotProduct(const IntegerTensor* tensor,
-    const IntegerTensor* kernel, const IntegerTensor* dest, const int dim,
-    const int tensorPtr, const int kernelPtr, int* destPtr,
-    const int* tensorDimJumpTable, const int* kernelJumpTable, const int highestKernelDimension)
+ * @param *tensor       Tensor or batch to convolve.
+ * @param *kernel       Kernel or filter bank to use.
+ * @param *dest         Destination, that holds the outputs of the unchanged tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param tensorType    Type of the tensors.
+ * @param isFilterBank  Whether the kernel is a bank of filters (`C_out x C_in x ...`).
+ * @param *start        First changed index in every dimension.
+ * @param *end          End of the changed indices in every dimension (exclusive).
+ * @param *winograd     Optional kernel, that is already transformed for the Winograd engine.
+ * @param *separable    Optional kernel, that is already decomposed for the separable engine.
  */
-float FloatTensor_convolve_kernelDotProduct(const FloatTensor* tensor,
-    const FloatTensor* kernel, const FloatTensor* dest, const int dim,
-    const int tensorPtr, const int kernelPtr, int* destPtr,
-    const int* tensorDimJumpTable, const int* kernelJumpTable, const int highestKernelDimension) {
-    float dotProduct = 0;
+static void convolveChangedBox(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const int* start, const int* end, const WinogradKernel* winograd, const SeparableKernel* separable) {
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    const int dims = tensorBase->dimensions;
+    const int batchDims = dims - kernelBase->dimensions + isFilterBank;
+    int* boxes = (int*)calloc(5 * dims, sizeof(int));
+
+    if (boxes == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the changed box (convolution).");
+        return;
+    }
 
-    if (dim + 1 >= kernel->base->dimensions) {
-        dotProduct = (float)FloatTensor_dotProduct1D(tensor, kernel, tensorPtr, kernelPtr);
+    int* outputStart = boxes;
+    int* outputShape = boxes + dims;
+    int* windowStart = boxes + 2 * dims;
+    int* windowShape = boxes + 3 * dims;
+    const int* origin = boxes + 4 * dims;
+    int isInside = true;
+    size_t offset = 0;
+
+    for (int dim = 0; dim < dims; dim++) {
+        const int size = tensorBase->shape[dim];
+
+        if (dim < batchDims) {
+            outputStart[dim] = start[dim];
+            outputShape[dim] = end[dim] - start[dim];
+            windowStart[dim] = start[dim];
+            windowShape[dim] = outputShape[dim];
+        } else if (isFilterBank && dim == batchDims) {
+            outputShape[dim] = kernelBase->shape[0];
+            windowShape[dim] = size;
+        } else {
+            const int stride = getSettingsStride(settings, dim - batchDims);
+            const int kernelSize = (kernelBase->shape[dim - batchDims + isFilterBank] - 1)
+                                    * getSettingsDilation(settings, dim - batchDims) + 1;
+            int before = 0;
+            int last = 0;
+            const int outputs = computeConvolutionOutputSize(size, kernelSize, stride,
+                                    settings->padding, settings->paddingSize, &before);
+            (void)getChangedOutputRange(start[dim], end[dim], size, kernelSize, stride, outputs,
+                before, settings->padding, &outputStart[dim], &last);
+
+            outputShape[dim] = last - outputStart[dim] + 1;
+            windowStart[dim] = outputStart[dim] * stride - before;
+            windowShape[dim] = (outputShape[dim] - 1) * stride + kernelSize;
+        }
 
-        if (highestKernelDimension == true) {
-            dest->data[(*destPtr)++] = dotProduct;
+        if (outputShape[dim] <= 0) {
+            (void)free(boxes);
+            return;
         }
 
-        return dotProduct;
+        isInside = isInside && windowStart[dim] >= 0 && windowStart[dim] + windowShape[dim] <= size;
+        offset += (size_t)windowStart[dim] * tensorBase->strides[dim];
     }
 
-    const int k_size = kernel->base->shape[dim];
-    const int k_off = kernelJumpTable[dim];
-    const int t_off = tensorDimJumpTable[dim];
-    
-    for (int i = 0; i < k_size; i++) {
-        int newKernelPtr = i * k_off + kernelPtr;
-        int newTensorPtr = i * t_off + tensorPtr;
+    void* window = NULL;
+
+    if (isInside) {
+        window = createTensorView(tensor, dims, windowShape, tensorBase->strides, offset, tensorType);
+    } else {
+        window = createZerosByType(dims, windowShape, tensorType);
 
-        dotProduct += (float)FloatTensor_convolve_kernelDotProduct(tensor,
-            kernel, dest, dim + 1, newTensorPtr, newKernelPtr, destPtr,
-            tensorDimJumpTable, kernelJumpTable, false);
+        if (window != NULL) {
+            (void)copyTensorBox(tensor, windowStart, window, origin, windowShape, settings->padding, tensorType);
+        }
     }
 
-    if (highestKernelDimension == true) {
-        dest->data[(*destPtr)++] = dotProduct;
+    void* scratch = window == NULL ? NULL : createZerosByType(dims, outputShape, tensorType);
+
+    if (scratch != NULL) {
+        // The window already holds the padding, tuning every box shape would cost more than it saves.
+        const ConvolutionSettings windowSettings = {settings->stride,
+            settings->algorithm == CONVOLUTION_ALGORITHM_TUNED ? CONVOLUTION_ALGORITHM_AUTO : settings->algorithm,
+            CONVOLUTION_PADDING_VALID, 0, settings->strides, settings->dilations};
+
+        if (isFilterBank) {
+            (void)executeFilterConvolution(window, kernel, scratch, &windowSettings, tensorType);
+        } else {
+            (void)executeConvolution(window, kernel, scratch, &windowSettings, tensorType, winograd, separable);
+        }
+
+        (void)copyTensorBox(scratch, origin, dest, outputStart, outputShape, CONVOLUTION_PADDING_VALID, tensorType);
+        (void)freeTensorByType(scratch, tensorType);
     }
 
-    return dotProduct;
+    if (window != NULL) (void)freeTensorByType(window, tensorType);
+    (void)free(boxes);
 }
 
 /**
- * Recursively gets the dot product of a N-Dimensional kernel and writes the
- * result to the given destination tensor.
+ * Validates an incremental convolution, whose destination holds the outputs
+ * of an earlier tensor of the same shape.
  * 
- * @param *tensor                   Tensor that should be convolved.
- * @param *kernel                   The kernel that should be used for the convolution.
- * @param *dest                     Destination tensor in which to write the dot products.
- * @param dim                       The current dimension.
- * @param tensorPtr                 Index to the data start in the tensor.
- * @param kernelPtr                 Index to the kernel start.
- * @param *destPtr                  Pointer to the destination index.
- * @param *tensorDimJumpTable       Cummulative jump table with the entries of the offsets of each tensor dimension.
- * @param *kernelJumpTable          Cummulative jump table with the entries of the offsets of each kernel dimension.
- * @param highesternelDimension     Whether the call is from the highest dimension or not.
+ * @param *tensor       Tensor or batch to convolve.
+ * @param *kernel       Kernel or filter bank to use.
+ * @param *dest         Destination of the convolution.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param tensorType    Type of the tensors.
+ * @param isFilterBank  Whether the kernel is a bank of filters (`C_out x C_in x ...`).
  * 
- * @return The dot product of the current dimension.
+ * @return `true` when the convolution is valid.
  * 
- * @see #IntegerTensor_convolve_kernelDotProduct(const IntegerTensor* tensor,
-    const IntegerTensor* kernel, const IntegerTensor* dest, const int dim,
-    const int tensorPtr, const int kernelPtr, int* destPtr,
-    const int* tensorDimJumpTable, const int* kernelJumpTable, const int highestKernelDimension)
+ * @throw NullPointerException - When either the tensor, kernel, destination or settings are `NULL`.
+ * @throw IllegalArgumentException - When a stride or dilation is not a positive integer.
+ * @throw IllegalArgumentException - When the tensor is neither a single input nor a batch of the kernel.
+ * @throw IllegalArgumentException - When the destination is smaller than the outputs.
  */
-double DoubleTensor_convolve_kernelDotProduct(const DoubleTensor* tensor,
-    const DoubleTensor* kernel, const DoubleTensor* dest, const int dim,
-    const int tensorPtr, const int kernelPtr, int* destPtr,
-    const int* tensorDimJumpTable, const int* kernelJumpTable, const int highestKernelDimension) {
-    double dotProduct = 0;
+static int validateIncrementalConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank) {
+    if (tensor == NULL || kernel == NULL || dest == NULL || settings == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
+        return false;
+    }
+
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    const int batchDims = tensorBase->dimensions - kernelBase->dimensions + isFilterBank;
 
-    if (dim + 1 >= kernel->base->dimensions) {
-        dotProduct = (double)DoubleTensor_dotProduct1D(tensor, kernel, tensorPtr, kernelPtr);
+    if (batchDims < 0 || batchDims > 1 || destBase->dimensions != tensorBase->dimensions) {
+        (void)throwIllegalArgumentException("The tensor must be a single input or a batch of the kernel.");
+        return false;
+    }
 
-        if (highestKernelDimension == true) {
-            dest->data[(*destPtr)++] = dotProduct;
+    for (int dim = 0; dim < tensorBase->dimensions; dim++) {
+        int before = 0;
+        int outputs = tensorBase->shape[dim];
+
+        if (dim >= batchDims && (getSettingsStride(settings, dim - batchDims) <= 0
+            || getSettingsDilation(settings, dim - batchDims) <= 0)) {
+            (void)throwIllegalArgumentException("Strides and dilations must be positive integers.");
+            return false;
+        } else if (isFilterBank && dim == batchDims) {
+            outputs = kernelBase->shape[0];
+        } else if (dim >= batchDims) {
+            outputs = computeConvolutionOutputSize(tensorBase->shape[dim],
+                        (kernelBase->shape[dim - batchDims + isFilterBank] - 1)
+                        * getSettingsDilation(settings, dim - batchDims) + 1,
+                        getSettingsStride(settings, dim - batchDims), settings->padding, settings->paddingSize, &before);
         }
 
-        return dotProduct;
+        if (destBase->shape[dim] < outputs) {
+            (void)throwIllegalArgumentException("The destination tensor is smaller than allowed!");
+            return false;
+        }
     }
 
-    const int k_size = kernel->base->shape[dim];
-    const int k_off = kernelJumpTable[dim];
-    const int t_off = tensorDimJumpTable[dim];
-    
-    for (int i = 0; i < k_size; i++) {
-        int newKernelPtr = i * k_off + kernelPtr;
-        int newTensorPtr = i * t_off + tensorPtr;
+    return true;
+}
 
-        dotProduct += (double)DoubleTensor_convolve_kernelDotProduct(tensor,
-            kernel, dest, dim + 1, newTensorPtr, newKernelPtr, destPtr,
-            tensorDimJumpTable, kernelJumpTable, false);
+/**
+ * Recomputes the outputs of a convolution, that read at least one of the
+ * given changed regions of the tensor. All other outputs of the destination
+ * are kept, so the destination must hold the convolution of the tensor
+ * before the changes.
+ * 
+ * @param *tensor       Tensor or batch to convolve.
+ * @param *kernel       Kernel or filter bank to use.
+ * @param *dest         Destination, that holds the outputs of the unchanged tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param tensorType    Type of the tensors.
+ * @param isFilterBank  Whether the kernel is a bank of filters (`C_out x C_in x ...`).
+ * @param *regions      The changed regions.
+ * @param count         Number of regions.
+ * @param *winograd     Optional kernel, that is already transformed for the Winograd engine.
+ * @param *separable    Optional kernel, that is already decomposed for the separable engine.
+ * 
+ * @throw NullPointerException - When the regions are `NULL`, but `count` is positive.
+ * @throw IllegalArgumentException - When a region reaches outside of the tensor.
+ * 
+ * @see #convolveChangedBox(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const int* start, const int* end, const WinogradKernel* winograd, const SeparableKernel* separable)
+ */
+static void executeRegionConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const ConvolutionRegion* regions, const int count, const WinogradKernel* winograd,
+    const SeparableKernel* separable) {
+    if (validateIncrementalConvolution(tensor, kernel, dest, settings, tensorType, isFilterBank) == false) {
+        return;
+    } else if (regions == NULL && count > 0) {
+        (void)throwNullPointerException("The changed regions must not be NULL.");
+        return;
     }
 
-    if (highestKernelDimension == true) {
-        dest->data[(*destPtr)++] = dotProduct;
-    }
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+
+    for (int region = 0; region < count; region++) {
+        const int* start = regions[region].start;
+        const int* end = regions[region].end;
+        int isEmpty = false;
+
+        for (int dim = 0; dim < tensorBase->dimensions; dim++) {
+            if (start[dim] < 0 || end[dim] > tensorBase->shape[dim]) {
+                (void)throwIllegalArgumentException("A changed region reaches outside of the tensor.");
+                return;
+            }
+
+            isEmpty = isEmpty || start[dim] >= end[dim];
+        }
 
-    return dotProduct;
+        if (isEmpty == false) {
+            (void)convolveChangedBox(tensor, kernel, dest, settings, tensorType, isFilterBank,
+                start, end, winograd, separable);
+        }
+    }
 }
 
 /**
- * Recursively moves the given kernel around the given tensor and gets the dot product of
- * the current position.
+ * Detects the changes between the tensor and its previous values and
+ * recomputes the outputs of a convolution, that read them.
  * 
  * <p><b>Functionality:</b><br>
- * Goes down from the highest dimension to the lowest and checks if the current
- * dimension is the first, if true, the dot product from the current location is calculated.
- * If not a new recursion call happens and the process repeats until
- * the function reaches the first dimension.
- * </p>
- * 
- * @param *tensorData           The actual tensor. (IntegerTensor, FloatTensor, DoubleTensor)
- * @param *kernelData           The actual kernel.
- * @param *destData             The actual destination tensor.
- * @param *tensorBase           The metadata of the tensor.
- * @param *kernelBase           The metadata of the kernel.
- * @param *destBase             The metadata of the destination tensor.
- * @param tensorType            Determines the types of the tensors used for convolution. (INTEGER, FLOAT, DOUBLE)
- * @param dim                   The current dimension of the recursion. (Depth of the recursion)
- * @param stride                Stride of the kernel.
- * @param tensorPtr             Index of the current tensor index at the current dimension and position of the kernel.
- * @param *destPtr              Pointer to the destination index.
- * @param *tensorDimJumpTable   Jump table where at a given index `i` the number of elements to skip, till the next dim is present (for tensor).
- * @param *kernelJumpTable      Jump table where at a given index `i` the number of elements to skip, till the next dim is present (for kernel).
- * @param highestDim            Whether the recursion is in the highest dimension or not.
+ * Both tensors are compared in tiles of `CONVOLUTION_CHANGE_TILE` elements
+ * per dimension. Changed tiles, that follow each other in the last
+ * dimension, are merged into one region, which is recomputed and copied
+ * into the previous tensor. So the previous tensor equals the tensor
+ * afterwards and the next call only sees the next changes.
+ * </p>
  * 
- * @throw IllegalArgumentException - When the destination size at the dimension is to small.
+ * @param *tensor       Tensor or batch to convolve.
+ * @param *previous     Tensor of the same shape, whose convolution the destination holds.
+ * @param *kernel       Kernel or filter bank to use.
+ * @param *dest         Destination, that holds the outputs of the previous tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param tensorType    Type of the tensors.
+ * @param isFilterBank  Whether the kernel is a bank of filters (`C_out x C_in x ...`).
+ * @param *winograd     Optional kernel, that is already transformed for the Winograd engine.
+ * @param *separable    Optional kernel, that is already decomposed for the separable engine.
+ * 
+ * @return The number of recomputed regions, `0` when nothing changed.
+ * 
+ * @throw NullPointerException - When the previous tensor is `NULL`.
+ * @throw IllegalArgumentException - When the shapes of the tensor and the previous tensor differ.
  */
-void convolve_moveKernel(const void* tensorData, const void* kernelData, const void* destData,
-    const Tensor* tensorBase, const Tensor* kernelBase, const Tensor* destBase,
-    const TensorType tensorType, const int dim,
-    const int stride, const int tensorPtr,
-    int* destPtr, const int* tensorDimJumpTable, const int* kernelJumpTable,
-    const int highestDim) {
-    if (dim >= tensorBase->dimensions) {
-        switch (tensorType) {
-        case _TENSOR_TYPE_INTEGER_:
-            (void)IntegerTensor_convolve_kernelDotProduct((const IntegerTensor*)tensorData,
-                (const IntegerTensor*)kernelData, (const IntegerTensor*)destData,
-                0, tensorPtr, 0, destPtr, tensorDimJumpTable, kernelJumpTable, true);
-            break;
-        case _TENSOR_TYPE_FLOAT_:
-            (void)FloatTensor_convolve_kernelDotProduct((const FloatTensor*)tensorData,
-                (const FloatTensor*)kernelData, (const FloatTensor*)destData,
-                0, tensorPtr, 0, destPtr, tensorDimJumpTable, kernelJumpTable, true);
-            break;
-        case _TENSOR_TYPE_DOUBLE_:
-            (void)DoubleTensor_convolve_kernelDotProduct((const DoubleTensor*)tensorData,
-                (const DoubleTensor*)kernelData, (const DoubleTensor*)destData,
-                0, tensorPtr, 0, destPtr, tensorDimJumpTable, kernelJumpTable, true);
-            break;
-        }
-        
-        return;
+static int executeChangedConvolution(const void* tensor, const void* previous, const void* kernel,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const WinogradKernel* winograd, const SeparableKernel* separable) {
+    if (validateIncrementalConvolution(tensor, kernel, dest, settings, tensorType, isFilterBank) == false) {
+        return 0;
+    } else if (previous == NULL) {
+        (void)throwNullPointerException("The previous tensor must not be NULL.");
+        return 0;
+    }
+
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* previousBase = (Tensor*)getTensorBaseByType(previous, tensorType);
+    const int dims = tensorBase->dimensions;
+    const int last = dims - 1;
+
+    if (previousBase->dimensions != dims || memcmp(tensorBase->shape, previousBase->shape, dims * sizeof(int)) != 0) {
+        (void)throwIllegalArgumentException("The previous tensor must have the shape of the tensor.");
+        return 0;
+    }
+
+    int* tiles = (int*)calloc(4 * dims, sizeof(int));
+    unsigned char* changed = tiles == NULL ? NULL
+        : (unsigned char*)malloc(tensorBase->shape[last] / CONVOLUTION_CHANGE_TILE + 1);
+
+    if (changed == NULL) {
+        (void)free(tiles);
+        (void)throwMemoryAllocationException("Error on allocating memory for the change tiles (convolution).");
+        return 0;
+    }
+
+    int* start = tiles + dims;
+    int* end = tiles + 2 * dims;
+    int* shape = tiles + 3 * dims;
+    size_t bands = 1;
+    int regions = 0;
+
+    for (int dim = 0; dim < dims; dim++) {
+        tiles[dim] = (tensorBase->shape[dim] + CONVOLUTION_CHANGE_TILE - 1) / CONVOLUTION_CHANGE_TILE;
+        bands *= dim < last ? tiles[dim] : 1;
     }
 
-    const int t_size = tensorBase->shape[dim];
-    const int k_size = kernelBase->shape[dim];
-    const int d_size = destBase->shape[dim];
-    const int tensorDimOff = tensorDimJumpTable[dim];
-    const int min_dest_size = (t_size - k_size) / stride + 1;
-    const int nextDim = dim + 1;
+    for (size_t band = 0; band < bands; band++) {
+        size_t rest = band;
+
+        for (int dim = last - 1; dim >= 0; dim--) {
+            start[dim] = (int)(rest % tiles[dim]) * CONVOLUTION_CHANGE_TILE;
+            end[dim] = start[dim] + CONVOLUTION_CHANGE_TILE;
+            end[dim] = end[dim] < tensorBase->shape[dim] ? end[dim] : tensorBase->shape[dim];
+            shape[dim] = end[dim] - start[dim];
+            rest /= tiles[dim];
+        }
+
+        if (markChangedTiles(tensor, previous, start, shape, tiles[last], changed, tensorType) == 0) {
+            continue;
+        }
+
+        // Consecutive changed tiles of the band form one region.
+        for (int tile = 0; tile < tiles[last]; tile++) {
+            if (changed[tile] == false) {
+                continue;
+            }
+
+            start[last] = tile * CONVOLUTION_CHANGE_TILE;
+
+            while (tile + 1 < tiles[last] && changed[tile + 1]) {
+                tile++;
+            }
 
-    if (d_size < min_dest_size) {
-        (void)throwIllegalArgumentException("The destination tensor is smaller than allowed!");
-        return;
-    }
+            end[last] = (tile + 1) * CONVOLUTION_CHANGE_TILE;
+            end[last] = end[last] < tensorBase->shape[last] ? end[last] : tensorBase->shape[last];
+            shape[last] = end[last] - start[last];
+            regions++;
 
-    for (int i = 0; (i + k_size) <= t_size; i += stride) {
-        int innerTensorPtr = nextDim >= tensorBase->dimensions ?
-                            tensorPtr + i
-                            : i * tensorDimOff + tensorPtr;
-        (void)convolve_moveKernel(tensorData, kernelData, destData,
-            tensorBase, kernelBase, destBase, tensorType,
-            nextDim, stride, innerTensorPtr,
-            destPtr, tensorDimJumpTable, kernelJumpTable, false);
+            (void)convolveChangedBox(tensor, kernel, dest, settings, tensorType, isFilterBank,
+                start, end, winograd, separable);
+            (void)copyTensorBox(tensor, start, previous, start, shape, CONVOLUTION_PADDING_VALID, tensorType);
+        }
     }
+
+    (void)free(changed);
+    (void)free(tiles);
+    return regions;
 }
 
 /**
- * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * Recomputes the outputs of a convolution, that read at least one of the
+ * given changed regions of the tensor. All other outputs are kept, so the
+ * destination must hold the convolution of the tensor before the changes.
+ * The cost is proportional to the changed regions widened by the kernel.
  * 
- * @param *tensor       Tensor to convolve.
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
  * @param *kernel       Kernel to use.
- * @param *dest         Destination tensor in which to write the results.
- * @param stride        Stride of the kernel.
- * @param tensorType    Datatype type of the tensor data (INTEGER, FLOAT, DOUBLE)
+ * @param *dest         Destination, that holds the outputs of the unchanged tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param *regions      The changed regions.
+ * @param count         Number of regions.
  * 
- * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
- * @throw IllegalArgumentException - When the destination size at the dimension is to small.
- * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ * @see #executeRegionConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const ConvolutionRegion* regions, const int count, const WinogradKernel* winograd,
+    const SeparableKernel* separable)
  */
-void convolve(const void* tensor, const void* kernel, const void* dest,
-    const int stride, const TensorType tensorType) {
-    if (tensor == NULL || kernel == NULL || dest == NULL) {
-        (void)throwNullPointerException("No tensor is allowed to be NULL at a convolution.");
-        return;
-    }
-
-    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
-    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(kernel, tensorType);
-    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
-
-    if (tensorBase->dimensions != kernelBase->dimensions) {
-        (void)throwIllegalArgumentException("Convolution is only allowed for equal dimensional tensors.");
-        return;
-    }
+void IntegerTensor_convolveRegions(const IntegerTensor* tensor, const IntegerTensor* kernel, const IntegerTensor* dest,
+    const ConvolutionSettings* settings, const ConvolutionRegion* regions, const int count) {
+    (void)executeRegionConvolution(tensor, kernel, dest, settings, _TENSOR_TYPE_INTEGER_, false,
+        regions, count, NULL, NULL);
+}
 
-    int destPtr = 0;
-    int* tensorJumpTable = (int*)generateDimensionBasedCummulativeJumpTable(tensorBase);
-    int* kernelJumpTable = (int*)generateDimensionBasedCummulativeJumpTable(kernelBase);
+/**
+ * Recomputes the outputs of a convolution, that read at least one of the
+ * given changed regions of the tensor. All other outputs are kept, so the
+ * destination must hold the convolution of the tensor before the changes.
+ * The cost is proportional to the changed regions widened by the kernel.
+ * 
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination, that holds the outputs of the unchanged tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param *regions      The changed regions.
+ * @param count         Number of regions.
+ * 
+ * @see #executeRegionConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const ConvolutionRegion* regions, const int count, const WinogradKernel* winograd,
+    const SeparableKernel* separable)
+ */
+void FloatTensor_convolveRegions(const FloatTensor* tensor, const FloatTensor* kernel, const FloatTensor* dest,
+    const ConvolutionSettings* settings, const ConvolutionRegion* regions, const int count) {
+    (void)executeRegionConvolution(tensor, kernel, dest, settings, _TENSOR_TYPE_FLOAT_, false,
+        regions, count, NULL, NULL);
+}
 
-    if (tensorJumpTable != NULL && kernelJumpTable != NULL) {
-        (void)convolve_moveKernel(tensor, kernel, dest, tensorBase, kernelBase,
-            destBase, tensorType, 0, stride, 0, &destPtr,
-            tensorJumpTable, kernelJumpTable, true);
-    }
-    
-    if (tensorJumpTable != NULL) (void)free(tensorJumpTable);
-    if (kernelJumpTable != NULL) (void)free(kernelJumpTable);
+/**
+ * Recomputes the outputs of a convolution, that read at least one of the
+ * given changed regions of the tensor. All other outputs are kept, so the
+ * destination must hold the convolution of the tensor before the changes.
+ * The cost is proportional to the changed regions widened by the kernel.
+ * 
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination, that holds the outputs of the unchanged tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
+ * @param *regions      The changed regions.
+ * @param count         Number of regions.
+ * 
+ * @see #executeRegionConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const ConvolutionRegion* regions, const int count, const WinogradKernel* winograd,
+    const SeparableKernel* separable)
+ */
+void DoubleTensor_convolveRegions(const DoubleTensor* tensor, const DoubleTensor* kernel, const DoubleTensor* dest,
+    const ConvolutionSettings* settings, const ConvolutionRegion* regions, const int count) {
+    (void)executeRegionConvolution(tensor, kernel, dest, settings, _TENSOR_TYPE_DOUBLE_, false,
+        regions, count, NULL, NULL);
 }
 
 /**
- * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * Detects the changes of the tensor against its previous values and
+ * recomputes only the outputs of a convolution, that read them. The
+ * changed values are copied into the previous tensor.
  * 
- * @param *tensor   Tensor to convolve.
- * @param *kernel   Kernel to use.
- * @param *dest     Destination tensor in which to write the results.
- * @param stride    Stride of the kernel.
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *previous     Previous values of the tensor, whose convolution the destination holds.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination, that holds the outputs of the previous tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
  * 
- * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
- * @throw IllegalArgumentException - When the destination size at the dimension is to small.
- * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ * @return The number of recomputed regions, `0` when nothing changed.
+ * 
+ * @see #executeChangedConvolution(const void* tensor, const void* previous, const void* kernel,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const WinogradKernel* winograd, const SeparableKernel* separable)
  */
-void IntegerTensor_convolve(const IntegerTensor* tensor,
-    const IntegerTensor* kernel, const IntegerTensor* dest, const int stride) {
-    (void)convolve(tensor, kernel, dest, stride, _TENSOR_TYPE_INTEGER_);
+int IntegerTensor_convolveChanges(const IntegerTensor* tensor, const IntegerTensor* previous, const IntegerTensor* kernel,
+    const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    return executeChangedConvolution(tensor, previous, kernel, dest, settings, _TENSOR_TYPE_INTEGER_, false,
+            NULL, NULL);
 }
 
 /**
- * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * Detects the changes of the tensor against its previous values and
+ * recomputes only the outputs of a convolution, that read them. The
+ * changed values are copied into the previous tensor.
  * 
- * @param *tensor   Tensor to convolve.
- * @param *kernel   Kernel to use.
- * @param *dest     Destination tensor in which to write the results.
- * @param stride    Stride of the kernel.
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *previous     Previous values of the tensor, whose convolution the destination holds.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination, that holds the outputs of the previous tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
  * 
- * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
- * @throw IllegalArgumentException - When the destination size at the dimension is to small.
- * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ * @return The number of recomputed regions, `0` when nothing changed.
+ * 
+ * @see #executeChangedConvolution(const void* tensor, const void* previous, const void* kernel,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const WinogradKernel* winograd, const SeparableKernel* separable)
  */
-void FloatTensor_convolve(const FloatTensor* tensor,
-    const FloatTensor* kernel, const FloatTensor* dest, const int stride) {
-    (void)convolve(tensor, kernel, dest, stride, _TENSOR_TYPE_FLOAT_);
+int FloatTensor_convolveChanges(const FloatTensor* tensor, const FloatTensor* previous, const FloatTensor* kernel,
+    const FloatTensor* dest, const ConvolutionSettings* settings) {
+    return executeChangedConvolution(tensor, previous, kernel, dest, settings, _TENSOR_TYPE_FLOAT_, false,
+            NULL, NULL);
 }
 
 /**
- * Executes a N-Dimensional convolution on a given tensor and kernel.
+ * Detects the changes of the tensor against its previous values and
+ * recomputes only the outputs of a convolution, that read them. The
+ * changed values are copied into the previous tensor.
  * 
- * @param *tensor   Tensor to convolve.
- * @param *kernel   Kernel to use.
- * @param *dest     Destination tensor in which to write the results.
- * @param stride    Stride of the kernel.
+ * @param *tensor       Tensor or batch (`N x ...`) to convolve.
+ * @param *previous     Previous values of the tensor, whose convolution the destination holds.
+ * @param *kernel       Kernel to use.
+ * @param *dest         Destination, that holds the outputs of the previous tensor.
+ * @param *settings     Stride, engine and padding of the convolution.
  * 
- * @throw IllegalArgumentException - When the dimensions of the tensor and kernel mismatch.
- * @throw IllegalArgumentException - When the destination size at the dimension is to small.
- * @throw NullPointerException - When either the tensor, kernel or the destination is `NULL`.
+ * @return The number of recomputed regions, `0` when nothing changed.
+ * 
+ * @see #executeChangedConvolution(const void* tensor, const void* previous, const void* kernel,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const WinogradKernel* winograd, const SeparableKernel* separable)
  */
-void DoubleTensor_convolve(const DoubleTensor* tensor,
-    const DoubleTensor* kernel, const DoubleTensor* dest, const int stride) {
-    (void)convolve(tensor, kernel, dest, stride, _TENSOR_TYPE_DOUBLE_);
+int DoubleTensor_convolveChanges(const DoubleTensor* tensor, const DoubleTensor* previous, const DoubleTensor* kernel,
+    const DoubleTensor* dest, const ConvolutionSettings* settings) {
+    return executeChangedConvolution(tensor, previous, kernel, dest, settings, _TENSOR_TYPE_DOUBLE_, false,
+            NULL, NULL);
 }
 
 /**
  * Creates a ConvolutionLayer based on the given parameters.
  * 
- * @param *kernel       Kernel to use for the convolution.
+ * <p><b>Note:</b><br>
+ * A single kernel is transformed for the Winograd engine and decomposed
+ * into 1D kernels, when it is rank-1, once at creation. Later changes of
+ * the kernel values are not reflected by these engines. The engine of a
+ * single kernel is tuned on the first forward pass of every input shape
+ * (`CONVOLUTION_ALGORITHM_TUNED`), filter banks always use the GEMM and
+ * depthwise kernels the direct walker.
+ * </p>
+ * 
+ * @param *kernel       Kernel, filter bank or depthwise kernel to use for the convolution.
+ * @param *pointwise    Optional pointwise filters (`C_out x C`) after a depthwise kernel.
  * @param *destination  Optional destination of the convolution values.
  * @param stride        Stride of the convolution.
+ * @param isFilterBank  Whether the kernel is a bank of filters (`C_out x C_in x ...`).
+ * @param isDepthwise   Whether the kernel has one channel per channel of the input (`C x ...`).
  * @param tensorType    Type of the tensors involved (all must be equal).
  * 
  * @throws NullPointerException - When the given kernel is `NULL`.
  * @throws IllegalArgumentException - When the stride is not a positive integer.
  */
-ConvolutionLayer* createConvolutionLayer(const void* kernel, const void* destination,
-    const int stride, const TensorType tensorType) {
+ConvolutionLayer* createConvolutionLayer(const void* kernel, const void* pointwise, const void* destination,
+    const int stride, const int isFilterBank, const int isDepthwise, const TensorType tensorType) {
     if (kernel == NULL) {
         (void)throwNullPointerException("Kernel of convolution must not be NULL!");
         return NULL;
@@ -499,6 +2770,26 @@ ConvolutionLayer* createConvolutionLayer(const void* kernel, const void* destina
     layer->base = base;
     layer->kernel = kernel;
     layer->stride = stride;
+    layer->algorithm = CONVOLUTION_ALGORITHM_TUNED;
+    layer->padding = CONVOLUTION_PADDING_VALID;
+    layer->paddingSize = 0;
+    layer->isFilterBank = isFilterBank;
+    layer->isDepthwise = isDepthwise;
+    layer->pointwise = pointwise;
+    layer->strides = NULL;
+    layer->dilations = NULL;
+    layer->winograd = NULL;
+    layer->separable = NULL;
+
+    if (isFilterBank == false && isDepthwise == false
+        && isWinogradApplicable((Tensor*)getTensorBaseByType(kernel, tensorType), tensorType, stride)) {
+        layer->winograd = (WinogradKernel*)createWinogradKernel(kernel, tensorType);
+    }
+
+    if (isFilterBank == false && isDepthwise == false) {
+        layer->separable = (SeparableKernel*)createSeparableKernel(kernel, tensorType);
+    }
+
     return layer;
 }
 
@@ -516,8 +2807,8 @@ ConvolutionLayer* createConvolutionLayer(const void* kernel, const void* destina
  */
 ConvolutionLayer* Integer_createConvolutionLayer(const IntegerTensor* kernel,
     const IntegerTensor* destination, const int stride) {
-    return (ConvolutionLayer*)createConvolutionLayer(kernel,
-        destination, stride, _TENSOR_TYPE_INTEGER_);
+    return (ConvolutionLayer*)createConvolutionLayer(kernel, NULL,
+        destination, stride, false, false, _TENSOR_TYPE_INTEGER_);
 }
 
 /**
@@ -534,8 +2825,8 @@ ConvolutionLayer* Integer_createConvolutionLayer(const IntegerTensor* kernel,
  */
 ConvolutionLayer* Float_createConvolutionLayer(const FloatTensor* kernel,
     const FloatTensor* destination, const int stride) {
-    return (ConvolutionLayer*)createConvolutionLayer(kernel,
-        destination, stride, _TENSOR_TYPE_FLOAT_);
+    return (ConvolutionLayer*)createConvolutionLayer(kernel, NULL,
+        destination, stride, false, false, _TENSOR_TYPE_FLOAT_);
 }
 
 /**
@@ -552,8 +2843,221 @@ ConvolutionLayer* Float_createConvolutionLayer(const FloatTensor* kernel,
  */
 ConvolutionLayer* Double_createConvolutionLayer(const DoubleTensor* kernel,
     const DoubleTensor* destination, const int stride) {
-    return (ConvolutionLayer*)createConvolutionLayer(kernel,
-        destination, stride, _TENSOR_TYPE_DOUBLE_);
+    return (ConvolutionLayer*)createConvolutionLayer(kernel, NULL,
+        destination, stride, false, false, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves its input with every filter of
+ * the given filter bank. The output of filter `n` is channel `n` of the
+ * destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param *filters      The filter bank (`C_out x C_in x ...`).
+ * @param *destination  Optional destination (`C_out x ...`) to which to write the results.
+ * @param stride        Stride of the convolution.
+ */
+ConvolutionLayer* Integer_createFilterConvolutionLayer(const IntegerTensor* filters,
+    const IntegerTensor* destination, const int stride) {
+    return (ConvolutionLayer*)createConvolutionLayer(filters, NULL,
+        destination, stride, true, false, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves its input with every filter of
+ * the given filter bank. The output of filter `n` is channel `n` of the
+ * destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param *filters      The filter bank (`C_out x C_in x ...`).
+ * @param *destination  Optional destination (`C_out x ...`) to which to write the results.
+ * @param stride        Stride of the convolution.
+ */
+ConvolutionLayer* Float_createFilterConvolutionLayer(const FloatTensor* filters,
+    const FloatTensor* destination, const int stride) {
+    return (ConvolutionLayer*)createConvolutionLayer(filters, NULL,
+        destination, stride, true, false, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves its input with every filter of
+ * the given filter bank. The output of filter `n` is channel `n` of the
+ * destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param *filters      The filter bank (`C_out x C_in x ...`).
+ * @param *destination  Optional destination (`C_out x ...`) to which to write the results.
+ * @param stride        Stride of the convolution.
+ */
+ConvolutionLayer* Double_createFilterConvolutionLayer(const DoubleTensor* filters,
+    const DoubleTensor* destination, const int stride) {
+    return (ConvolutionLayer*)createConvolutionLayer(filters, NULL,
+        destination, stride, true, false, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves every channel of its input
+ * with its own channel of the depthwise kernel. The output of channel `c`
+ * is channel `c` of the destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param *kernel       The depthwise kernel (`C x ...`).
+ * @param *destination  Optional destination (`C x ...`) to which to write the results.
+ * @param stride        Stride of the convolution.
+ */
+ConvolutionLayer* Integer_createDepthwiseConvolutionLayer(const IntegerTensor* kernel,
+    const IntegerTensor* destination, const int stride) {
+    return (ConvolutionLayer*)createConvolutionLayer(kernel, NULL,
+        destination, stride, false, true, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves every channel of its input
+ * with its own channel of the depthwise kernel. The output of channel `c`
+ * is channel `c` of the destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param *kernel       The depthwise kernel (`C x ...`).
+ * @param *destination  Optional destination (`C x ...`) to which to write the results.
+ * @param stride        Stride of the convolution.
+ */
+ConvolutionLayer* Float_createDepthwiseConvolutionLayer(const FloatTensor* kernel,
+    const FloatTensor* destination, const int stride) {
+    return (ConvolutionLayer*)createConvolutionLayer(kernel, NULL,
+        destination, stride, false, true, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves every channel of its input
+ * with its own channel of the depthwise kernel. The output of channel `c`
+ * is channel `c` of the destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param *kernel       The depthwise kernel (`C x ...`).
+ * @param *destination  Optional destination (`C x ...`) to which to write the results.
+ * @param stride        Stride of the convolution.
+ */
+ConvolutionLayer* Double_createDepthwiseConvolutionLayer(const DoubleTensor* kernel,
+    const DoubleTensor* destination, const int stride) {
+    return (ConvolutionLayer*)createConvolutionLayer(kernel, NULL,
+        destination, stride, false, true, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves every channel of its input
+ * with its own channel of the depthwise kernel and combines the channels
+ * with the pointwise (1x1) filters. The output of filter `n` is channel
+ * `n` of the destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The depthwise outputs are combined while they are in the cache, they are
+ * never written to a tensor. The destination must not be initialized and
+ * can be set to `NULL`. When set to `NULL` the used Network will generate
+ * the destination automatically.
+ * </p>
+ * 
+ * @param *depthwise    The depthwise kernel (`C x ...`).
+ * @param *pointwise    The pointwise filters (`C_out x C`).
+ * @param *destination  Optional destination (`C_out x ...`) to which to write the results.
+ * @param stride        Stride of the depthwise convolution.
+ * 
+ * @throws NullPointerException - When the pointwise filters are `NULL`.
+ */
+ConvolutionLayer* Integer_createDepthwiseSeparableLayer(const IntegerTensor* depthwise,
+    const IntegerTensor* pointwise, const IntegerTensor* destination, const int stride) {
+    if (pointwise == NULL) {
+        (void)throwNullPointerException("The pointwise filters must not be NULL.");
+        return NULL;
+    }
+
+    return (ConvolutionLayer*)createConvolutionLayer(depthwise, pointwise,
+        destination, stride, false, true, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves every channel of its input
+ * with its own channel of the depthwise kernel and combines the channels
+ * with the pointwise (1x1) filters. The output of filter `n` is channel
+ * `n` of the destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The depthwise outputs are combined while they are in the cache, they are
+ * never written to a tensor. The destination must not be initialized and
+ * can be set to `NULL`. When set to `NULL` the used Network will generate
+ * the destination automatically.
+ * </p>
+ * 
+ * @param *depthwise    The depthwise kernel (`C x ...`).
+ * @param *pointwise    The pointwise filters (`C_out x C`).
+ * @param *destination  Optional destination (`C_out x ...`) to which to write the results.
+ * @param stride        Stride of the depthwise convolution.
+ * 
+ * @throws NullPointerException - When the pointwise filters are `NULL`.
+ */
+ConvolutionLayer* Float_createDepthwiseSeparableLayer(const FloatTensor* depthwise,
+    const FloatTensor* pointwise, const FloatTensor* destination, const int stride) {
+    if (pointwise == NULL) {
+        (void)throwNullPointerException("The pointwise filters must not be NULL.");
+        return NULL;
+    }
+
+    return (ConvolutionLayer*)createConvolutionLayer(depthwise, pointwise,
+        destination, stride, false, true, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a ConvolutionLayer, that convolves every channel of its input
+ * with its own channel of the depthwise kernel and combines the channels
+ * with the pointwise (1x1) filters. The output of filter `n` is channel
+ * `n` of the destination.
+ * 
+ * <p><b>Note:</b><br>
+ * The depthwise outputs are combined while they are in the cache, they are
+ * never written to a tensor. The destination must not be initialized and
+ * can be set to `NULL`. When set to `NULL` the used Network will generate
+ * the destination automatically.
+ * </p>
+ * 
+ * @param *depthwise    The depthwise kernel (`C x ...`).
+ * @param *pointwise    The pointwise filters (`C_out x C`).
+ * @param *destination  Optional destination (`C_out x ...`) to which to write the results.
+ * @param stride        Stride of the depthwise convolution.
+ * 
+ * @throws NullPointerException - When the pointwise filters are `NULL`.
+ */
+ConvolutionLayer* Double_createDepthwiseSeparableLayer(const DoubleTensor* depthwise,
+    const DoubleTensor* pointwise, const DoubleTensor* destination, const int stride) {
+    if (pointwise == NULL) {
+        (void)throwNullPointerException("The pointwise filters must not be NULL.");
+        return NULL;
+    }
+
+    return (ConvolutionLayer*)createConvolutionLayer(depthwise, pointwise,
+        destination, stride, false, true, _TENSOR_TYPE_DOUBLE_);
 }
 
 /**
@@ -565,8 +3069,6 @@ ConvolutionLayer* Double_createConvolutionLayer(const DoubleTensor* kernel,
 void initDestinationTensor(const ConvolutionLayer* layer, const void* inputTensor) {
     const Tensor* input_base = (Tensor*)getTensorBaseByType(inputTensor, layer->base->inputType);
     const Tensor* kernel_base = (Tensor*)getTensorBaseByType(layer->kernel, layer->base->inputType);
-    const int stride = layer->stride;
-
     int* shape = (int*)calloc(input_base->dimensions, sizeof(int));
 
     if (shape == NULL) {
@@ -574,11 +3076,30 @@ void initDestinationTensor(const ConvolutionLayer* layer, const void* inputTenso
         return;
     }
 
+    // A batch has one dimension more than a single input, it keeps its frames.
+    const int kernelDims = layer->isFilterBank ? kernel_base->dimensions - 1 : kernel_base->dimensions;
+    const int batch = input_base->dimensions == kernelDims + 1 ? 1 : 0;
+
     for (int i = 0; i < input_base->dimensions; i++) {
-        const int input_size = input_base->shape[i];
-        const int kernel_size = kernel_base->shape[i];
-        const int output_size = (input_size - kernel_size) / stride + 1;
-        shape[i] = output_size;
+        const int dim = i - batch;
+        const int stride = dim >= 0 && layer->strides != NULL ? layer->strides[dim] : layer->stride;
+        const int dilation = dim >= 0 && layer->dilations != NULL ? layer->dilations[dim] : 1;
+        int before = 0;
+
+        if (dim < 0) {
+            shape[i] = input_base->shape[i];
+        } else if (layer->isDepthwise && dim == 0) {
+            const Tensor* pointwise_base = layer->pointwise == NULL ? NULL :
+                                            (Tensor*)getTensorBaseByType(layer->pointwise, layer->base->inputType);
+            shape[i] = pointwise_base == NULL ? kernel_base->shape[0] : pointwise_base->shape[0];
+        } else if (layer->isFilterBank) {
+            shape[i] = dim == 0 ? kernel_base->shape[0] : computeConvolutionOutputSize(input_base->shape[i],
+                        (kernel_base->shape[dim + 1] - 1) * dilation + 1, stride,
+                        layer->padding, layer->paddingSize, &before);
+        } else {
+            shape[i] = computeConvolutionOutputSize(input_base->shape[i], (kernel_base->shape[dim] - 1) * dilation + 1,
+                        stride, layer->padding, layer->paddingSize, &before);
+        }
     }
 
     switch (layer->base->inputType) {
@@ -592,6 +3113,83 @@ void initDestinationTensor(const ConvolutionLayer* layer, const void* inputTenso
         layer->base->destination = (DoubleTensor*)DoubleTensor_zeros(input_base->dimensions, shape);
         break;
     }
+
+    (void)free(shape);
+}
+
+/**
+ * Sets the engine, that executes the convolutions of the given layer. By
+ * default the layer tunes its engine (`CONVOLUTION_ALGORITHM_TUNED`).
+ * 
+ * @param *layer        The ConvolutionLayer.
+ * @param algorithm     The engine to use.
+ */
+void ConvolutionLayer_setAlgorithm(ConvolutionLayer* layer, const ConvolutionAlgorithm algorithm) {
+    layer->algorithm = algorithm;
+}
+
+/**
+ * Sets the padding of the convolutions of the given layer.
+ * 
+ * <p><b>Note:</b><br>
+ * Must be set before the first forward pass, when the destination is
+ * generated automatically.
+ * </p>
+ * 
+ * @param *layer        The ConvolutionLayer.
+ * @param padding       Values, that are read outside of the tensor.
+ * @param paddingSize   Padded elements before and after every dimension or `CONVOLUTION_PADDING_SAME`.
+ */
+void ConvolutionLayer_setPadding(ConvolutionLayer* layer, const ConvolutionPadding padding, const int paddingSize) {
+    layer->padding = padding;
+    layer->paddingSize = paddingSize;
+}
+
+/**
+ * Sets the per-dimension strides and the dilations of the kernel of the
+ * given layer. Every array holds one value for each dimension of the kernel
+ * (of a filter of the filter bank), `NULL` resets it to the stride of the
+ * layer and to undilated kernels.
+ * 
+ * <p><b>Note:</b><br>
+ * Must be set before the first forward pass, when the destination is
+ * generated automatically.
+ * </p>
+ * 
+ * @param *layer        The ConvolutionLayer.
+ * @param *strides      Optional stride of every dimension.
+ * @param *dilations    Optional dilation of every dimension.
+ * 
+ * @throws IllegalArgumentException - When a stride or dilation is not a positive integer.
+ */
+void ConvolutionLayer_setStrides(ConvolutionLayer* layer, const int* strides, const int* dilations) {
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(layer->kernel, layer->base->inputType);
+    const int dims = layer->isFilterBank ? kernelBase->dimensions - 1 : kernelBase->dimensions;
+
+    for (int i = 0; i < dims; i++) {
+        if ((strides != NULL && strides[i] <= 0) || (dilations != NULL && dilations[i] <= 0)) {
+            (void)throwIllegalArgumentException("Strides and dilations must be positive integers.");
+            return;
+        }
+    }
+
+    int* stridesCopy = strides != NULL ? (int*)malloc(dims * sizeof(int)) : NULL;
+    int* dilationsCopy = dilations != NULL ? (int*)malloc(dims * sizeof(int)) : NULL;
+
+    if ((strides != NULL && stridesCopy == NULL) || (dilations != NULL && dilationsCopy == NULL)) {
+        if (stridesCopy != NULL) (void)free(stridesCopy);
+        if (dilationsCopy != NULL) (void)free(dilationsCopy);
+        (void)throwMemoryAllocationException("While trying to copy the strides of the ConvolutionLayer.");
+        return;
+    }
+
+    if (stridesCopy != NULL) (void)memcpy(stridesCopy, strides, dims * sizeof(int));
+    if (dilationsCopy != NULL) (void)memcpy(dilationsCopy, dilations, dims * sizeof(int));
+    if (layer->strides != NULL) (void)free(layer->strides);
+    if (layer->dilations != NULL) (void)free(layer->dilations);
+
+    layer->strides = stridesCopy;
+    layer->dilations = dilationsCopy;
 }
 
 /**
@@ -606,7 +3204,7 @@ void initDestinationTensor(const ConvolutionLayer* layer, const void* inputTenso
  * </p>
  * 
  * @param *layer    The ConvolutionLayer with all parameters for the convolution.
- * @param *input    Pointer to the input that should be convolved.
+ * @param *input    Pointer to the input (or batch `N x ...` of inputs) that should be convolved.
  * 
  * @throws IllegalArgumentException - When the ConvolutionLayer has no fixed destination,
  * but the destination pointer is `NULL`.
@@ -616,20 +3214,103 @@ void ConvolutionLayer_forward(const ConvolutionLayer* layer, const void* input)
         (void)initDestinationTensor(layer, input);
     }
 
-    switch (layer->base->inputType) {
-    case _TENSOR_TYPE_INTEGER_:
-        (void)IntegerTensor_convolve((IntegerTensor*)input, (IntegerTensor*)layer->kernel,
-            (IntegerTensor*)layer->base->destination, layer->stride);
-        break;
-    case _TENSOR_TYPE_FLOAT_:
-        (void)FloatTensor_convolve((FloatTensor*)input, (FloatTensor*)layer->kernel,
-                (FloatTensor*)layer->base->destination, layer->stride);
-        break;
-    case _TENSOR_TYPE_DOUBLE_:
-        (void)DoubleTensor_convolve((DoubleTensor*)input, (DoubleTensor*)layer->kernel,
-                (DoubleTensor*)layer->base->destination, layer->stride);
-        break;
+    const ConvolutionSettings settings = {layer->stride, layer->algorithm, layer->padding, layer->paddingSize,
+        layer->strides, layer->dilations};
+
+    if (layer->isFilterBank) {
+        (void)executeFilterConvolution(input, layer->kernel, layer->base->destination,
+            &settings, layer->base->inputType);
+        return;
+    } else if (layer->isDepthwise) {
+        (void)executeDepthwiseConvolution(input, layer->kernel, layer->pointwise, layer->base->destination,
+            &settings, layer->base->inputType);
+        return;
+    }
+
+    (void)executeConvolution(input, layer->kernel, layer->base->destination,
+        &settings, layer->base->inputType, layer->winograd, layer->separable);
+}
+
+/**
+ * Recomputes the outputs of the ConvolutionLayer, that read at least one of
+ * the given changed regions of the input. The destination must hold the
+ * output of the input before the changes, only a layer without destination
+ * and a depthwise layer convolve the whole input.
+ * 
+ * @param *layer    The ConvolutionLayer with all parameters for the convolution.
+ * @param *input    The changed input (or batch `N x ...` of inputs).
+ * @param *regions  The changed regions.
+ * @param count     Number of regions.
+ * 
+ * @see #executeRegionConvolution(const void* tensor, const void* kernel, const void* dest,
+    const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const ConvolutionRegion* regions, const int count, const WinogradKernel* winograd,
+    const SeparableKernel* separable)
+ */
+void ConvolutionLayer_forwardRegions(const ConvolutionLayer* layer, const void* input,
+    const ConvolutionRegion* regions, const int count) {
+    if (layer->base->destination == NULL || layer->isDepthwise) {
+        (void)ConvolutionLayer_forward(layer, input);
+        return;
     }
+
+    const ConvolutionSettings settings = {layer->stride, layer->algorithm, layer->padding, layer->paddingSize,
+        layer->strides, layer->dilations};
+    (void)executeRegionConvolution(input, layer->kernel, layer->base->destination, &settings,
+        layer->base->inputType, layer->isFilterBank, regions, count, layer->winograd, layer->separable);
+}
+
+/**
+ * Detects the changes of the input against the previous input and
+ * recomputes only the outputs of the ConvolutionLayer, that read them
+ * (e.g. the moving parts of a video frame). The changed values are copied
+ * into the previous input, so it can be passed again with the next input.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must hold the output of the previous input. A layer
+ * without destination convolves the whole input and copies it into the
+ * previous input, which starts the sequence. A depthwise layer always
+ * convolves the whole input.
+ * </p>
+ * 
+ * @param *layer    The ConvolutionLayer with all parameters for the convolution.
+ * @param *input    The input (or batch `N x ...` of inputs).
+ * @param *previous The previous input of the same shape.
+ * 
+ * @return The number of recomputed regions, `0` when nothing changed.
+ * 
+ * @see #executeChangedConvolution(const void* tensor, const void* previous, const void* kernel,
+    const void* dest, const ConvolutionSettings* settings, const TensorType tensorType, const int isFilterBank,
+    const WinogradKernel* winograd, const SeparableKernel* separable)
+ */
+int ConvolutionLayer_forwardChanges(const ConvolutionLayer* layer, const void* input, const void* previous) {
+    const TensorType tensorType = layer->base->inputType;
+
+    if ((layer->base->destination == NULL || layer->isDepthwise) && input != NULL && previous != NULL) {
+        const Tensor* inputBase = (Tensor*)getTensorBaseByType(input, tensorType);
+        const Tensor* previousBase = (Tensor*)getTensorBaseByType(previous, tensorType);
+        int* origin = (int*)calloc(inputBase->dimensions, sizeof(int));
+
+        if (origin == NULL) {
+            (void)throwMemoryAllocationException("Error on allocating memory for the origin (convolution).");
+            return 0;
+        } else if (previousBase->dimensions != inputBase->dimensions
+            || memcmp(inputBase->shape, previousBase->shape, inputBase->dimensions * sizeof(int)) != 0) {
+            (void)free(origin);
+            (void)throwIllegalArgumentException("The previous tensor must have the shape of the tensor.");
+            return 0;
+        }
+
+        (void)ConvolutionLayer_forward(layer, input);
+        (void)copyTensorBox(input, origin, previous, origin, inputBase->shape, CONVOLUTION_PADDING_VALID, tensorType);
+        (void)free(origin);
+        return 1;
+    }
+
+    const ConvolutionSettings settings = {layer->stride, layer->algorithm, layer->padding, layer->paddingSize,
+        layer->strides, layer->dilations};
+    return executeChangedConvolution(input, previous, layer->kernel, layer->base->destination, &settings,
+            tensorType, layer->isFilterBank, layer->winograd, layer->separable);
 }
 
 /**
@@ -643,5 +3324,9 @@ void ConvolutionLayer_free(ConvolutionLayer* layer) {
     }
 
     (void)freeLayer(layer->base);
+    (void)freeWinogradKernel(layer->winograd);
+    (void)freeSeparableKernel(layer->separable);
+    if (layer->strides != NULL) (void)free(layer->strides);
+    if (layer->dilations != NULL) (void)free(layer->dilations);
     (void)free(layer);
 }
\ No newline at end of file
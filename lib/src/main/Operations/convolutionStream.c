@@ -0,0 +1,438 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Tensor/view.h"
+#include "Operations/convolution.h"
+#include "Operations/convolutionStream.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Size in bytes, up to which the ring buffer holds additional slices beyond
+ * the last window. Small slices (e.g. audio samples) are convolved in chunks
+ * of many slices, large slices (frames) one by one.
+ */
+#define CONVOLUTION_STREAM_CHUNK_BYTES 65536
+
+/**
+ * Creates a ConvolutionStream for the given kernel. The ring buffer is
+ * allocated on the first push, when the shape of the slices is known.
+ * 
+ * @param *kernel       The kernel, its leading size is the length of a window in slices.
+ * @param stride        Stride of the kernel in every dimension.
+ * @param tensorType    Type of the kernel.
+ * 
+ * @return The new stream.
+ * 
+ * @throw NullPointerException - When the kernel is `NULL`.
+ * @throw IllegalArgumentException - When the stride is not positive.
+ */
+static ConvolutionStream* createConvolutionStream(const void* kernel, const int stride, const TensorType tensorType) {
+    if (kernel == NULL) {
+        (void)throwNullPointerException("The kernel of a convolution stream must not be NULL.");
+        return NULL;
+    } else if (stride < 1) {
+        (void)throwIllegalArgumentException("The stride of a convolution must be positive.");
+        return NULL;
+    }
+
+    ConvolutionStream* stream = (ConvolutionStream*)calloc(1, sizeof(ConvolutionStream));
+
+    if (stream == NULL) {
+        (void)throwMemoryAllocationException("While trying to create a convolution stream.");
+        return NULL;
+    }
+
+    stream->tensorType = tensorType;
+    stream->kernel = kernel;
+    stream->stride = stride;
+    return stream;
+}
+
+/**
+ * Creates a ConvolutionStream, that convolves a stream of slices along the
+ * leading axis with the given kernel.
+ * 
+ * @param *kernel   The kernel (`K x ...`), a window spans `K` slices.
+ * @param stride    Stride of the kernel in every dimension.
+ * 
+ * @return The new stream.
+ */
+ConvolutionStream* Integer_createConvolutionStream(const IntegerTensor* kernel, const int stride) {
+    return createConvolutionStream(kernel, stride, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a ConvolutionStream, that convolves a stream of slices along the
+ * leading axis with the given kernel.
+ * 
+ * @param *kernel   The kernel (`K x ...`), a window spans `K` slices.
+ * @param stride    Stride of the kernel in every dimension.
+ * 
+ * @return The new stream.
+ */
+ConvolutionStream* Float_createConvolutionStream(const FloatTensor* kernel, const int stride) {
+    return createConvolutionStream(kernel, stride, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a ConvolutionStream, that convolves a stream of slices along the
+ * leading axis with the given kernel.
+ * 
+ * @param *kernel   The kernel (`K x ...`), a window spans `K` slices.
+ * @param stride    Stride of the kernel in every dimension.
+ * 
+ * @return The new stream.
+ */
+ConvolutionStream* Double_createConvolutionStream(const DoubleTensor* kernel, const int stride) {
+    return createConvolutionStream(kernel, stride, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Gets the number of outputs, that a push of the given number of slices
+ * emits. It is the minimum leading size of the destination of the push.
+ * 
+ * @param *stream   The stream.
+ * @param slices    Number of slices to push.
+ * 
+ * @return The number of emitted outputs.
+ */
+int ConvolutionStream_getReadyOutputs(const ConvolutionStream* stream, const int slices) {
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(stream->kernel, stream->tensorType);
+    const size_t total = stream->slices + slices;
+    const size_t window = kernelBase->shape[0];
+
+    if (total < window) {
+        return 0;
+    }
+
+    return (int)((total - window) / stream->stride + 1 - stream->outputs);
+}
+
+/**
+ * Allocates the ring buffer of the stream for slices of the given shape.
+ * 
+ * @param *stream       The stream.
+ * @param *slicesBase   Base of the first pushed slices.
+ * 
+ * @return `true` on success, `false` if not.
+ */
+static int initConvolutionStreamBuffer(ConvolutionStream* stream, const Tensor* slicesBase) {
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(stream->kernel, stream->tensorType);
+    const int dims = kernelBase->dimensions;
+    const size_t elementSize = stream->tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    size_t sliceSize = 1;
+
+    for (int dim = 1; dim < dims; dim++) {
+        if (kernelBase->shape[dim] > slicesBase->shape[dim]) {
+            (void)throwIllegalArgumentException("The kernel does not fit into the slices of the stream.");
+            return false;
+        }
+
+        sliceSize *= slicesBase->shape[dim];
+    }
+
+    // The last window plus at least one new slice, and more for small slices.
+    const size_t chunk = CONVOLUTION_STREAM_CHUNK_BYTES / (sliceSize * elementSize);
+    stream->capacity = kernelBase->shape[0] - 1 + (chunk < 1 ? 1 : (int)chunk);
+
+    int* shape = (int*)malloc(dims * sizeof(int));
+
+    if (shape == NULL) {
+        (void)throwMemoryAllocationException("While trying to create the buffer of a convolution stream.");
+        return false;
+    }
+
+    (void)memcpy(shape, slicesBase->shape, dims * sizeof(int));
+    shape[0] = 2 * stream->capacity;
+
+    switch (stream->tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        stream->buffer = IntegerTensor_zeros(dims, shape);
+        break;
+    case _TENSOR_TYPE_FLOAT_:
+        stream->buffer = FloatTensor_zeros(dims, shape);
+        break;
+    case _TENSOR_TYPE_DOUBLE_:
+        stream->buffer = DoubleTensor_zeros(dims, shape);
+        break;
+    }
+
+    (void)free(shape);
+    return stream->buffer != NULL ? true : false;
+}
+
+/**
+ * Copies slices into both places of the ring buffer.
+ * 
+ * @param *stream   The stream.
+ * @param *slices   The pushed slices, can be a strided view.
+ * @param first     Index of the first slice to copy.
+ * @param count     Number of slices to copy.
+ */
+static void copyIntoConvolutionStream(ConvolutionStream* stream, const void* slices, const int first, const int count) {
+    const Tensor* slicesBase = (Tensor*)getTensorBaseByType(slices, stream->tensorType);
+    const char* source = (const char*)getTensorDataByType(slices, stream->tensorType);
+    char* buffer = (char*)getTensorDataByType(stream->buffer, stream->tensorType);
+    const size_t elementSize = stream->tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    const size_t sliceSize = slicesBase->dataPoints / slicesBase->shape[0];
+    const size_t sliceBytes = sliceSize * elementSize;
+    const int contiguous = Tensor_isContiguous(slicesBase);
+
+    for (int i = 0; i < count; i++) {
+        const size_t position = (stream->slices + i) % stream->capacity;
+        char* target = buffer + position * sliceBytes;
+        const size_t index = (size_t)(first + i) * sliceSize;
+
+        if (contiguous) {
+            (void)memcpy(target, source + index * elementSize, sliceBytes);
+        } else {
+            for (size_t e = 0; e < sliceSize; e++) {
+                (void)memcpy(target + e * elementSize,
+                    source + Tensor_getElementOffset(slicesBase, index + e) * elementSize, elementSize);
+            }
+        }
+
+        (void)memcpy(target + stream->capacity * sliceBytes, target, sliceBytes);
+    }
+}
+
+/**
+ * Convolves the windows of the next outputs, that lie contiguous in the
+ * ring buffer, into the destination.
+ * 
+ * @param *stream   The stream.
+ * @param *dest     Destination of the push.
+ * @param written   Number of outputs already written to the destination by this push.
+ * @param count     Number of outputs to compute.
+ */
+static void convolveConvolutionStream(ConvolutionStream* stream, const void* dest, const int written, const int count) {
+    const TensorType tensorType = stream->tensorType;
+    const Tensor* bufferBase = (Tensor*)getTensorBaseByType(stream->buffer, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(stream->kernel, tensorType);
+    const int dims = bufferBase->dimensions;
+    const size_t sliceSize = bufferBase->dataPoints / bufferBase->shape[0];
+    const size_t start = stream->outputs * stream->stride;
+    int* shapes = (int*)malloc(2 * dims * sizeof(int));
+
+    if (shapes == NULL) {
+        (void)throwMemoryAllocationException("While trying to convolve a convolution stream.");
+        return;
+    }
+
+    (void)memcpy(shapes, bufferBase->shape, dims * sizeof(int));
+    (void)memcpy(shapes + dims, destBase->shape, dims * sizeof(int));
+    shapes[0] = (count - 1) * stream->stride + kernelBase->shape[0];
+    shapes[dims] = count;
+
+    void* window = createTensorView(stream->buffer, dims, shapes, bufferBase->strides,
+                    (start % stream->capacity) * sliceSize, tensorType);
+    void* outputs = createTensorView(dest, dims, shapes + dims, destBase->strides,
+                    (size_t)written * destBase->strides[0], tensorType);
+
+    if (window != NULL && outputs != NULL) {
+        switch (tensorType) {
+        case _TENSOR_TYPE_INTEGER_:
+            (void)IntegerTensor_convolve(window, stream->kernel, outputs, stream->stride);
+            break;
+        case _TENSOR_TYPE_FLOAT_:
+            (void)FloatTensor_convolve(window, stream->kernel, outputs, stream->stride);
+            break;
+        case _TENSOR_TYPE_DOUBLE_:
+            (void)DoubleTensor_convolve(window, stream->kernel, outputs, stream->stride);
+            break;
+        }
+    }
+
+    if (window != NULL) (void)freeTensorByType(window, tensorType);
+    if (outputs != NULL) (void)freeTensorByType(outputs, tensorType);
+    (void)free(shapes);
+}
+
+/**
+ * Pushes the next slices into the stream and writes the outputs, whose
+ * window became complete.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The slices are copied into a ring buffer, that stores every slice twice
+ * (at `t % capacity` and `t % capacity + capacity`), so the windows of the
+ * new outputs are always contiguous and are convolved by the regular
+ * convolution engines in one call. Earlier outputs are never recomputed,
+ * the work per slice is independent of the length of the stream.
+ * </p>
+ * 
+ * @param *stream       The stream.
+ * @param *slices       The next slices (`n x ...`), can be a strided view.
+ * @param *dest         Destination (`m x ...` with `m >= ConvolutionStream_getReadyOutputs(stream, n)`),
+ *                      can be `NULL` when the push emits no outputs.
+ * @param tensorType    Type of the tensors.
+ * 
+ * @return The number of outputs written to the destination.
+ * 
+ * @throw NullPointerException - When the stream or the slices are `NULL`, or the destination is needed.
+ * @throw IllegalArgumentException - When the slices do not match the kernel or the earlier slices.
+ * @throw IllegalArgumentException - When the destination has less than the emitted outputs.
+ */
+static int pushConvolutionStream(ConvolutionStream* stream, const void* slices, const void* dest,
+    const TensorType tensorType) {
+    if (stream == NULL || slices == NULL) {
+        (void)throwNullPointerException("The stream and the slices must not be NULL.");
+        return 0;
+    }
+
+    const Tensor* slicesBase = (Tensor*)getTensorBaseByType(slices, tensorType);
+    const Tensor* kernelBase = (Tensor*)getTensorBaseByType(stream->kernel, tensorType);
+    const int dims = kernelBase->dimensions;
+
+    if (stream->tensorType != tensorType || slicesBase->dimensions != dims) {
+        (void)throwIllegalArgumentException("The slices must have the type and dimensions of the kernel.");
+        return 0;
+    } else if (stream->buffer == NULL && initConvolutionStreamBuffer(stream, slicesBase) == false) {
+        return 0;
+    }
+
+    const Tensor* bufferBase = (Tensor*)getTensorBaseByType(stream->buffer, tensorType);
+
+    if (memcmp(bufferBase->shape + 1, slicesBase->shape + 1, (dims - 1) * sizeof(int)) != 0) {
+        (void)throwIllegalArgumentException("All slices of a stream must have the same shape.");
+        return 0;
+    }
+
+    const int ready = ConvolutionStream_getReadyOutputs(stream, slicesBase->shape[0]);
+
+    if (ready > 0 && dest == NULL) {
+        (void)throwNullPointerException("The destination must not be NULL, when the push emits outputs.");
+        return 0;
+    } else if (ready > 0) {
+        const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+
+        if (destBase->dimensions != dims || destBase->shape[0] < ready) {
+            (void)throwIllegalArgumentException("The destination has less outputs than the push emits.");
+            return 0;
+        }
+    }
+
+    // At most this many new slices fit next to the last window.
+    const int chunk = stream->capacity - (kernelBase->shape[0] - 1);
+    int written = 0;
+
+    for (int first = 0; first < slicesBase->shape[0]; first += chunk) {
+        const int count = slicesBase->shape[0] - first < chunk ? slicesBase->shape[0] - first : chunk;
+        const int outputs = ConvolutionStream_getReadyOutputs(stream, count);
+
+        (void)copyIntoConvolutionStream(stream, slices, first, count);
+        stream->slices += count;
+
+        if (outputs > 0) {
+            (void)convolveConvolutionStream(stream, dest, written, outputs);
+            stream->outputs += outputs;
+            written += outputs;
+        }
+    }
+
+    return written;
+}
+
+/**
+ * Pushes the next slices into the stream and writes the outputs, whose
+ * window became complete.
+ * 
+ * @param *stream   The stream.
+ * @param *slices   The next slices (`n x ...`).
+ * @param *dest     Destination with at least `ConvolutionStream_getReadyOutputs(stream, n)` outputs.
+ * 
+ * @return The number of outputs written to the destination.
+ * 
+ * @see #pushConvolutionStream(ConvolutionStream* stream, const void* slices, const void* dest,
+    const TensorType tensorType)
+ */
+int Integer_ConvolutionStream_push(ConvolutionStream* stream, const IntegerTensor* slices,
+    const IntegerTensor* dest) {
+    return pushConvolutionStream(stream, slices, dest, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Pushes the next slices into the stream and writes the outputs, whose
+ * window became complete.
+ * 
+ * @param *stream   The stream.
+ * @param *slices   The next slices (`n x ...`).
+ * @param *dest     Destination with at least `ConvolutionStream_getReadyOutputs(stream, n)` outputs.
+ * 
+ * @return The number of outputs written to the destination.
+ * 
+ * @see #pushConvolutionStream(ConvolutionStream* stream, const void* slices, const void* dest,
+    const TensorType tensorType)
+ */
+int Float_ConvolutionStream_push(ConvolutionStream* stream, const FloatTensor* slices,
+    const FloatTensor* dest) {
+    return pushConvolutionStream(stream, slices, dest, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Pushes the next slices into the stream and writes the outputs, whose
+ * window became complete.
+ * 
+ * @param *stream   The stream.
+ * @param *slices   The next slices (`n x ...`).
+ * @param *dest     Destination with at least `ConvolutionStream_getReadyOutputs(stream, n)` outputs.
+ * 
+ * @return The number of outputs written to the destination.
+ * 
+ * @see #pushConvolutionStream(ConvolutionStream* stream, const void* slices, const void* dest,
+    const TensorType tensorType)
+ */
+int Double_ConvolutionStream_push(ConvolutionStream* stream, const DoubleTensor* slices,
+    const DoubleTensor* dest) {
+    return pushConvolutionStream(stream, slices, dest, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Restarts the stream, the buffered slices are discarded. The ring buffer
+ * is kept, the next slices must have the same shape.
+ * 
+ * @param *stream   The stream to reset.
+ */
+void ConvolutionStream_reset(ConvolutionStream* stream) {
+    stream->slices = 0;
+    stream->outputs = 0;
+}
+
+/**
+ * Frees the stream and its ring buffer, the kernel is not freed.
+ * 
+ * @param *stream   The stream to free.
+ */
+void ConvolutionStream_free(ConvolutionStream* stream) {
+    if (stream == NULL) {
+        return;
+    }
+
+    if (stream->buffer != NULL) (void)freeTensorByType(stream->buffer, stream->tensorType);
+    (void)free(stream);
+}
\ No newline at end of file
@@ -0,0 +1,888 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Operations/pooling.h"
+#include "Operations/simd.h"
+#include "Network/layer.h"
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Number of outputs, that a thread computes at least per task.
+ */
+#define POOLING_GRAIN_OUTPUTS 4096
+
+/**
+ * Number of independent sums over neighbouring values of a global average.
+ */
+#define POOLING_SUM_LANES 16
+
+/**
+ * Combines the values of the window at one kernel row into the outputs of
+ * an output row. The first kernel row initializes the outputs.
+ */
+typedef void (*PoolingRow)(void* output, const void* input, const int count, const ptrdiff_t step,
+    const ptrdiff_t tapStep, const int kernelWidth, const int first);
+
+/**
+ * Adds the values of a row onto a sum (`long long` for INTEGER, `double`
+ * for FLOAT and DOUBLE tensors).
+ */
+typedef void (*PoolingSum)(void* sum, const void* input, const int count, const ptrdiff_t step);
+
+/**
+ * Shared state of the threads of a windowed pooling.
+ */
+typedef struct {
+    const Tensor* tensorBase;
+    const char* input;
+    char* output;
+    const int* outputShape;
+    const int* strides;
+    const ptrdiff_t* rowOffsets;
+    int kernelRows;
+    int kernelWidth;
+    int outputWidth;
+    int window;
+    size_t elementSize;
+    TensorType tensorType;
+    PoolingRow row;
+    int average;
+} PoolingContext;
+
+/**
+ * Shared state of the threads of a global average pooling.
+ */
+typedef struct {
+    const Tensor* tensorBase;
+    const char* input;
+    char* output;
+    int keptDimensions;
+    size_t pooled;
+    size_t elementSize;
+    TensorType tensorType;
+    PoolingSum sum;
+} GlobalPoolingContext;
+
+#define POOLING_MAXIMUM(a, b) ((b) > (a) ? (b) : (a))
+#define POOLING_ADD(a, b) ((a) + (b))
+
+/**
+ * Generates the row function of one reduction, type and SIMD level.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The taps of the kernel row are combined in registers before an output is
+ * stored once, the loop over neighbouring outputs is vectorized. Unit steps
+ * and the common windows of 2 with a stride of 2 and of 3 with a stride of 1
+ * are compiled with constant sizes, so the taps are unrolled.
+ * </p>
+ */
+#define DEFINE_POOLING_ROW(name, attributes, type, COMBINE) \
+    attributes \
+    static inline void name##Outputs(type* restrict output, const type* restrict input, const int count, \
+        const ptrdiff_t step, const ptrdiff_t tapStep, const int kernelWidth, const int first) { \
+        for (int x = 0; x < count; x++) { \
+            const type* restrict window = input + x * step; \
+            type value = first ? window[0] : COMBINE(output[x], window[0]); \
+            for (int kx = 1; kx < kernelWidth; kx++) { \
+                value = COMBINE(value, window[kx * tapStep]); \
+            } \
+            output[x] = value; \
+        } \
+    } \
+    attributes \
+    static void name(void* output, const void* input, const int count, const ptrdiff_t step, \
+        const ptrdiff_t tapStep, const int kernelWidth, const int first) { \
+        if (tapStep == 1 && step == 2 && kernelWidth == 2) { \
+            name##Outputs((type*)output, (const type*)input, count, 2, 1, 2, first); \
+        } else if (tapStep == 1 && step == 1 && kernelWidth == 3) { \
+            name##Outputs((type*)output, (const type*)input, count, 1, 1, 3, first); \
+        } else if (tapStep == 1 && step == 1) { \
+            name##Outputs((type*)output, (const type*)input, count, 1, 1, kernelWidth, first); \
+        } else { \
+            name##Outputs((type*)output, (const type*)input, count, step, tapStep, kernelWidth, first); \
+        } \
+    }
+
+/**
+ * Generates the sum function of a global average for one type and SIMD
+ * level. Every lane sums every `POOLING_SUM_LANES`-th value, so the lanes
+ * are vectorized without reordering the additions of a single sum.
+ */
+#define DEFINE_POOLING_SUM(name, attributes, type, accumulator) \
+    attributes \
+    static inline accumulator name##Values(const type* restrict input, const int count, const ptrdiff_t step) { \
+        accumulator lanes[POOLING_SUM_LANES] = {0}; \
+        accumulator sum = 0; \
+        int x = 0; \
+        for (; x + POOLING_SUM_LANES <= count; x += POOLING_SUM_LANES) { \
+            for (int l = 0; l < POOLING_SUM_LANES; l++) { \
+                lanes[l] += input[(x + l) * step]; \
+            } \
+        } \
+        for (int l = 0; l < POOLING_SUM_LANES; l++) { \
+            sum += lanes[l]; \
+        } \
+        for (; x < count; x++) { \
+            sum += input[x * step]; \
+        } \
+        return sum; \
+    } \
+    attributes \
+    static void name(void* sum, const void* input, const int count, const ptrdiff_t step) { \
+        if (step == 1) { \
+            *(accumulator*)sum += name##Values((const type*)input, count, 1); \
+        } else { \
+            *(accumulator*)sum += name##Values((const type*)input, count, step); \
+        } \
+    }
+
+#define DEFINE_POOLING_KERNELS(suffix, attributes) \
+    DEFINE_POOLING_ROW(Integer_maxPoolRow##suffix, attributes, int, POOLING_MAXIMUM) \
+    DEFINE_POOLING_ROW(Float_maxPoolRow##suffix, attributes, float, POOLING_MAXIMUM) \
+    DEFINE_POOLING_ROW(Double_maxPoolRow##suffix, attributes, double, POOLING_MAXIMUM) \
+    DEFINE_POOLING_ROW(Integer_sumPoolRow##suffix, attributes, int, POOLING_ADD) \
+    DEFINE_POOLING_ROW(Float_sumPoolRow##suffix, attributes, float, POOLING_ADD) \
+    DEFINE_POOLING_ROW(Double_sumPoolRow##suffix, attributes, double, POOLING_ADD) \
+    DEFINE_POOLING_SUM(Integer_poolSum##suffix, attributes, int, long long) \
+    DEFINE_POOLING_SUM(Float_poolSum##suffix, attributes, float, double) \
+    DEFINE_POOLING_SUM(Double_poolSum##suffix, attributes, double, double)
+
+DEFINE_POOLING_KERNELS(, )
+
+#if defined(__x86_64__) || defined(__i386__)
+DEFINE_POOLING_KERNELS(_avx2, __attribute__((target("avx2"))))
+
+// AVX-512 implies FMA, the results should not depend on the SIMD level.
+DEFINE_POOLING_KERNELS(_avx512, __attribute__((target("avx512f"), optimize("fp-contract=off"))))
+#endif
+
+/**
+ * Selects the row function for the reduction, the type and the active SIMD
+ * level.
+ * 
+ * @param tensorType    Type of the tensors.
+ * @param maximum       Whether to take the maximum instead of the sum.
+ * 
+ * @return The row function.
+ */
+static PoolingRow selectPoolingRow(const TensorType tensorType, const int maximum) {
+    const SimdLevel level = getSimdLevel();
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? (maximum ? Integer_maxPoolRow_avx512 : Integer_sumPoolRow_avx512) :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? (maximum ? Float_maxPoolRow_avx512 : Float_sumPoolRow_avx512) :
+                (maximum ? Double_maxPoolRow_avx512 : Double_sumPoolRow_avx512);
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? (maximum ? Integer_maxPoolRow_avx2 : Integer_sumPoolRow_avx2) :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? (maximum ? Float_maxPoolRow_avx2 : Float_sumPoolRow_avx2) :
+                (maximum ? Double_maxPoolRow_avx2 : Double_sumPoolRow_avx2);
+    }
+#endif
+
+    (void)level;
+    return tensorType == _TENSOR_TYPE_INTEGER_ ? (maximum ? Integer_maxPoolRow : Integer_sumPoolRow) :
+            tensorType == _TENSOR_TYPE_FLOAT_ ? (maximum ? Float_maxPoolRow : Float_sumPoolRow) :
+            (maximum ? Double_maxPoolRow : Double_sumPoolRow);
+}
+
+/**
+ * Selects the sum function of a global average for the type and the active
+ * SIMD level.
+ * 
+ * @param tensorType    Type of the tensors.
+ * 
+ * @return The sum function.
+ */
+static PoolingSum selectPoolingSum(const TensorType tensorType) {
+    const SimdLevel level = getSimdLevel();
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (level >= SIMD_LEVEL_AVX512) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_poolSum_avx512 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_poolSum_avx512 : Double_poolSum_avx512;
+    } else if (level >= SIMD_LEVEL_AVX2) {
+        return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_poolSum_avx2 :
+                tensorType == _TENSOR_TYPE_FLOAT_ ? Float_poolSum_avx2 : Double_poolSum_avx2;
+    }
+#endif
+
+    (void)level;
+    return tensorType == _TENSOR_TYPE_INTEGER_ ? Integer_poolSum :
+            tensorType == _TENSOR_TYPE_FLOAT_ ? Float_poolSum : Double_poolSum;
+}
+
+/**
+ * Divides the sums of an output row by the size of the window.
+ * 
+ * @param *output       The output row.
+ * @param count         Number of outputs.
+ * @param window        Number of values of a window.
+ * @param tensorType    Type of the tensors.
+ */
+static void divideByWindow(void* output, const int count, const int window, const TensorType tensorType) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        for (int x = 0; x < count; x++) {
+            ((int*)output)[x] /= window;
+        }
+        break;
+    case _TENSOR_TYPE_FLOAT_:
+        for (int x = 0; x < count; x++) {
+            ((float*)output)[x] /= (float)window;
+        }
+        break;
+    case _TENSOR_TYPE_DOUBLE_:
+        for (int x = 0; x < count; x++) {
+            ((double*)output)[x] /= (double)window;
+        }
+        break;
+    }
+}
+
+/**
+ * Computes the output rows [from; to) of a windowed pooling.
+ * 
+ * @param from      First output row.
+ * @param to        End of the output rows (exclusive).
+ * @param *context  The PoolingContext.
+ */
+static void poolingTask(const size_t from, const size_t to, void* context) {
+    const PoolingContext* pooling = (PoolingContext*)context;
+    const Tensor* tensorBase = pooling->tensorBase;
+    const int last = tensorBase->dimensions - 1;
+    const ptrdiff_t tapStep = tensorBase->strides[last];
+    const ptrdiff_t step = (ptrdiff_t)pooling->strides[last] * tapStep;
+
+    for (size_t row = from; row < to; row++) {
+        char* output = pooling->output + row * pooling->outputWidth * pooling->elementSize;
+        size_t rest = row;
+        ptrdiff_t offset = 0;
+
+        for (int dim = last - 1; dim >= 0; dim--) {
+            offset += (ptrdiff_t)(rest % pooling->outputShape[dim]) * pooling->strides[dim] * tensorBase->strides[dim];
+            rest /= pooling->outputShape[dim];
+        }
+
+        for (int r = 0; r < pooling->kernelRows; r++) {
+            (void)pooling->row(output, pooling->input + (offset + pooling->rowOffsets[r]) * (ptrdiff_t)pooling->elementSize,
+                pooling->outputWidth, step, tapStep, pooling->kernelWidth, r == 0);
+        }
+
+        if (pooling->average) {
+            (void)divideByWindow(output, pooling->outputWidth, pooling->window, pooling->tensorType);
+        }
+    }
+}
+
+/**
+ * Executes a max or average pooling over windows of the tensor.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The windows of an output row are reduced kernel row by kernel row, every
+ * kernel row is combined into the whole output row with vectorized loops.
+ * The averages sum the windows and divide once per output, no value is
+ * multiplied. The output rows are distributed over the threads.
+ * </p>
+ * 
+ * @param *tensor       The tensor, can be a strided view.
+ * @param *dest         Contiguous destination with the pooled shape `(size - kernel) / stride + 1`.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * @param average       Whether to average instead of taking the maximum.
+ * @param tensorType    Type of the tensors.
+ * 
+ * @throw NullPointerException - When the tensor, destination or kernel shape is `NULL`.
+ * @throw IllegalArgumentException - When a window or stride is not positive or a window is larger than the tensor.
+ * @throw IllegalArgumentException - When the destination does not have the pooled shape or is not contiguous.
+ */
+static void executePooling(const void* tensor, const void* dest, const int* kernelShape, const int* strides,
+    const int average, const TensorType tensorType) {
+    if (tensor == NULL || dest == NULL || kernelShape == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a pooling.");
+        return;
+    }
+
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    const int dims = tensorBase->dimensions;
+    const int* steps = strides == NULL ? kernelShape : strides;
+    int kernelRows = 1;
+    int window = 1;
+
+    if (destBase->dimensions != dims || Tensor_isContiguous(destBase) == false) {
+        (void)throwIllegalArgumentException("The destination must have the pooled shape and be contiguous.");
+        return;
+    }
+
+    for (int dim = 0; dim < dims; dim++) {
+        if (kernelShape[dim] <= 0 || steps[dim] <= 0 || kernelShape[dim] > tensorBase->shape[dim]) {
+            (void)throwIllegalArgumentException("Windows and strides must be positive and fit into the tensor.");
+            return;
+        } else if (destBase->shape[dim] != (tensorBase->shape[dim] - kernelShape[dim]) / steps[dim] + 1) {
+            (void)throwIllegalArgumentException("The destination must have the pooled shape and be contiguous.");
+            return;
+        }
+
+        kernelRows *= dim < dims - 1 ? kernelShape[dim] : 1;
+        window *= kernelShape[dim];
+    }
+
+    ptrdiff_t* rowOffsets = (ptrdiff_t*)malloc(kernelRows * sizeof(ptrdiff_t));
+
+    if (rowOffsets == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the kernel rows (pooling).");
+        return;
+    }
+
+    for (int r = 0; r < kernelRows; r++) {
+        int rest = r;
+        ptrdiff_t offset = 0;
+
+        for (int dim = dims - 2; dim >= 0; dim--) {
+            offset += (ptrdiff_t)(rest % kernelShape[dim]) * tensorBase->strides[dim];
+            rest /= kernelShape[dim];
+        }
+
+        rowOffsets[r] = offset;
+    }
+
+    const int outputWidth = destBase->shape[dims - 1];
+    const size_t outputRows = destBase->dataPoints / outputWidth;
+    const size_t elementSize = tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int);
+    PoolingContext context = {tensorBase, (const char*)getTensorDataByType(tensor, tensorType),
+        (char*)getTensorDataByType(dest, tensorType), destBase->shape, steps, rowOffsets, kernelRows,
+        kernelShape[dims - 1], outputWidth, window, elementSize, tensorType,
+        selectPoolingRow(tensorType, average == false), average};
+
+    const size_t grainSize = outputWidth >= POOLING_GRAIN_OUTPUTS ? 1 : POOLING_GRAIN_OUTPUTS / outputWidth;
+    (void)parallelFor(0, outputRows, grainSize, poolingTask, &context);
+    (void)free(rowOffsets);
+}
+
+/**
+ * Computes the outputs [from; to) of a global average pooling.
+ * 
+ * @param from      First output.
+ * @param to        End of the outputs (exclusive).
+ * @param *context  The GlobalPoolingContext.
+ */
+static void globalPoolingTask(const size_t from, const size_t to, void* context) {
+    const GlobalPoolingContext* pooling = (GlobalPoolingContext*)context;
+    const Tensor* tensorBase = pooling->tensorBase;
+    const int dims = tensorBase->dimensions;
+    const int kept = pooling->keptDimensions;
+    const int width = tensorBase->shape[dims - 1];
+    const size_t rows = pooling->pooled / width;
+    const ptrdiff_t step = tensorBase->strides[dims - 1];
+
+    for (size_t output = from; output < to; output++) {
+        size_t rest = output;
+        ptrdiff_t offset = 0;
+        long long integerSum = 0;
+        double sum = 0.0;
+        void* accumulator = pooling->tensorType == _TENSOR_TYPE_INTEGER_ ? (void*)&integerSum : (void*)&sum;
+
+        for (int dim = kept - 1; dim >= 0; dim--) {
+            offset += (ptrdiff_t)(rest % tensorBase->shape[dim]) * tensorBase->strides[dim];
+            rest /= tensorBase->shape[dim];
+        }
+
+        for (size_t row = 0; row < rows; row++) {
+            size_t rowRest = row;
+            ptrdiff_t rowOffset = offset;
+
+            for (int dim = dims - 2; dim >= kept; dim--) {
+                rowOffset += (ptrdiff_t)(rowRest % tensorBase->shape[dim]) * tensorBase->strides[dim];
+                rowRest /= tensorBase->shape[dim];
+            }
+
+            (void)pooling->sum(accumulator, pooling->input + rowOffset * (ptrdiff_t)pooling->elementSize, width, step);
+        }
+
+        switch (pooling->tensorType) {
+        case _TENSOR_TYPE_INTEGER_:
+            ((int*)pooling->output)[output] = (int)(integerSum / (long long)pooling->pooled);
+            break;
+        case _TENSOR_TYPE_FLOAT_:
+            ((float*)pooling->output)[output] = (float)(sum / (double)pooling->pooled);
+            break;
+        case _TENSOR_TYPE_DOUBLE_:
+            ((double*)pooling->output)[output] = sum / (double)pooling->pooled;
+            break;
+        }
+    }
+}
+
+/**
+ * Executes a global average pooling, which averages all dimensions but the
+ * leading kept ones (e.g. all spatial dimensions of every channel).
+ * 
+ * <p><b>Note:</b><br>
+ * The sums are accumulated in `long long` for INTEGER and in `double` for
+ * FLOAT and DOUBLE tensors, so large inputs do not overflow or lose the
+ * small values.
+ * </p>
+ * 
+ * @param *tensor           The tensor, can be a strided view.
+ * @param *dest             Contiguous destination with the kept sizes followed by sizes of 1.
+ * @param keptDimensions    Number of leading dimensions, that are not averaged.
+ * @param tensorType        Type of the tensors.
+ * 
+ * @throw NullPointerException - When the tensor or the destination is `NULL`.
+ * @throw IllegalArgumentException - When no dimension is averaged or the destination has the wrong shape.
+ */
+static void executeGlobalAveragePool(const void* tensor, const void* dest, const int keptDimensions,
+    const TensorType tensorType) {
+    if (tensor == NULL || dest == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a pooling.");
+        return;
+    }
+
+    const Tensor* tensorBase = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const Tensor* destBase = (Tensor*)getTensorBaseByType(dest, tensorType);
+    const int dims = tensorBase->dimensions;
+    size_t outputs = 1;
+
+    if (keptDimensions < 0 || keptDimensions >= dims) {
+        (void)throwIllegalArgumentException("A global pooling must average at least one dimension.");
+        return;
+    } else if (destBase->dimensions != dims || Tensor_isContiguous(destBase) == false) {
+        (void)throwIllegalArgumentException("The destination must have the pooled shape and be contiguous.");
+        return;
+    }
+
+    for (int dim = 0; dim < dims; dim++) {
+        if (destBase->shape[dim] != (dim < keptDimensions ? tensorBase->shape[dim] : 1)) {
+            (void)throwIllegalArgumentException("The destination must have the pooled shape and be contiguous.");
+            return;
+        }
+
+        outputs *= dim < keptDimensions ? tensorBase->shape[dim] : 1;
+    }
+
+    const size_t pooled = tensorBase->dataPoints / outputs;
+    GlobalPoolingContext context = {tensorBase, (const char*)getTensorDataByType(tensor, tensorType),
+        (char*)getTensorDataByType(dest, tensorType), keptDimensions, pooled,
+        tensorType == _TENSOR_TYPE_DOUBLE_ ? sizeof(double) : sizeof(int), tensorType,
+        selectPoolingSum(tensorType)};
+
+    const size_t grainSize = pooled >= POOLING_GRAIN_OUTPUTS ? 1 : POOLING_GRAIN_OUTPUTS / pooled;
+    (void)parallelFor(0, outputs, grainSize, globalPoolingTask, &context);
+}
+
+/**
+ * Takes the maximum of every window of the tensor.
+ * 
+ * @param *tensor       The tensor.
+ * @param *dest         Destination with the pooled shape `(size - kernel) / stride + 1`.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * 
+ * @see #executePooling(const void* tensor, const void* dest, const int* kernelShape, const int* strides,
+    const int average, const TensorType tensorType)
+ */
+void IntegerTensor_maxPool(const IntegerTensor* tensor, const IntegerTensor* dest,
+    const int* kernelShape, const int* strides) {
+    (void)executePooling(tensor, dest, kernelShape, strides, false, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Takes the maximum of every window of the tensor.
+ * 
+ * @param *tensor       The tensor.
+ * @param *dest         Destination with the pooled shape `(size - kernel) / stride + 1`.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * 
+ * @see #executePooling(const void* tensor, const void* dest, const int* kernelShape, const int* strides,
+    const int average, const TensorType tensorType)
+ */
+void FloatTensor_maxPool(const FloatTensor* tensor, const FloatTensor* dest,
+    const int* kernelShape, const int* strides) {
+    (void)executePooling(tensor, dest, kernelShape, strides, false, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Takes the maximum of every window of the tensor.
+ * 
+ * @param *tensor       The tensor.
+ * @param *dest         Destination with the pooled shape `(size - kernel) / stride + 1`.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * 
+ * @see #executePooling(const void* tensor, const void* dest, const int* kernelShape, const int* strides,
+    const int average, const TensorType tensorType)
+ */
+void DoubleTensor_maxPool(const DoubleTensor* tensor, const DoubleTensor* dest,
+    const int* kernelShape, const int* strides) {
+    (void)executePooling(tensor, dest, kernelShape, strides, false, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Averages every window of the tensor, the mean is truncated.
+ * 
+ * @param *tensor       The tensor.
+ * @param *dest         Destination with the pooled shape `(size - kernel) / stride + 1`.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * 
+ * @see #executePooling(const void* tensor, const void* dest, const int* kernelShape, const int* strides,
+    const int average, const TensorType tensorType)
+ */
+void IntegerTensor_averagePool(const IntegerTensor* tensor, const IntegerTensor* dest,
+    const int* kernelShape, const int* strides) {
+    (void)executePooling(tensor, dest, kernelShape, strides, true, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Averages every window of the tensor.
+ * 
+ * @param *tensor       The tensor.
+ * @param *dest         Destination with the pooled shape `(size - kernel) / stride + 1`.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * 
+ * @see #executePooling(const void* tensor, const void* dest, const int* kernelShape, const int* strides,
+    const int average, const TensorType tensorType)
+ */
+void FloatTensor_averagePool(const FloatTensor* tensor, const FloatTensor* dest,
+    const int* kernelShape, const int* strides) {
+    (void)executePooling(tensor, dest, kernelShape, strides, true, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Averages every window of the tensor.
+ * 
+ * @param *tensor       The tensor.
+ * @param *dest         Destination with the pooled shape `(size - kernel) / stride + 1`.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * 
+ * @see #executePooling(const void* tensor, const void* dest, const int* kernelShape, const int* strides,
+    const int average, const TensorType tensorType)
+ */
+void DoubleTensor_averagePool(const DoubleTensor* tensor, const DoubleTensor* dest,
+    const int* kernelShape, const int* strides) {
+    (void)executePooling(tensor, dest, kernelShape, strides, true, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Averages all but the leading dimensions of the tensor, the mean is truncated.
+ * 
+ * @param *tensor           The tensor.
+ * @param *dest             Destination with the kept sizes followed by sizes of 1.
+ * @param keptDimensions    Number of leading dimensions, that are not averaged.
+ * 
+ * @see #executeGlobalAveragePool(const void* tensor, const void* dest, const int keptDimensions,
+    const TensorType tensorType)
+ */
+void IntegerTensor_globalAveragePool(const IntegerTensor* tensor, const IntegerTensor* dest,
+    const int keptDimensions) {
+    (void)executeGlobalAveragePool(tensor, dest, keptDimensions, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Averages all but the leading dimensions of the tensor.
+ * 
+ * @param *tensor           The tensor.
+ * @param *dest             Destination with the kept sizes followed by sizes of 1.
+ * @param keptDimensions    Number of leading dimensions, that are not averaged.
+ * 
+ * @see #executeGlobalAveragePool(const void* tensor, const void* dest, const int keptDimensions,
+    const TensorType tensorType)
+ */
+void FloatTensor_globalAveragePool(const FloatTensor* tensor, const FloatTensor* dest,
+    const int keptDimensions) {
+    (void)executeGlobalAveragePool(tensor, dest, keptDimensions, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Averages all but the leading dimensions of the tensor.
+ * 
+ * @param *tensor           The tensor.
+ * @param *dest             Destination with the kept sizes followed by sizes of 1.
+ * @param keptDimensions    Number of leading dimensions, that are not averaged.
+ * 
+ * @see #executeGlobalAveragePool(const void* tensor, const void* dest, const int keptDimensions,
+    const TensorType tensorType)
+ */
+void DoubleTensor_globalAveragePool(const DoubleTensor* tensor, const DoubleTensor* dest,
+    const int keptDimensions) {
+    (void)executeGlobalAveragePool(tensor, dest, keptDimensions, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a PoolingLayer based on the given parameters.
+ * 
+ * @param type          The reduction of the layer.
+ * @param dimensions    Dimensions of the input or the kept dimensions of a global average.
+ * @param *kernelShape  Size of the window in every dimension, `NULL` for a global average.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * @param *destination  Optional destination of the pooled values.
+ * @param tensorType    Type of the tensors involved (all must be equal).
+ * 
+ * @throws NullPointerException - When the kernel shape of a windowed pooling is `NULL`.
+ * @throws IllegalArgumentException - When the number of dimensions is not valid.
+ */
+static PoolingLayer* createPoolingLayer(const PoolingType type, const int dimensions, const int* kernelShape,
+    const int* strides, const void* destination, const TensorType tensorType) {
+    const int windowed = type != POOLING_GLOBAL_AVERAGE;
+
+    if (windowed && kernelShape == NULL) {
+        (void)throwNullPointerException("Kernel shape of a pooling must not be NULL!");
+        return NULL;
+    } else if (dimensions < (windowed ? 1 : 0)) {
+        (void)throwIllegalArgumentException("Invalid number of dimensions for a pooling.");
+        return NULL;
+    }
+
+    Layer* base = (Layer*)createLayer(tensorType, (void*)destination);
+    PoolingLayer* layer = (PoolingLayer*)calloc(1, sizeof(PoolingLayer));
+    int* shapes = windowed ? (int*)malloc(2 * dimensions * sizeof(int)) : NULL;
+
+    if (base == NULL || layer == NULL || (windowed && shapes == NULL)) {
+        if (base != NULL) (void)free(base);
+        if (layer != NULL) (void)free(layer);
+        if (shapes != NULL) (void)free(shapes);
+        (void)throwMemoryAllocationException("While trying to generate PoolingLayer.");
+        return NULL;
+    }
+
+    for (int dim = 0; windowed && dim < dimensions; dim++) {
+        shapes[dim] = kernelShape[dim];
+        shapes[dimensions + dim] = strides == NULL ? kernelShape[dim] : strides[dim];
+    }
+
+    layer->base = base;
+    layer->type = type;
+    layer->dimensions = dimensions;
+    layer->kernelShape = shapes;
+    layer->strides = windowed ? shapes + dimensions : NULL;
+    return layer;
+}
+
+/**
+ * Creates a PoolingLayer, that takes the maximum or the average of every
+ * window of its input.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param type          `POOLING_MAX` or `POOLING_AVERAGE`.
+ * @param dimensions    Dimensions of the input.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * @param *destination  Optional destination to which to write the results.
+ */
+PoolingLayer* Integer_createPoolingLayer(const PoolingType type, const int dimensions,
+    const int* kernelShape, const int* strides, const IntegerTensor* destination) {
+    return (PoolingLayer*)createPoolingLayer(type, dimensions, kernelShape, strides,
+        destination, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a PoolingLayer, that takes the maximum or the average of every
+ * window of its input.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param type          `POOLING_MAX` or `POOLING_AVERAGE`.
+ * @param dimensions    Dimensions of the input.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * @param *destination  Optional destination to which to write the results.
+ */
+PoolingLayer* Float_createPoolingLayer(const PoolingType type, const int dimensions,
+    const int* kernelShape, const int* strides, const FloatTensor* destination) {
+    return (PoolingLayer*)createPoolingLayer(type, dimensions, kernelShape, strides,
+        destination, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a PoolingLayer, that takes the maximum or the average of every
+ * window of its input.
+ * 
+ * <p><b>Note:</b><br>
+ * The destination must not be initialized and can be set to `NULL`. When set
+ * to `NULL` the used Network will generate the destination automatically.
+ * </p>
+ * 
+ * @param type          `POOLING_MAX` or `POOLING_AVERAGE`.
+ * @param dimensions    Dimensions of the input.
+ * @param *kernelShape  Size of the window in every dimension.
+ * @param *strides      Step of the window in every dimension, `NULL` for non-overlapping windows.
+ * @param *destination  Optional destination to which to write the results.
+ */
+PoolingLayer* Double_createPoolingLayer(const PoolingType type, const int dimensions,
+    const int* kernelShape, const int* strides, const DoubleTensor* destination) {
+    return (PoolingLayer*)createPoolingLayer(type, dimensions, kernelShape, strides,
+        destination, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a PoolingLayer, that averages all but the leading dimensions of
+ * its input (e.g. every channel of a `C x H x W` input with one kept
+ * dimension).
+ * 
+ * @param keptDimensions    Number of leading dimensions, that are not averaged.
+ * @param *destination      Optional destination to which to write the results.
+ */
+PoolingLayer* Integer_createGlobalPoolingLayer(const int keptDimensions, const IntegerTensor* destination) {
+    return (PoolingLayer*)createPoolingLayer(POOLING_GLOBAL_AVERAGE, keptDimensions, NULL, NULL,
+        destination, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a PoolingLayer, that averages all but the leading dimensions of
+ * its input (e.g. every channel of a `C x H x W` input with one kept
+ * dimension).
+ * 
+ * @param keptDimensions    Number of leading dimensions, that are not averaged.
+ * @param *destination      Optional destination to which to write the results.
+ */
+PoolingLayer* Float_createGlobalPoolingLayer(const int keptDimensions, const FloatTensor* destination) {
+    return (PoolingLayer*)createPoolingLayer(POOLING_GLOBAL_AVERAGE, keptDimensions, NULL, NULL,
+        destination, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a PoolingLayer, that averages all but the leading dimensions of
+ * its input (e.g. every channel of a `C x H x W` input with one kept
+ * dimension).
+ * 
+ * @param keptDimensions    Number of leading dimensions, that are not averaged.
+ * @param *destination      Optional destination to which to write the results.
+ */
+PoolingLayer* Double_createGlobalPoolingLayer(const int keptDimensions, const DoubleTensor* destination) {
+    return (PoolingLayer*)createPoolingLayer(POOLING_GLOBAL_AVERAGE, keptDimensions, NULL, NULL,
+        destination, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates the destination of the given layer with the pooled shape of the
+ * input. A destination created for an earlier input of the same shape is
+ * reused.
+ * 
+ * @param *layer    Layer for which to create the destination.
+ * @param *input    The input of the layer.
+ */
+static void initPoolingDestination(PoolingLayer* layer, const void* input) {
+    const TensorType tensorType = layer->base->inputType;
+    const Tensor* inputBase = (Tensor*)getTensorBaseByType(input, tensorType);
+    const int dims = inputBase->dimensions;
+    int* shape = (int*)malloc(dims * sizeof(int));
+
+    if (shape == NULL) {
+        (void)throwMemoryAllocationException("At destination tensor creation.");
+        return;
+    } else if (layer->type != POOLING_GLOBAL_AVERAGE && layer->dimensions != dims) {
+        (void)free(shape);
+        (void)throwIllegalArgumentException("The input must have the dimensions of the pooling.");
+        return;
+    }
+
+    for (int dim = 0; dim < dims; dim++) {
+        if (layer->type == POOLING_GLOBAL_AVERAGE) {
+            shape[dim] = dim < layer->dimensions ? inputBase->shape[dim] : 1;
+        } else {
+            shape[dim] = inputBase->shape[dim] < layer->kernelShape[dim] ? 0
+                        : (inputBase->shape[dim] - layer->kernelShape[dim]) / layer->strides[dim] + 1;
+        }
+    }
+
+    const Tensor* destBase = layer->base->destination == NULL ? NULL
+                            : (Tensor*)getTensorBaseByType(layer->base->destination, tensorType);
+
+    if (destBase != NULL && destBase->dimensions == dims && memcmp(destBase->shape, shape, dims * sizeof(int)) == 0) {
+        (void)free(shape);
+        return;
+    }
+
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        layer->base->destination = (IntegerTensor*)IntegerTensor_zeros(dims, shape);
+        break;
+    case _TENSOR_TYPE_FLOAT_:
+        layer->base->destination = (FloatTensor*)FloatTensor_zeros(dims, shape);
+        break;
+    case _TENSOR_TYPE_DOUBLE_:
+        layer->base->destination = (DoubleTensor*)DoubleTensor_zeros(dims, shape);
+        break;
+    }
+
+    (void)free(shape);
+}
+
+/**
+ * Pools the given input into the destination of the layer.
+ * 
+ * <p><b>Warning:</b><br>
+ * The type of the input is determined by the layer type. This mean if the layer type
+ * if `IntegerTensor`, the input should also be an `IntegerTensor` or else undefined
+ * behaviour will occur.
+ * </p>
+ * 
+ * @param *layer    The PoolingLayer with all parameters for the pooling.
+ * @param *input    Pointer to the input that should be pooled.
+ */
+void PoolingLayer_forward(const PoolingLayer* layer, const void* input) {
+    if (layer->base->isDestinationSet == false) {
+        (void)initPoolingDestination((PoolingLayer*)layer, input);
+    }
+
+    if (layer->type == POOLING_GLOBAL_AVERAGE) {
+        (void)executeGlobalAveragePool(input, layer->base->destination, layer->dimensions, layer->base->inputType);
+        return;
+    }
+
+    (void)executePooling(input, layer->base->destination, layer->kernelShape, layer->strides,
+        layer->type == POOLING_AVERAGE, layer->base->inputType);
+}
+
+/**
+ * Frees a given PoolingLayer.
+ * 
+ * @param *layer    PoolingLayer to free.
+ */
+void PoolingLayer_free(PoolingLayer* layer) {
+    if (layer == NULL) {
+        return;
+    }
+
+    (void)freeLayer(layer->base);
+    (void)free(layer->kernelShape);
+    (void)free(layer);
+}
\ No newline at end of file
@@ -0,0 +1,463 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "Operations/simd.h"
+#include "Utils/cpu.h"
+
+#define ELEMENTWISE_OPERATIONS 4
+
+/**
+ * Generates a plain C kernel that applies the given operator on every
+ * element pair of `a` and `b`. It is the fallback when no SIMD level
+ * is available and is still auto-vectorized by the compiler.
+ */
+#define DEFINE_SCALAR_ELEMENTWISE_KERNEL(name, type, operator) \
+    static void name(const type* a, const type* b, type* destination, const size_t length) { \
+        for (size_t i = 0; i < length; i++) { \
+            destination[i] = a[i] operator b[i]; \
+        } \
+    }
+
+/**
+ * Generates a plain C kernel that multiplies every element of `a`
+ * with the given scalar.
+ */
+#define DEFINE_SCALAR_MULTIPLY_KERNEL(name, type) \
+    static void name(const type* a, const type scalar, type* destination, const size_t length) { \
+        for (size_t i = 0; i < length; i++) { \
+            destination[i] = scalar * a[i]; \
+        } \
+    }
+
+/**
+ * Generates a vectorized kernel for the instruction set `isa`, that processes
+ * `width` elements per iteration with the vector `operation`. The remainder,
+ * that does not fill a whole register, is processed by the scalar `operator`.
+ */
+#define DEFINE_VECTOR_ELEMENTWISE_KERNEL(name, isa, type, vector, width, load, store, operation, operator) \
+    __attribute__((target(isa))) \
+    static void name(const type* a, const type* b, type* destination, const size_t length) { \
+        size_t i = 0; \
+        for (; i + (width) <= length; i += (width)) { \
+            const vector va = load((const void*)(a + i)); \
+            const vector vb = load((const void*)(b + i)); \
+            store((void*)(destination + i), operation(va, vb)); \
+        } \
+        for (; i < length; i++) { \
+            destination[i] = a[i] operator b[i]; \
+        } \
+    }
+
+/**
+ * Generates a vectorized kernel for the instruction set `isa`, that multiplies
+ * `width` elements per iteration with the broadcasted scalar.
+ */
+#define DEFINE_VECTOR_MULTIPLY_KERNEL(name, isa, type, vector, width, load, store, broadcast, multiply) \
+    __attribute__((target(isa))) \
+    static void name(const type* a, const type scalar, type* destination, const size_t length) { \
+        const vector vs = broadcast(scalar); \
+        size_t i = 0; \
+        for (; i + (width) <= length; i += (width)) { \
+            store((void*)(destination + i), multiply(vs, load((const void*)(a + i)))); \
+        } \
+        for (; i < length; i++) { \
+            destination[i] = scalar * a[i]; \
+        } \
+    }
+
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Integer_add_scalar, int, +)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Integer_subtract_scalar, int, -)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Integer_multiply_scalar, int, *)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Integer_divide_scalar, int, /)
+DEFINE_SCALAR_MULTIPLY_KERNEL(Integer_scalarMultiply_scalar, int)
+
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Float_add_scalar, float, +)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Float_subtract_scalar, float, -)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Float_multiply_scalar, float, *)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Float_divide_scalar, float, /)
+DEFINE_SCALAR_MULTIPLY_KERNEL(Float_scalarMultiply_scalar, float)
+
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Double_add_scalar, double, +)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Double_subtract_scalar, double, -)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Double_multiply_scalar, double, *)
+DEFINE_SCALAR_ELEMENTWISE_KERNEL(Double_divide_scalar, double, /)
+DEFINE_SCALAR_MULTIPLY_KERNEL(Double_scalarMultiply_scalar, double)
+
+/**
+ * Table of all kernels for a single SIMD level.
+ */
+typedef struct {
+    Integer_ElementwiseKernel integerKernels[ELEMENTWISE_OPERATIONS];
+    Float_ElementwiseKernel floatKernels[ELEMENTWISE_OPERATIONS];
+    Double_ElementwiseKernel doubleKernels[ELEMENTWISE_OPERATIONS];
+    Integer_ScalarKernel integerScalarMultiply;
+    Float_ScalarKernel floatScalarMultiply;
+    Double_ScalarKernel doubleScalarMultiply;
+} KernelTable;
+
+static const KernelTable SCALAR_KERNELS = {
+    .integerKernels = {
+        [ELEMENTWISE_ADD] = Integer_add_scalar,
+        [ELEMENTWISE_SUBTRACT] = Integer_subtract_scalar,
+        [ELEMENTWISE_MULTIPLY] = Integer_multiply_scalar,
+        [ELEMENTWISE_DIVIDE] = Integer_divide_scalar
+    },
+    .floatKernels = {
+        [ELEMENTWISE_ADD] = Float_add_scalar,
+        [ELEMENTWISE_SUBTRACT] = Float_subtract_scalar,
+        [ELEMENTWISE_MULTIPLY] = Float_multiply_scalar,
+        [ELEMENTWISE_DIVIDE] = Float_divide_scalar
+    },
+    .doubleKernels = {
+        [ELEMENTWISE_ADD] = Double_add_scalar,
+        [ELEMENTWISE_SUBTRACT] = Double_subtract_scalar,
+        [ELEMENTWISE_MULTIPLY] = Double_multiply_scalar,
+        [ELEMENTWISE_DIVIDE] = Double_divide_scalar
+    },
+    .integerScalarMultiply = Integer_scalarMultiply_scalar,
+    .floatScalarMultiply = Float_scalarMultiply_scalar,
+    .doubleScalarMultiply = Double_scalarMultiply_scalar
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/**
+ * Multiplies the 32-bit integers of two SSE2 registers and keeps the lower
+ * 32-bits of each product. SSE2 has no `pmulld`, so the even and odd lanes
+ * are multiplied separately and merged afterwards.
+ */
+__attribute__((target("sse2")))
+static inline __m128i sse2_mullo_epi32(const __m128i a, const __m128i b) {
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+        _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/**
+ * Divides the 32-bit integers of two SSE2 registers.
+ * 
+ * <p><b>Note:</b><br>
+ * x86 has no integer division on vectors. Every 32-bit integer is exactly
+ * representable as a double and the error of the double division is smaller
+ * than the distance to the next integer, so the truncated result is equal
+ * to the integer division. Zero divisors and `INT_MIN / -1` are rejected by
+ * IntegerTensor_operate before any kernel runs.
+ * </p>
+ */
+__attribute__((target("sse2")))
+static inline __m128i sse2_div_epi32(const __m128i a, const __m128i b) {
+    const __m128d low = _mm_div_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b));
+    const __m128d high = _mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2))),
+        _mm_cvtepi32_pd(_mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2))));
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(low), _mm_cvttpd_epi32(high));
+}
+
+/**
+ * Divides the 32-bit integers of two AVX2 registers.
+ * 
+ * @see #sse2_div_epi32(const __m128i a, const __m128i b)
+ */
+__attribute__((target("avx2")))
+static inline __m256i avx2_div_epi32(const __m256i a, const __m256i b) {
+    const __m256d lowA = _mm256_cvtepi32_pd(_mm256_castsi256_si128(a));
+    const __m256d lowB = _mm256_cvtepi32_pd(_mm256_castsi256_si128(b));
+    const __m256d highA = _mm256_cvtepi32_pd(_mm256_extracti128_si256(a, 1));
+    const __m256d highB = _mm256_cvtepi32_pd(_mm256_extracti128_si256(b, 1));
+    const __m128i low = _mm256_cvttpd_epi32(_mm256_div_pd(lowA, lowB));
+    const __m128i high = _mm256_cvttpd_epi32(_mm256_div_pd(highA, highB));
+    return _mm256_set_m128i(high, low);
+}
+
+/**
+ * Divides the 32-bit integers of two AVX-512 registers.
+ * 
+ * @see #sse2_div_epi32(const __m128i a, const __m128i b)
+ */
+__attribute__((target("avx512f")))
+static inline __m512i avx512_div_epi32(const __m512i a, const __m512i b) {
+    const __m512d lowA = _mm512_cvtepi32_pd(_mm512_castsi512_si256(a));
+    const __m512d lowB = _mm512_cvtepi32_pd(_mm512_castsi512_si256(b));
+    const __m512d highA = _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a, 1));
+    const __m512d highB = _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(b, 1));
+    const __m256i low = _mm512_cvttpd_epi32(_mm512_div_pd(lowA, lowB));
+    const __m256i high = _mm512_cvttpd_epi32(_mm512_div_pd(highA, highB));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(low), high, 1);
+}
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_add_sse2, "sse2", int, __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_add_epi32, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_subtract_sse2, "sse2", int, __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_sub_epi32, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_multiply_sse2, "sse2", int, __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, sse2_mullo_epi32, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_divide_sse2, "sse2", int, __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, sse2_div_epi32, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Integer_scalarMultiply_sse2, "sse2", int, __m128i, 4, _mm_loadu_si128, _mm_storeu_si128, _mm_set1_epi32, sse2_mullo_epi32)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_add_sse2, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_add_ps, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_subtract_sse2, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_sub_ps, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_multiply_sse2, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_mul_ps, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_divide_sse2, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_div_ps, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Float_scalarMultiply_sse2, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps, _mm_mul_ps)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_add_sse2, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_add_pd, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_subtract_sse2, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_sub_pd, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_multiply_sse2, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_mul_pd, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_divide_sse2, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_div_pd, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Double_scalarMultiply_sse2, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd, _mm_mul_pd)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_add_avx2, "avx2", int, __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_add_epi32, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_subtract_avx2, "avx2", int, __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_sub_epi32, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_multiply_avx2, "avx2", int, __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_mullo_epi32, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_divide_avx2, "avx2", int, __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, avx2_div_epi32, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Integer_scalarMultiply_avx2, "avx2", int, __m256i, 8, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_set1_epi32, _mm256_mullo_epi32)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_add_avx2, "avx2", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_add_ps, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_subtract_avx2, "avx2", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_sub_ps, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_multiply_avx2, "avx2", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_mul_ps, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_divide_avx2, "avx2", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_div_ps, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Float_scalarMultiply_avx2, "avx2", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps, _mm256_mul_ps)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_add_avx2, "avx2", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_add_pd, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_subtract_avx2, "avx2", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_sub_pd, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_multiply_avx2, "avx2", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_mul_pd, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_divide_avx2, "avx2", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_div_pd, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Double_scalarMultiply_avx2, "avx2", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd, _mm256_mul_pd)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_add_avx512, "avx512f", int, __m512i, 16, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_add_epi32, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_subtract_avx512, "avx512f", int, __m512i, 16, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_sub_epi32, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_multiply_avx512, "avx512f", int, __m512i, 16, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_mullo_epi32, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Integer_divide_avx512, "avx512f", int, __m512i, 16, _mm512_loadu_si512, _mm512_storeu_si512, avx512_div_epi32, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Integer_scalarMultiply_avx512, "avx512f", int, __m512i, 16, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_set1_epi32, _mm512_mullo_epi32)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_add_avx512, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_add_ps, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_subtract_avx512, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_sub_ps, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_multiply_avx512, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_mul_ps, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Float_divide_avx512, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_div_ps, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Float_scalarMultiply_avx512, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps, _mm512_mul_ps)
+
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_add_avx512, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_add_pd, +)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_subtract_avx512, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_sub_pd, -)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_multiply_avx512, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_mul_pd, *)
+DEFINE_VECTOR_ELEMENTWISE_KERNEL(Double_divide_avx512, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_div_pd, /)
+DEFINE_VECTOR_MULTIPLY_KERNEL(Double_scalarMultiply_avx512, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd, _mm512_mul_pd)
+
+static const KernelTable SSE2_KERNELS = {
+    .integerKernels = {
+        [ELEMENTWISE_ADD] = Integer_add_sse2,
+        [ELEMENTWISE_SUBTRACT] = Integer_subtract_sse2,
+        [ELEMENTWISE_MULTIPLY] = Integer_multiply_sse2,
+        [ELEMENTWISE_DIVIDE] = Integer_divide_sse2
+    },
+    .floatKernels = {
+        [ELEMENTWISE_ADD] = Float_add_sse2,
+        [ELEMENTWISE_SUBTRACT] = Float_subtract_sse2,
+        [ELEMENTWISE_MULTIPLY] = Float_multiply_sse2,
+        [ELEMENTWISE_DIVIDE] = Float_divide_sse2
+    },
+    .doubleKernels = {
+        [ELEMENTWISE_ADD] = Double_add_sse2,
+        [ELEMENTWISE_SUBTRACT] = Double_subtract_sse2,
+        [ELEMENTWISE_MULTIPLY] = Double_multiply_sse2,
+        [ELEMENTWISE_DIVIDE] = Double_divide_sse2
+    },
+    .integerScalarMultiply = Integer_scalarMultiply_sse2,
+    .floatScalarMultiply = Float_scalarMultiply_sse2,
+    .doubleScalarMultiply = Double_scalarMultiply_sse2
+};
+
+static const KernelTable AVX2_KERNELS = {
+    .integerKernels = {
+        [ELEMENTWISE_ADD] = Integer_add_avx2,
+        [ELEMENTWISE_SUBTRACT] = Integer_subtract_avx2,
+        [ELEMENTWISE_MULTIPLY] = Integer_multiply_avx2,
+        [ELEMENTWISE_DIVIDE] = Integer_divide_avx2
+    },
+    .floatKernels = {
+        [ELEMENTWISE_ADD] = Float_add_avx2,
+        [ELEMENTWISE_SUBTRACT] = Float_subtract_avx2,
+        [ELEMENTWISE_MULTIPLY] = Float_multiply_avx2,
+        [ELEMENTWISE_DIVIDE] = Float_divide_avx2
+    },
+    .doubleKernels = {
+        [ELEMENTWISE_ADD] = Double_add_avx2,
+        [ELEMENTWISE_SUBTRACT] = Double_subtract_avx2,
+        [ELEMENTWISE_MULTIPLY] = Double_multiply_avx2,
+        [ELEMENTWISE_DIVIDE] = Double_divide_avx2
+    },
+    .integerScalarMultiply = Integer_scalarMultiply_avx2,
+    .floatScalarMultiply = Float_scalarMultiply_avx2,
+    .doubleScalarMultiply = Double_scalarMultiply_avx2
+};
+
+static const KernelTable AVX512_KERNELS = {
+    .integerKernels = {
+        [ELEMENTWISE_ADD] = Integer_add_avx512,
+        [ELEMENTWISE_SUBTRACT] = Integer_subtract_avx512,
+        [ELEMENTWISE_MULTIPLY] = Integer_multiply_avx512,
+        [ELEMENTWISE_DIVIDE] = Integer_divide_avx512
+    },
+    .floatKernels = {
+        [ELEMENTWISE_ADD] = Float_add_avx512,
+        [ELEMENTWISE_SUBTRACT] = Float_subtract_avx512,
+        [ELEMENTWISE_MULTIPLY] = Float_multiply_avx512,
+        [ELEMENTWISE_DIVIDE] = Float_divide_avx512
+    },
+    .doubleKernels = {
+        [ELEMENTWISE_ADD] = Double_add_avx512,
+        [ELEMENTWISE_SUBTRACT] = Double_subtract_avx512,
+        [ELEMENTWISE_MULTIPLY] = Double_multiply_avx512,
+        [ELEMENTWISE_DIVIDE] = Double_divide_avx512
+    },
+    .integerScalarMultiply = Integer_scalarMultiply_avx512,
+    .floatScalarMultiply = Float_scalarMultiply_avx512,
+    .doubleScalarMultiply = Double_scalarMultiply_avx512
+};
+
+#endif
+
+static const KernelTable* ACTIVE_KERNELS = NULL;
+static SimdLevel ACTIVE_SIMD_LEVEL = SIMD_LEVEL_SCALAR;
+
+/**
+ * Selects the kernels of the given SIMD level. When the CPU does not
+ * support the requested level, the best supported level below it is used.
+ * 
+ * <p><b>Note:</b><br>
+ * The level is detected automatically on the first use of a kernel, so
+ * this function is only needed to force a lower level (e.g. for testing
+ * or for comparing the kernels).
+ * </p>
+ * 
+ * @param level     The desired SIMD level.
+ */
+void setSimdLevel(const SimdLevel level) {
+    const SimdLevel detected = (SimdLevel)detectSimdLevel();
+    const SimdLevel selected = level > detected ? detected : level;
+
+#if defined(__x86_64__) || defined(__i386__)
+    switch (selected) {
+    case SIMD_LEVEL_AVX512:
+        ACTIVE_KERNELS = &AVX512_KERNELS;
+        break;
+    case SIMD_LEVEL_AVX2:
+        ACTIVE_KERNELS = &AVX2_KERNELS;
+        break;
+    case SIMD_LEVEL_SSE2:
+        ACTIVE_KERNELS = &SSE2_KERNELS;
+        break;
+    default:
+        ACTIVE_KERNELS = &SCALAR_KERNELS;
+        break;
+    }
+#else
+    ACTIVE_KERNELS = &SCALAR_KERNELS;
+#endif
+
+    ACTIVE_SIMD_LEVEL = selected;
+}
+
+/**
+ * Returns the kernel table of the active SIMD level and selects
+ * the best level of the CPU on the first call.
+ * 
+ * @return The active kernel table.
+ */
+static const KernelTable* getKernelTable() {
+    if (ACTIVE_KERNELS == NULL) {
+        (void)setSimdLevel(detectSimdLevel());
+    }
+
+    return ACTIVE_KERNELS;
+}
+
+/**
+ * Returns the SIMD level that is currently used by the kernels.
+ * 
+ * @return The active SIMD level.
+ */
+SimdLevel getSimdLevel() {
+    (void)getKernelTable();
+    return ACTIVE_SIMD_LEVEL;
+}
+
+/**
+ * Returns the kernel for the given elementwise operation on integers.
+ * 
+ * @param operation     The operation the kernel should execute.
+ * 
+ * @return The kernel of the active SIMD level.
+ */
+Integer_ElementwiseKernel getIntegerElementwiseKernel(const ElementwiseOperation operation) {
+    return getKernelTable()->integerKernels[operation];
+}
+
+/**
+ * Returns the kernel for the given elementwise operation on floats.
+ * 
+ * @param operation     The operation the kernel should execute.
+ * 
+ * @return The kernel of the active SIMD level.
+ */
+Float_ElementwiseKernel getFloatElementwiseKernel(const ElementwiseOperation operation) {
+    return getKernelTable()->floatKernels[operation];
+}
+
+/**
+ * Returns the kernel for the given elementwise operation on doubles.
+ * 
+ * @param operation     The operation the kernel should execute.
+ * 
+ * @return The kernel of the active SIMD level.
+ */
+Double_ElementwiseKernel getDoubleElementwiseKernel(const ElementwiseOperation operation) {
+    return getKernelTable()->doubleKernels[operation];
+}
+
+/**
+ * Returns the kernel that multiplies integers with a scalar.
+ * 
+ * @return The kernel of the active SIMD level.
+ */
+Integer_ScalarKernel getIntegerScalarMultiplyKernel() {
+    return getKernelTable()->integerScalarMultiply;
+}
+
+/**
+ * Returns the kernel that multiplies floats with a scalar.
+ * 
+ * @return The kernel of the active SIMD level.
+ */
+Float_ScalarKernel getFloatScalarMultiplyKernel() {
+    return getKernelTable()->floatScalarMultiply;
+}
+
+/**
+ * Returns the kernel that multiplies doubles with a scalar.
+ * 
+ * @return The kernel of the active SIMD level.
+ */
+Double_ScalarKernel getDoubleScalarMultiplyKernel() {
+    return getKernelTable()->doubleScalarMultiply;
+}
\ No newline at end of file
@@ -72,9 +72,53 @@ double getSumOfRow(void* startPtr, void* endPtr, const TensorType tensorType) {
     return sum;
 }
 
+/**
+ * Gets the data pointer of the given tensor.
+ * 
+ * @param *tensor       The tensor.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return Pointer to the first element of the tensor.
+ */
+static char* getDataOfTensor(const void* tensor, const TensorType tensorType) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        return (char*)((IntegerTensor*)tensor)->data;
+    case _TENSOR_TYPE_FLOAT_:
+        return (char*)((FloatTensor*)tensor)->data;
+    case _TENSOR_TYPE_DOUBLE_:
+        return (char*)((DoubleTensor*)tensor)->data;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * Gets the size of a single element of the given tensor type.
+ * 
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The size of an element in bytes.
+ */
+static size_t getSizeOfElement(const TensorType tensorType) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        return sizeof(int);
+    case _TENSOR_TYPE_FLOAT_:
+        return sizeof(float);
+    default:
+        return sizeof(double);
+    }
+}
+
 /**
  * Calculates the mean of a given tensor.
  * 
+ * <p><b>Note:</b><br>
+ * The tensor can be a strided view, in which case the rows of consecutive
+ * elements are summed up one after another.
+ * </p>
+ * 
  * @param *tensor       Tensor from which to calculate the mean.
  * @param tensorType    Type of the tensor.
  * 
@@ -84,33 +128,24 @@ double getMeanValue(const void* tensor, const TensorType tensorType) {
     if (tensor == NULL) {
         (void)throwNullPointerException("Tensor can't be NULL for mean calculation.");
         return 0;
+    } else if (tensorType != _TENSOR_TYPE_INTEGER_ && tensorType != _TENSOR_TYPE_FLOAT_
+        && tensorType != _TENSOR_TYPE_DOUBLE_) {
+        (void)throwIllegalArgumentException("No such tensor type.");
+        return 0;
     }
 
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const size_t runLength = Tensor_getContiguousLength(base);
+    const size_t elementSize = getSizeOfElement(tensorType);
+    char* data = getDataOfTensor(tensor, tensorType);
     double mean = 0.0;
-    size_t dataPoints = ((Tensor*)getTensorBaseByType(tensor, tensorType))->dataPoints;
 
-    switch (tensorType) {
-    case _TENSOR_TYPE_INTEGER_: {
-        IntegerTensor* t = (IntegerTensor*)tensor;
-        mean = (double)getSumOfRow(t->data, t->data + t->base->dataPoints, _TENSOR_TYPE_INTEGER_);
-        break;
-    }
-    case _TENSOR_TYPE_FLOAT_: {
-        FloatTensor* t = (FloatTensor*)tensor;
-        mean = (double)getSumOfRow(t->data, t->data + t->base->dataPoints, _TENSOR_TYPE_FLOAT_);
-        break;
-    }
-    case _TENSOR_TYPE_DOUBLE_: {
-        DoubleTensor* t = (DoubleTensor*)tensor;
-        mean = (double)getSumOfRow(t->data, t->data + t->base->dataPoints, _TENSOR_TYPE_DOUBLE_);
-        break;
-    }
-    default:
-        (void)throwIllegalArgumentException("No such tensor type.");
-        return 0;
+    for (size_t index = 0; index < base->dataPoints; index += runLength) {
+        char* start = data + Tensor_getElementOffset(base, index) * elementSize;
+        mean += (double)getSumOfRow(start, start + runLength * elementSize, tensorType);
     }
 
-    return mean / (double)dataPoints;
+    return mean / (double)base->dataPoints;
 }
 
 /**
@@ -151,6 +186,7 @@ double DoubleTensor_getMean(const DoubleTensor* tensor) {
  * 
  * <p><b>Note:</b><br>
  * Try to avoid using this function and refer to the typed functions instead.
+ * The tensor can be a strided view.
  * </p>
  * 
  * @param *tensor       Tensor for which to calculate the standard deviation.
@@ -160,40 +196,46 @@ double DoubleTensor_getMean(const DoubleTensor* tensor) {
  * @return The calculated standard deviation of the given tensor.
  */
 double getStandardDeviation(const void* tensor, const TensorType tensorType, double mean) {
-    size_t dataPoints = ((Tensor*)getTensorBaseByType(tensor, tensorType))->dataPoints;
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const size_t runLength = Tensor_getContiguousLength(base);
+    const size_t dataPoints = base->dataPoints;
     double sum = 0.0;
 
-    switch (tensorType) {
-    case _TENSOR_TYPE_INTEGER_: {
-        int* start = ((IntegerTensor*)tensor)->data;
-        const int* end = start + dataPoints;
+    for (size_t index = 0; index < dataPoints; index += runLength) {
+        const size_t offset = Tensor_getElementOffset(base, index);
 
-        while (start < end) {
-            double delta = *start++ - mean;
-            sum += delta * delta;
+        switch (tensorType) {
+        case _TENSOR_TYPE_INTEGER_: {
+            int* start = ((IntegerTensor*)tensor)->data + offset;
+            const int* end = start + runLength;
+
+            while (start < end) {
+                double delta = *start++ - mean;
+                sum += delta * delta;
+            }
+            break;
         }
-        break;
-    }
-    case _TENSOR_TYPE_FLOAT_: {
-        float* start = ((FloatTensor*)tensor)->data;
-        const float* end = start + dataPoints;
+        case _TENSOR_TYPE_FLOAT_: {
+            float* start = ((FloatTensor*)tensor)->data + offset;
+            const float* end = start + runLength;
 
-        while (start < end) {
-            double delta = *start++ - mean;
-            sum += delta * delta;
+            while (start < end) {
+                double delta = *start++ - mean;
+                sum += delta * delta;
+            }
+            break;
         }
-        break;
-    }
-    case _TENSOR_TYPE_DOUBLE_: {
-        double* start = ((DoubleTensor*)tensor)->data;
-        const double* end = start + dataPoints;
+        case _TENSOR_TYPE_DOUBLE_: {
+            double* start = ((DoubleTensor*)tensor)->data + offset;
+            const double* end = start + runLength;
 
-        while (start < end) {
-            double delta = *start++ - mean;
-            sum += delta * delta;
+            while (start < end) {
+                double delta = *start++ - mean;
+                sum += delta * delta;
+            }
+            break;
+        }
         }
-        break;
-    }
     }
 
     return (double)sqrt(sum / (double)dataPoints);
@@ -40,16 +40,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
  * @param *tensor   Base of a tensor to flatten.
  */
 void flatten(Tensor* tensor) {
-    int* shape = (int*)realloc(tensor->shape, sizeof(int));
-
-    if (shape == NULL) {
-        (void)throwMemoryAllocationException("While trying to allocate memory for tensor flattening.");
-        return;
-    }
-
-    shape[0] = tensor->dataPoints;
-    tensor->shape = shape;
-    tensor->dimensions = 1;
+    const int shape[1] = {(int)tensor->dataPoints};
+    (void)Tensor_setShape(tensor, 1, shape);
 }
 
 /**
@@ -99,16 +91,7 @@ void reshape(Tensor* tensor, const int* newShape, const int dimensions) {
             return;
         }
 
-        int* shape_copy = (int*)malloc(dimensions * sizeof(int));
-
-        if (shape_copy == NULL) {
-            (void)throwMemoryAllocationException("An error occured while trying to reshape a tensor.");
-        }
-    
-        (void)memcpy(shape_copy, newShape, dimensions * sizeof(int));
-        (void)free(tensor->shape);
-        tensor->shape = shape_copy;
-        tensor->dimensions = dimensions;
+        (void)Tensor_setShape(tensor, dimensions, newShape);
 }
 
 /**
@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+
+#include "Tensor/tensor.h"
+#include "Tensor/arena.h"
+#include "Error/exceptions.h"
+
+/**
+ * Creates a TensorArena with the given byte budget.
+ * 
+ * @param capacity  Number of bytes the tensors of the arena can use.
+ * 
+ * @return The created arena.
+ * 
+ * @throws IllegalArgumentException - When the capacity is `0`.
+ * @throws MemoryAllocationException - When the memory could not be allocated.
+ */
+TensorArena* createTensorArena(const size_t capacity) {
+    if (capacity == 0) {
+        (void)throwIllegalArgumentException("The capacity of a tensor arena must be positive.");
+        return NULL;
+    }
+
+    const size_t alignedCapacity = (capacity + TENSOR_DATA_ALIGNMENT - 1)
+                                / TENSOR_DATA_ALIGNMENT * TENSOR_DATA_ALIGNMENT;
+    TensorArena* arena = (TensorArena*)calloc(1, sizeof(TensorArena));
+    char* memory = (char*)aligned_alloc(TENSOR_DATA_ALIGNMENT, alignedCapacity);
+
+    if (arena == NULL || memory == NULL) {
+        if (arena != NULL) (void)free(arena);
+        if (memory != NULL) (void)free(memory);
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a tensor arena.");
+        return NULL;
+    }
+
+    arena->memory = memory;
+    arena->capacity = alignedCapacity;
+    return arena;
+}
+
+/**
+ * Releases all tensors of the arena at once.
+ * 
+ * <p><b>Warning:</b><br>
+ * All tensors created from the arena before the reset become invalid.
+ * Tensors that were reshaped must be freed before, to release their shape.
+ * </p>
+ * 
+ * @param *arena    The arena to reset.
+ */
+void TensorArena_reset(TensorArena* arena) {
+    arena->used = 0;
+}
+
+/**
+ * Returns the number of bytes that are currently in use.
+ * 
+ * @param *arena    The arena.
+ * 
+ * @return The used bytes.
+ */
+size_t TensorArena_getUsedBytes(const TensorArena* arena) {
+    return arena->used;
+}
+
+/**
+ * Returns the highest number of bytes that were in use at the same time,
+ * which helps to choose the budget of an arena.
+ * 
+ * @param *arena    The arena.
+ * 
+ * @return The peak of the used bytes.
+ */
+size_t TensorArena_getPeakBytes(const TensorArena* arena) {
+    return arena->peak;
+}
+
+/**
+ * Frees the given arena with its memory.
+ * 
+ * @param *arena    The arena to free.
+ */
+void TensorArena_free(TensorArena* arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    (void)free(arena->memory);
+    (void)free(arena);
+}
+
+/**
+ * Creates a tensor in the given arena by bumping the used bytes. All
+ * elements will be `0`.
+ * 
+ * <p><b>Note:</b><br>
+ * The tensor has the same layout as a single block tensor. Freeing it is
+ * not necessary, its memory is released by resetting the arena.
+ * </p>
+ * 
+ * @param *arena        Arena to allocate from.
+ * @param dimensions    Number of dimensions the tensor should have.
+ * @param *shape        Shape of the Tensor, with the size of each dimension.
+ * @param tensorType    Data type of the tensor.
+ * 
+ * @return A pointer to the created tensor.
+ * 
+ * @throws NullPointerException - When the arena is `NULL`.
+ * @throws MemoryAllocationException - When the budget of the arena is exhausted.
+ */
+void* createArenaTensor(TensorArena* arena, const int dimensions, const int *shape, const TensorType tensorType) {
+    if (arena == NULL) {
+        (void)throwNullPointerException("Tensor arena must not be NULL!");
+        return NULL;
+    }
+
+    (void)checkDimensionAndShape(dimensions, shape);
+    const size_t blockSize = getTensorBlockSize(dimensions, shape, tensorType);
+
+    if (blockSize > arena->capacity - arena->used) {
+        (void)throwMemoryAllocationException("The budget of the tensor arena is exhausted.");
+        return NULL;
+    }
+
+    void* block = arena->memory + arena->used;
+    arena->used += blockSize;
+    arena->peak = arena->used > arena->peak ? arena->used : arena->peak;
+    return initTensorBlock(block, dimensions, shape, tensorType, TENSOR_ALLOCATION_ARENA);
+}
+
+/**
+ * Creates an integer based tensor in the given arena.
+ * All elements will be `0`.
+ * 
+ * @param *arena        Arena to allocate from.
+ * @param dimensions    The number of dimensions of the tensor.
+ * @param *shape        Shape of the tensor, with the size of each dimension.
+ * 
+ * @return An IntegerTensor pointer, that is valid until the arena is reset.
+ */
+IntegerTensor* IntegerTensor_arenaZeros(TensorArena* arena, const int dimensions, const int *shape) {
+    return (IntegerTensor*)createArenaTensor(arena, dimensions, shape, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a float based tensor in the given arena.
+ * All elements will be `0`.
+ * 
+ * @param *arena        Arena to allocate from.
+ * @param dimensions    The number of dimensions of the tensor.
+ * @param *shape        Shape of the tensor, with the size of each dimension.
+ * 
+ * @return A FloatTensor pointer, that is valid until the arena is reset.
+ */
+FloatTensor* FloatTensor_arenaZeros(TensorArena* arena, const int dimensions, const int *shape) {
+    return (FloatTensor*)createArenaTensor(arena, dimensions, shape, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a double based tensor in the given arena.
+ * All elements will be `0`.
+ * 
+ * @param *arena        Arena to allocate from.
+ * @param dimensions    The number of dimensions of the tensor.
+ * @param *shape        Shape of the tensor, with the size of each dimension.
+ * 
+ * @return A DoubleTensor pointer, that is valid until the arena is reset.
+ */
+DoubleTensor* DoubleTensor_arenaZeros(TensorArena* arena, const int dimensions, const int *shape) {
+    return (DoubleTensor*)createArenaTensor(arena, dimensions, shape, _TENSOR_TYPE_DOUBLE_);
+}
\ No newline at end of file
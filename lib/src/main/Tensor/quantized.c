@@ -0,0 +1,391 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Tensor/quantized.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Allocates the base, the data and the quantization parameters of a
+ * quantized tensor. The parameters are initialized with a scale of `1`
+ * and a zero point of `0`.
+ * 
+ * @param dimensions    Number of dimensions of the tensor.
+ * @param *shape        Shape of the tensor.
+ * @param channels      Number of scales and zero points.
+ * @param **base        Pointer to where the base should be stored.
+ * @param **data        Pointer to where the (zeroed) data should be stored.
+ * @param *parameters   The parameters to allocate.
+ * 
+ * @return `true` on success, `false` when an allocation failed.
+ */
+static int createQuantizedStorage(const int dimensions, const int* shape, const int channels,
+    Tensor** base, void** data, QuantizationParameters* parameters) {
+    *base = createTensorBase(dimensions, shape);
+
+    if (*base == NULL) {
+        return false;
+    }
+
+    // The quantized convolution copies the taps of a kernel row in groups of
+    // four, the last group of the last row may read up to 3 bytes behind the data.
+    *data = calloc((*base)->dataPoints + sizeof(int32_t), sizeof(uint8_t));
+    parameters->channels = channels;
+    parameters->scales = (float*)malloc(channels * sizeof(float));
+    parameters->zeroPoints = (int*)calloc(channels, sizeof(int));
+
+    if (*data == NULL || parameters->scales == NULL || parameters->zeroPoints == NULL) {
+        (void)freeTensor(*base);
+        if (*data != NULL) (void)free(*data);
+        if (parameters->scales != NULL) (void)free(parameters->scales);
+        if (parameters->zeroPoints != NULL) (void)free(parameters->zeroPoints);
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a quantized tensor.");
+        return false;
+    }
+
+    for (int c = 0; c < channels; c++) {
+        parameters->scales[c] = 1.0f;
+    }
+
+    return true;
+}
+
+/**
+ * Gets the number of quantization channels of a tensor.
+ * 
+ * @param *base         Base of the tensor.
+ * @param perChannel    Whether every index of the first dimension gets own parameters.
+ * 
+ * @return The number of channels.
+ */
+static int getQuantizationChannels(const Tensor* base, const int perChannel) {
+    return perChannel && base->dimensions > 0 && base->shape[0] > 0 ? base->shape[0] : 1;
+}
+
+/**
+ * Gets the value of the given row-major index of a float tensor, that can
+ * be a strided view.
+ * 
+ * @param *tensor   The tensor.
+ * @param index     Row-major index of the element.
+ * 
+ * @return The value of the element.
+ */
+static inline float getFloatValue(const FloatTensor* tensor, const size_t index) {
+    return tensor->data[Tensor_getElementOffset(tensor->base, index)];
+}
+
+/**
+ * Quantizes a real value.
+ * 
+ * @param value         The real value.
+ * @param scale         Scale of the channel.
+ * @param zeroPoint     Zero point of the channel.
+ * @param min           Smallest storable value.
+ * @param max           Largest storable value.
+ * 
+ * @return The rounded and saturated stored value.
+ */
+static inline int quantizeValue(const float value, const float scale, const int zeroPoint,
+    const int min, const int max) {
+    const long rounded = lrintf(value / scale) + zeroPoint;
+    return rounded < min ? min : rounded > max ? max : (int)rounded;
+}
+
+/**
+ * Creates an Uint8Tensor with the given shape and a single scale and zero
+ * point (e.g. the calibrated range of the activations of a layer). All
+ * stored values are `0`.
+ * 
+ * @param dimensions    Number of dimensions the tensor should have.
+ * @param *shape        Shape of the tensor.
+ * @param scale         Real distance between two neighbouring stored values.
+ * @param zeroPoint     Stored value of a real zero (0 - 255).
+ * 
+ * @return The new tensor.
+ * 
+ * @throw IllegalArgumentException - When the scale is not positive or the zero point is not storable.
+ */
+Uint8Tensor* Uint8Tensor_zeros(const int dimensions, const int* shape, const float scale, const int zeroPoint) {
+    if (!(scale > 0.0f) || zeroPoint < 0 || zeroPoint > UINT8_MAX) {
+        (void)throwIllegalArgumentException("The scale must be positive and the zero point in [0; 255].");
+        return NULL;
+    }
+
+    Uint8Tensor* tensor = (Uint8Tensor*)calloc(1, sizeof(Uint8Tensor));
+
+    if (tensor == NULL) {
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a quantized tensor.");
+        return NULL;
+    } else if (createQuantizedStorage(dimensions, shape, 1, &tensor->base, (void**)&tensor->data,
+                &tensor->quantization) == false) {
+        (void)free(tensor);
+        return NULL;
+    }
+
+    tensor->quantization.scales[0] = scale;
+    tensor->quantization.zeroPoints[0] = zeroPoint;
+    return tensor;
+}
+
+/**
+ * Quantizes a FloatTensor symmetrically into signed 8 bits. The scale of a
+ * channel maps its largest absolute value to `127`, all zero points are `0`.
+ * 
+ * <p><b>Note:</b><br>
+ * Per channel quantization should be used for the weights of filter banks,
+ * since the filters often have different ranges.
+ * </p>
+ * 
+ * @param *tensor       The tensor to quantize.
+ * @param perChannel    Whether every index of the first dimension gets an own scale.
+ * 
+ * @return The quantized tensor.
+ * 
+ * @throw NullPointerException - When the tensor is `NULL`.
+ */
+Int8Tensor* Int8Tensor_quantize(const FloatTensor* tensor, const int perChannel) {
+    if (tensor == NULL) {
+        (void)throwNullPointerException("The tensor to quantize must not be NULL.");
+        return NULL;
+    }
+
+    const Tensor* base = tensor->base;
+    const int channels = getQuantizationChannels(base, perChannel);
+    const size_t length = base->dataPoints / channels;
+    Int8Tensor* quantized = (Int8Tensor*)calloc(1, sizeof(Int8Tensor));
+
+    if (quantized == NULL) {
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a quantized tensor.");
+        return NULL;
+    } else if (createQuantizedStorage(base->dimensions, base->shape, channels, &quantized->base,
+                (void**)&quantized->data, &quantized->quantization) == false) {
+        (void)free(quantized);
+        return NULL;
+    }
+
+    for (int c = 0; c < channels; c++) {
+        float maximum = 0.0f;
+
+        for (size_t i = c * length; i < (c + 1) * length; i++) {
+            const float value = fabsf(getFloatValue(tensor, i));
+            maximum = value > maximum ? value : maximum;
+        }
+
+        const float scale = maximum > 0.0f ? maximum / INT8_MAX : 1.0f;
+        quantized->quantization.scales[c] = scale;
+
+        for (size_t i = c * length; i < (c + 1) * length; i++) {
+            quantized->data[i] = (int8_t)quantizeValue(getFloatValue(tensor, i), scale, 0, -INT8_MAX, INT8_MAX);
+        }
+    }
+
+    return quantized;
+}
+
+/**
+ * Quantizes a FloatTensor asymmetrically into unsigned 8 bits. The range of
+ * a channel (extended to contain `0`) is mapped to `[0; 255]`, so a real
+ * zero is stored exactly.
+ * 
+ * @param *tensor       The tensor to quantize.
+ * @param perChannel    Whether every index of the first dimension gets own parameters.
+ * 
+ * @return The quantized tensor.
+ * 
+ * @throw NullPointerException - When the tensor is `NULL`.
+ */
+Uint8Tensor* Uint8Tensor_quantize(const FloatTensor* tensor, const int perChannel) {
+    if (tensor == NULL) {
+        (void)throwNullPointerException("The tensor to quantize must not be NULL.");
+        return NULL;
+    }
+
+    const Tensor* base = tensor->base;
+    const int channels = getQuantizationChannels(base, perChannel);
+    const size_t length = base->dataPoints / channels;
+    Uint8Tensor* quantized = (Uint8Tensor*)calloc(1, sizeof(Uint8Tensor));
+
+    if (quantized == NULL) {
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a quantized tensor.");
+        return NULL;
+    } else if (createQuantizedStorage(base->dimensions, base->shape, channels, &quantized->base,
+                (void**)&quantized->data, &quantized->quantization) == false) {
+        (void)free(quantized);
+        return NULL;
+    }
+
+    for (int c = 0; c < channels; c++) {
+        float minimum = 0.0f;
+        float maximum = 0.0f;
+
+        for (size_t i = c * length; i < (c + 1) * length; i++) {
+            const float value = getFloatValue(tensor, i);
+            minimum = value < minimum ? value : minimum;
+            maximum = value > maximum ? value : maximum;
+        }
+
+        const float scale = maximum > minimum ? (maximum - minimum) / UINT8_MAX : 1.0f;
+        const int zeroPoint = quantizeValue(-minimum, scale, 0, 0, UINT8_MAX);
+        quantized->quantization.scales[c] = scale;
+        quantized->quantization.zeroPoints[c] = zeroPoint;
+
+        for (size_t i = c * length; i < (c + 1) * length; i++) {
+            quantized->data[i] = (uint8_t)quantizeValue(getFloatValue(tensor, i), scale, zeroPoint, 0, UINT8_MAX);
+        }
+    }
+
+    return quantized;
+}
+
+/**
+ * Quantizes a FloatTensor with the parameters of the destination, e.g. the
+ * input of a network with a calibrated range. Values outside of the range
+ * are saturated.
+ * 
+ * @param *tensor   The tensor to quantize.
+ * @param *dest     Destination with the same number of elements.
+ * 
+ * @throw NullPointerException - When a tensor is `NULL`.
+ * @throw IllegalArgumentException - When the number of elements differs.
+ */
+void Uint8Tensor_quantizeInto(const FloatTensor* tensor, const Uint8Tensor* dest) {
+    if (tensor == NULL || dest == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a quantization.");
+        return;
+    } else if (tensor->base->dataPoints != dest->base->dataPoints) {
+        (void)throwIllegalArgumentException("The tensors of a quantization must have the same number of elements.");
+        return;
+    }
+
+    const QuantizationParameters* parameters = &dest->quantization;
+    const size_t length = dest->base->dataPoints / parameters->channels;
+
+    for (size_t i = 0; i < dest->base->dataPoints; i++) {
+        const int c = (int)(i / length);
+        dest->data[i] = (uint8_t)quantizeValue(getFloatValue(tensor, i), parameters->scales[c],
+                            parameters->zeroPoints[c], 0, UINT8_MAX);
+    }
+}
+
+/**
+ * Converts the stored values of an Int8Tensor back to real values.
+ * 
+ * @param *tensor   The quantized tensor.
+ * @param *dest     Destination with the same number of elements.
+ * 
+ * @throw NullPointerException - When a tensor is `NULL`.
+ * @throw IllegalArgumentException - When the number of elements differs.
+ */
+void Int8Tensor_dequantize(const Int8Tensor* tensor, const FloatTensor* dest) {
+    if (tensor == NULL || dest == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a dequantization.");
+        return;
+    } else if (tensor->base->dataPoints != dest->base->dataPoints) {
+        (void)throwIllegalArgumentException("The tensors of a dequantization must have the same number of elements.");
+        return;
+    }
+
+    const QuantizationParameters* parameters = &tensor->quantization;
+    const size_t length = tensor->base->dataPoints / parameters->channels;
+
+    for (size_t i = 0; i < tensor->base->dataPoints; i++) {
+        const int c = (int)(i / length);
+        dest->data[Tensor_getElementOffset(dest->base, i)] =
+            (float)(tensor->data[i] - parameters->zeroPoints[c]) * parameters->scales[c];
+    }
+}
+
+/**
+ * Converts the stored values of an Uint8Tensor back to real values.
+ * 
+ * @param *tensor   The quantized tensor.
+ * @param *dest     Destination with the same number of elements.
+ * 
+ * @throw NullPointerException - When a tensor is `NULL`.
+ * @throw IllegalArgumentException - When the number of elements differs.
+ */
+void Uint8Tensor_dequantize(const Uint8Tensor* tensor, const FloatTensor* dest) {
+    if (tensor == NULL || dest == NULL) {
+        (void)throwNullPointerException("No tensor is allowed to be NULL at a dequantization.");
+        return;
+    } else if (tensor->base->dataPoints != dest->base->dataPoints) {
+        (void)throwIllegalArgumentException("The tensors of a dequantization must have the same number of elements.");
+        return;
+    }
+
+    const QuantizationParameters* parameters = &tensor->quantization;
+    const size_t length = tensor->base->dataPoints / parameters->channels;
+
+    for (size_t i = 0; i < tensor->base->dataPoints; i++) {
+        const int c = (int)(i / length);
+        dest->data[Tensor_getElementOffset(dest->base, i)] =
+            (float)(tensor->data[i] - parameters->zeroPoints[c]) * parameters->scales[c];
+    }
+}
+
+/**
+ * Frees the quantization parameters of a tensor.
+ * 
+ * @param *parameters   The parameters to free.
+ */
+static void freeQuantizationParameters(QuantizationParameters* parameters) {
+    (void)free(parameters->scales);
+    (void)free(parameters->zeroPoints);
+}
+
+/**
+ * Frees the given Int8Tensor with its data and parameters.
+ * 
+ * @param *tensor   The tensor to free.
+ */
+void freeInt8Tensor(Int8Tensor* tensor) {
+    if (tensor == NULL) {
+        return;
+    }
+
+    (void)freeTensor(tensor->base);
+    (void)free(tensor->data);
+    (void)freeQuantizationParameters(&tensor->quantization);
+    (void)free(tensor);
+}
+
+/**
+ * Frees the given Uint8Tensor with its data and parameters.
+ * 
+ * @param *tensor   The tensor to free.
+ */
+void freeUint8Tensor(Uint8Tensor* tensor) {
+    if (tensor == NULL) {
+        return;
+    }
+
+    (void)freeTensor(tensor->base);
+    (void)free(tensor->data);
+    (void)freeQuantizationParameters(&tensor->quantization);
+    (void)free(tensor);
+}
\ No newline at end of file
@@ -26,26 +26,90 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <stdint.h>
 
 #include "Tensor/tensor.h"
+#include "Utils/threadPool.h"
 #include "Error/exceptions.h"
 
+#define true 1
+#define false 0
+
 enum PrintFormat {
     DECIMAL,
     FLOAT,
     DOUBLE
 };
 
+void initTensorByValue(const void* tensor, const TensorType tensorType, const double value);
+
+/**
+ * Layout in which new tensors are allocated.
+ */
+static TensorAllocation TENSOR_ALLOCATION_MODE = TENSOR_ALLOCATION_SEPARATE;
+
+/**
+ * Rounds the given size up to the next multiple of the alignment.
+ * 
+ * @param size          Size to round up.
+ * @param alignment     Alignment to round to.
+ * 
+ * @return The aligned size.
+ */
+static size_t alignSize(const size_t size, const size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * Checks whether the shape of the given base still lives inside the block of
+ * a single block or arena tensor. It is moved out of it, when the tensor gets
+ * reshaped.
+ * 
+ * @param *tensor   Tensor base to check.
+ * 
+ * @return `true` when the shape must not be freed separately.
+ */
+static int isShapeEmbedded(const Tensor* tensor) {
+    return tensor->allocation != TENSOR_ALLOCATION_SEPARATE
+        && tensor->shape == (int*)(tensor + 1) ? true : false;
+}
+
 /**
  * Frees a given Tensor base.
  * 
  * @param *tensor   Tensor to free.
  */
 void freeTensor(Tensor* tensor) {
-    if (tensor->shape != NULL) {
+    if (tensor->shape != NULL && isShapeEmbedded(tensor) == false) {
         (void)free(tensor->shape);
         tensor->shape = NULL;
     }
 
-    (void)free(tensor);
+    if (tensor->allocation == TENSOR_ALLOCATION_SEPARATE) {
+        (void)free(tensor);
+    }
+}
+
+/**
+ * Frees the given tensor, when it was allocated as a single block. Tensors
+ * of an arena only release a shape, that was moved out by a reshape, the
+ * block itself is released by the arena.
+ * 
+ * @param *tensor   The tensor to free.
+ * @param *base     The base of the tensor.
+ * 
+ * @return `true` when the tensor was freed, `false` when it is separately allocated.
+ */
+static int freeTensorBlock(void* tensor, Tensor* base) {
+    if (base == NULL || base->allocation == TENSOR_ALLOCATION_SEPARATE) {
+        return false;
+    }
+
+    const TensorAllocation allocation = base->allocation;
+    (void)freeTensor(base);
+
+    if (allocation == TENSOR_ALLOCATION_SINGLE_BLOCK) {
+        (void)free(tensor);
+    }
+
+    return true;
 }
 
 /**
@@ -54,12 +118,18 @@ void freeTensor(Tensor* tensor) {
  * @param tensor    The tensor to free.
  */
 void freeIntegerTensor(IntegerTensor* tensor) {
+    if (freeTensorBlock(tensor, tensor->base) == true) {
+        return;
+    }
+
+    const int ownsData = tensor->base == NULL || tensor->base->ownsData == true;
+
     if (tensor->base != NULL) {
         (void)freeTensor(tensor->base);
         tensor->base = NULL;
     }
 
-    if (tensor->data != NULL) {
+    if (tensor->data != NULL && ownsData == true) {
         (void)free(tensor->data);
         tensor->data = NULL;
     }
@@ -73,12 +143,18 @@ void freeIntegerTensor(IntegerTensor* tensor) {
  * @param tensor    The tensor to free.
  */
 void freeFloatTensor(FloatTensor* tensor) {
+    if (freeTensorBlock(tensor, tensor->base) == true) {
+        return;
+    }
+
+    const int ownsData = tensor->base == NULL || tensor->base->ownsData == true;
+
     if (tensor->base != NULL) {
         (void)freeTensor(tensor->base);
         tensor->base = NULL;
     }
 
-    if (tensor->data != NULL) {
+    if (tensor->data != NULL && ownsData == true) {
         (void)free(tensor->data);
         tensor->data = NULL;
     }
@@ -92,12 +168,18 @@ void freeFloatTensor(FloatTensor* tensor) {
  * @param tensor    The tensor to free.
  */
 void freeDoubleTensor(DoubleTensor* tensor) {
+    if (freeTensorBlock(tensor, tensor->base) == true) {
+        return;
+    }
+
+    const int ownsData = tensor->base == NULL || tensor->base->ownsData == true;
+
     if (tensor->base != NULL) {
         (void)freeTensor(tensor->base);
         tensor->base = NULL;
     }
 
-    if (tensor->data != NULL) {
+    if (tensor->data != NULL && ownsData == true) {
         (void)free(tensor->data);
         tensor->data = NULL;
     }
@@ -153,6 +235,21 @@ size_t countNumberOfDataIndexes(const int dimensions, const int *shape) {
     return numberOfDataIndexes;
 }
 
+/**
+ * Sets the strides of the given tensor base to the ones of a dense
+ * row-major tensor.
+ * 
+ * @param *tensor   Tensor base with the shape already set.
+ */
+static void setDenseStrides(Tensor* tensor) {
+    int stride = 1;
+
+    for (int i = tensor->dimensions - 1; i >= 0; i--) {
+        tensor->strides[i] = stride;
+        stride *= tensor->shape[i];
+    }
+}
+
 /**
  * Creates a base tensor with the given parameters.
  * 
@@ -166,54 +263,355 @@ Tensor* createTensorBase(const int dimensions, const int *shape) {
     const size_t numberOfDataIndexes = (size_t)countNumberOfDataIndexes(dimensions, shape);
 
     Tensor* tensor = (Tensor*)calloc(1, sizeof(Tensor));
-    int* shape_copy = (int*)malloc(dimensions * sizeof(int));
+    int* shape_copy = (int*)malloc(2 * dimensions * sizeof(int));
 
     if (tensor == NULL || shape_copy == NULL) {
         if (tensor) (void)free(tensor);
         if (shape_copy) (void)free(shape_copy);
         (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a tensor.");
+        return NULL;
     }
 
     (void)memcpy(shape_copy, shape, dimensions * sizeof(int));
     tensor->shape = shape_copy;
+    tensor->strides = shape_copy + dimensions;
     tensor->dimensions = dimensions;
     tensor->dataPoints = numberOfDataIndexes;
+    tensor->allocation = TENSOR_ALLOCATION_SEPARATE;
+    tensor->offset = 0;
+    tensor->ownsData = true;
+    (void)setDenseStrides(tensor);
     return tensor;
 }
 
+/**
+ * Gets the sizes of the tensor struct and of a single element for the
+ * given tensor type.
+ * 
+ * @param tensorType        Type of the tensor.
+ * @param *sizeOfTensor     Pointer to write the size of the tensor struct to.
+ * @param *sizeOfElement    Pointer to write the size of an element to.
+ * 
+ * @return `true` when the type exists, `false` if not.
+ */
+static int getTensorTypeSizes(const TensorType tensorType, size_t* sizeOfTensor, size_t* sizeOfElement) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        *sizeOfTensor = sizeof(IntegerTensor);
+        *sizeOfElement = sizeof(int);
+        return true;
+    case _TENSOR_TYPE_FLOAT_:
+        *sizeOfTensor = sizeof(FloatTensor);
+        *sizeOfElement = sizeof(float);
+        return true;
+    case _TENSOR_TYPE_DOUBLE_:
+        *sizeOfTensor = sizeof(DoubleTensor);
+        *sizeOfElement = sizeof(double);
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * Sets the base and data of a typed tensor.
+ * 
+ * @param *tensor       The typed tensor.
+ * @param tensorType    Type of the tensor.
+ * @param *base         Base to set.
+ * @param *data         Data to set.
+ */
+static void setTensorFields(void* tensor, const TensorType tensorType, Tensor* base, void* data) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        ((IntegerTensor*)tensor)->base = base;
+        ((IntegerTensor*)tensor)->data = (int*)data;
+        break;
+    case _TENSOR_TYPE_FLOAT_:
+        ((FloatTensor*)tensor)->base = base;
+        ((FloatTensor*)tensor)->data = (float*)data;
+        break;
+    case _TENSOR_TYPE_DOUBLE_:
+        ((DoubleTensor*)tensor)->base = base;
+        ((DoubleTensor*)tensor)->data = (double*)data;
+        break;
+    }
+}
+
+/**
+ * Gets the offsets of the base and the data in a single block tensor.
+ * 
+ * @param dimensions    Number of dimensions of the tensor.
+ * @param tensorType    Data type of the tensor.
+ * @param *baseOffset   Pointer to write the offset of the base to.
+ * 
+ * @return The offset of the data in the block.
+ */
+static size_t getTensorBlockOffsets(const int dimensions, const TensorType tensorType, size_t* baseOffset) {
+    size_t sizeOfTensor = 0;
+    size_t sizeOfElement = 0;
+    (void)getTensorTypeSizes(tensorType, &sizeOfTensor, &sizeOfElement);
+
+    *baseOffset = alignSize(sizeOfTensor, _Alignof(Tensor));
+    return alignSize(*baseOffset + sizeof(Tensor) + 2 * dimensions * sizeof(int), TENSOR_DATA_ALIGNMENT);
+}
+
+/**
+ * Gets the number of bytes a tensor needs, when it lives in a single
+ * block of memory. The size is a multiple of `TENSOR_DATA_ALIGNMENT`.
+ * 
+ * @param dimensions    Number of dimensions the tensor should have.
+ * @param *shape        Shape of the Tensor, with the size of each dimension.
+ * @param tensorType    Data type of the tensor.
+ * 
+ * @return The size of the block in bytes.
+ * 
+ * @see #initTensorBlock(void* block, const int dimensions, const int *shape,
+    const TensorType tensorType, const TensorAllocation allocation)
+ */
+size_t getTensorBlockSize(const int dimensions, const int *shape, const TensorType tensorType) {
+    size_t sizeOfTensor = 0;
+    size_t sizeOfElement = 0;
+    size_t baseOffset = 0;
+    (void)getTensorTypeSizes(tensorType, &sizeOfTensor, &sizeOfElement);
+
+    const size_t dataPoints = (size_t)countNumberOfDataIndexes(dimensions, shape);
+    const size_t dataOffset = getTensorBlockOffsets(dimensions, tensorType, &baseOffset);
+    return alignSize(dataOffset + dataPoints * sizeOfElement, TENSOR_DATA_ALIGNMENT);
+}
+
+/**
+ * Creates a tensor inside the given block of memory. All elements are
+ * set to `0`.
+ * 
+ * <p><b>Layout:</b><br>
+ * `[Typed tensor][Tensor base][Shape][Strides][Padding][Data]`<br>
+ * The block must be aligned to `TENSOR_DATA_ALIGNMENT` bytes and hold at
+ * least `getTensorBlockSize()` bytes, so the data can be loaded with aligned
+ * (AVX-512) loads.
+ * </p>
+ * 
+ * @param *block        Memory in which to create the tensor.
+ * @param dimensions    Number of dimensions the tensor should have.
+ * @param *shape        Shape of the Tensor, with the size of each dimension.
+ * @param tensorType    Data type of the tensor.
+ * @param allocation    Owner of the block (determines how the tensor is freed).
+ * 
+ * @return A pointer to the created tensor (the start of the block).
+ */
+void* initTensorBlock(void* block, const int dimensions, const int *shape,
+    const TensorType tensorType, const TensorAllocation allocation) {
+    size_t baseOffset = 0;
+    const size_t dataOffset = getTensorBlockOffsets(dimensions, tensorType, &baseOffset);
+    char* memory = (char*)block;
+
+    (void)memset(memory, 0, dataOffset);
+    Tensor* base = (Tensor*)(memory + baseOffset);
+    int* shape_copy = (int*)(base + 1);
+
+    (void)memcpy(shape_copy, shape, dimensions * sizeof(int));
+    base->shape = shape_copy;
+    base->strides = shape_copy + dimensions;
+    base->dimensions = dimensions;
+    base->dataPoints = (size_t)countNumberOfDataIndexes(dimensions, shape);
+    base->allocation = allocation;
+    base->ownsData = true;
+    (void)setDenseStrides(base);
+
+    (void)setTensorFields(memory, tensorType, base, memory + dataOffset);
+    (void)initTensorByValue(memory, tensorType, 0);
+    return memory;
+}
+
+/**
+ * Creates a tensor, that lives in a single block of memory. Creating and
+ * freeing such a tensor needs a single allocation and a single free.
+ * 
+ * @param dimensions    Number of dimensions the tensor should have.
+ * @param *shape        Shape of the Tensor, with the size of each dimension.
+ * @param tensorType    Data type of the tensor.
+ * 
+ * @return A pointer to the created tensor, with all elements set to `0`.
+ */
+static void* createTensorBlock(const int dimensions, const int *shape, const TensorType tensorType) {
+    const size_t blockSize = getTensorBlockSize(dimensions, shape, tensorType);
+    void* block = aligned_alloc(TENSOR_DATA_ALIGNMENT, blockSize);
+
+    if (block == NULL) {
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a tensor.");
+        return NULL;
+    }
+
+    return initTensorBlock(block, dimensions, shape, tensorType, TENSOR_ALLOCATION_SINGLE_BLOCK);
+}
+
+/**
+ * Sets the layout in which new tensors are allocated.
+ * 
+ * <p><b>Note:</b><br>
+ * Already existing tensors keep their layout, all tensors can be freed
+ * by the regular free functions regardless of the layout.
+ * </p>
+ * 
+ * @param allocation    The layout for new tensors.
+ * 
+ * @throws IllegalArgumentException - When the layout is `TENSOR_ALLOCATION_ARENA`.
+ */
+void setTensorAllocationMode(const TensorAllocation allocation) {
+    if (allocation == TENSOR_ALLOCATION_ARENA) {
+        (void)throwIllegalArgumentException("Arena tensors can only be created by a TensorArena.");
+        return;
+    }
+
+    TENSOR_ALLOCATION_MODE = allocation;
+}
+
+/**
+ * Returns the layout in which new tensors are allocated.
+ * 
+ * @return The current TensorAllocation.
+ */
+TensorAllocation getTensorAllocationMode() {
+    return TENSOR_ALLOCATION_MODE;
+}
+
+/**
+ * Replaces the shape of the given tensor base. The number of datapoints
+ * must be checked by the caller.
+ * 
+ * <p><b>Note:</b><br>
+ * Only contiguous tensors can be reshaped, the strides are reset to
+ * the ones of a dense tensor with the new shape.
+ * </p>
+ * 
+ * @param *tensor       Tensor base to change.
+ * @param dimensions    Number of dimensions of the new shape.
+ * @param *shape        The new shape.
+ * 
+ * @throws IllegalArgumentException - When the tensor is a non-contiguous view.
+ * @throws MemoryAllocationException - When the new shape could not be allocated.
+ */
+void Tensor_setShape(Tensor* tensor, const int dimensions, const int *shape) {
+    if (Tensor_isContiguous(tensor) == false) {
+        (void)throwIllegalArgumentException("Only contiguous tensors can be reshaped.");
+        return;
+    }
+
+    int* shape_copy = (int*)malloc(2 * dimensions * sizeof(int));
+
+    if (shape_copy == NULL) {
+        (void)throwMemoryAllocationException("An error occured while trying to reshape a tensor.");
+        return;
+    }
+
+    (void)memcpy(shape_copy, shape, dimensions * sizeof(int));
+
+    if (isShapeEmbedded(tensor) == false) {
+        (void)free(tensor->shape);
+    }
+
+    tensor->shape = shape_copy;
+    tensor->strides = shape_copy + dimensions;
+    tensor->dimensions = dimensions;
+    (void)setDenseStrides(tensor);
+}
+
+/**
+ * Gets the number of elements from the end of the tensor, that are stored
+ * consecutively in the data (dense innermost dimensions).
+ * 
+ * <p><b>Note:</b><br>
+ * The data of the tensor is a sequence of runs with this length. Each run
+ * starts at the offset of its first element.
+ * </p>
+ * 
+ * @param *tensor   Tensor base to check.
+ * 
+ * @return The length of the consecutive runs in the data.
+ * 
+ * @see #Tensor_getElementOffset(const Tensor* tensor, const size_t index)
+ */
+size_t Tensor_getContiguousLength(const Tensor* tensor) {
+    size_t length = 1;
+
+    for (int i = tensor->dimensions - 1; i >= 0; i--) {
+        if (tensor->shape[i] == 1) {
+            continue;
+        } else if ((size_t)tensor->strides[i] != length) {
+            break;
+        }
+
+        length *= tensor->shape[i];
+    }
+
+    return length;
+}
+
+/**
+ * Checks whether the data of the given tensor is stored dense in
+ * row-major order.
+ * 
+ * @param *tensor   Tensor base to check.
+ * 
+ * @return `true` when the tensor is contiguous, `false` if not.
+ */
+int Tensor_isContiguous(const Tensor* tensor) {
+    return tensor->dataPoints == 0
+        || Tensor_getContiguousLength(tensor) == tensor->dataPoints ? true : false;
+}
+
+/**
+ * Gets the offset in the data of the element at the given row-major
+ * index.
+ * 
+ * @param *tensor   Tensor base of the tensor.
+ * @param index     Row-major index of the element (as in a dense tensor).
+ * 
+ * @return The offset of the element in the data.
+ */
+size_t Tensor_getElementOffset(const Tensor* tensor, const size_t index) {
+    size_t rest = index;
+    size_t offset = 0;
+
+    for (int i = tensor->dimensions - 1; i >= 0 && rest > 0; i--) {
+        offset += (rest % tensor->shape[i]) * tensor->strides[i];
+        rest /= tensor->shape[i];
+    }
+
+    return offset;
+}
+
 /**
  * Creates an Tensor with the given dimension, shape and data type.
  * All elements will be `0`.
  * 
+ * <p><b>Note:</b><br>
+ * The layout of the tensor depends on the allocation mode.
+ * </p>
+ * 
  * @param dimensions    Number of dimensions the tensor should have.
  * @param *shape        Shape of the Tensor, with the size of each dimension.
  * @param tensorType    Data type of the tensor.
  * 
  * @return A pointer to the created Tensor with the metadata in `tensor->base` and
  * data in `tensor->tensor`.
+ * 
+ * @see #setTensorAllocationMode(const TensorAllocation allocation)
  */
 void* createTensor(const int dimensions, const int *shape, const TensorType tensorType) {
     size_t sizeOfTensor = 0;
     size_t sizeOfElement = 0;
 
-    switch (tensorType) {
-    case _TENSOR_TYPE_INTEGER_:
-        sizeOfTensor = sizeof(IntegerTensor);
-        sizeOfElement = sizeof(int);
-        break;
-    case _TENSOR_TYPE_FLOAT_:
-        sizeOfTensor = sizeof(FloatTensor);
-        sizeOfElement = sizeof(float);
-        break;
-    case _TENSOR_TYPE_DOUBLE_:
-        sizeOfTensor = sizeof(DoubleTensor);
-        sizeOfElement = sizeof(double);
-        break;
-    default:
+    if (getTensorTypeSizes(tensorType, &sizeOfTensor, &sizeOfElement) == false) {
         (void)throwIllegalArgumentException("The tensor type does not exist!");
         return NULL;
     }
 
+    if (TENSOR_ALLOCATION_MODE == TENSOR_ALLOCATION_SINGLE_BLOCK) {
+        (void)checkDimensionAndShape(dimensions, shape);
+        return createTensorBlock(dimensions, shape, tensorType);
+    }
+
     Tensor* base = (Tensor*)createTensorBase(dimensions, shape);
     
     // Error handling in tensor base creation.
@@ -232,62 +630,61 @@ void* createTensor(const int dimensions, const int *shape, const TensorType tens
         return NULL;
     }
 
-    switch (tensorType) {
-    case _TENSOR_TYPE_INTEGER_:
-        ((IntegerTensor*)tensor)->base = base;
-        ((IntegerTensor*)tensor)->data = (int*)data;
-        break;
-    case _TENSOR_TYPE_FLOAT_:
-        ((FloatTensor*)tensor)->base = base;
-        ((FloatTensor*)tensor)->data = (float*)data;
-        break;
-    case _TENSOR_TYPE_DOUBLE_:
-        ((DoubleTensor*)tensor)->base = base;
-        ((DoubleTensor*)tensor)->data = (double*)data;
-        break;
-    default:
-        (void)throwIllegalArgumentException("The tensor type does not exist!");
-        return NULL;
-    }
-
+    (void)setTensorFields(tensor, tensorType, base, data);
     return tensor;
 }
 
 /**
- * Sets the values of the given tensor to the given value.
+ * Minimum number of elements a thread fills per chunk.
+ */
+#define FILL_GRAIN_SIZE 65536
+
+/**
+ * Parameters of a fill operation that is split across threads.
+ */
+typedef struct {
+    void* data;
+    double value;
+    TensorType tensorType;
+} FillContext;
+
+/**
+ * Sets the elements in the range [start; end) to the value of the context.
  * 
- * @param *tensor       The Tensor to set.
- * @param tensorType    Type of the given Tensor.
- * @param value         The value to set to each element.
+ * @param start     First element to set.
+ * @param end       End of the elements to set (exclusive).
+ * @param *context  The FillContext.
  */
-void initTensorByValue(const void* tensor, const TensorType tensorType, const double value) {
-    switch (tensorType) {
+static void fillTask(const size_t start, const size_t end, void* context) {
+    const FillContext* fill = (FillContext*)context;
+
+    switch (fill->tensorType) {
     case _TENSOR_TYPE_INTEGER_: {
-        int* data = (int*)((IntegerTensor*)tensor)->data;
-        const int* end = data + ((IntegerTensor*)tensor)->base->dataPoints;
+        int* data = (int*)fill->data + start;
+        const int* endPtr = (int*)fill->data + end;
 
-        while (data < end) {
-            *data++ = (int)value;
+        while (data < endPtr) {
+            *data++ = (int)fill->value;
         }
 
         break;
     }
     case _TENSOR_TYPE_FLOAT_: {
-        float* data = (float*)((FloatTensor*)tensor)->data;
-        const float* end = data + ((FloatTensor*)tensor)->base->dataPoints;
+        float* data = (float*)fill->data + start;
+        const float* endPtr = (float*)fill->data + end;
 
-        while (data < end) {
-            *data++ = (float)value;
+        while (data < endPtr) {
+            *data++ = (float)fill->value;
         }
 
         break;
     }
     case _TENSOR_TYPE_DOUBLE_: {
-        double* data = (double*)((DoubleTensor*)tensor)->data;
-        const double* end = data + ((DoubleTensor*)tensor)->base->dataPoints;
+        double* data = (double*)fill->data + start;
+        const double* endPtr = (double*)fill->data + end;
 
-        while (data < end) {
-            *data++ = (double)value;
+        while (data < endPtr) {
+            *data++ = (double)fill->value;
         }
 
         break;
@@ -295,6 +692,32 @@ void initTensorByValue(const void* tensor, const TensorType tensorType, const do
     }
 }
 
+/**
+ * Sets the values of the given tensor to the given value.
+ * 
+ * @param *tensor       The Tensor to set.
+ * @param tensorType    Type of the given Tensor.
+ * @param value         The value to set to each element.
+ */
+void initTensorByValue(const void* tensor, const TensorType tensorType, const double value) {
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    FillContext context = {NULL, value, tensorType};
+
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        context.data = ((IntegerTensor*)tensor)->data;
+        break;
+    case _TENSOR_TYPE_FLOAT_:
+        context.data = ((FloatTensor*)tensor)->data;
+        break;
+    case _TENSOR_TYPE_DOUBLE_:
+        context.data = ((DoubleTensor*)tensor)->data;
+        break;
+    }
+
+    (void)parallelFor(0, base->dataPoints, FILL_GRAIN_SIZE, fillTask, &context);
+}
+
 /**
  * Creates an integer based tensor with the given parameters.
  * All elements will be `0`.
@@ -421,18 +844,19 @@ void printTensor(const void* tensor, const Tensor* base, const int dim,
     const int ptr, const int* jumpTable, const enum PrintFormat format) {
     if (dim >= base->dimensions - 1) {
         const int width = base->shape[base->dimensions - 1];
+        const int step = jumpTable[base->dimensions - 1];
         (void)printf("[");
 
         for (int i = 0; i < width; i++) {
             switch (format) {
             case DECIMAL:
-                (void)printf("%d", ((int*)tensor)[ptr + i]);
+                (void)printf("%d", ((int*)tensor)[ptr + i * step]);
                 break;
             case FLOAT:
-                (void)printf("%f", ((float*)tensor)[ptr + i]);
+                (void)printf("%f", ((float*)tensor)[ptr + i * step]);
                 break;
             case DOUBLE:
-                (void)printf("%f", ((double*)tensor)[ptr + i]);
+                (void)printf("%f", ((double*)tensor)[ptr + i * step]);
                 break;
             }
             
@@ -470,7 +894,8 @@ void printTensor(const void* tensor, const Tensor* base, const int dim,
  * <p><b>The result:</b><br>
  * The resulting output will be an integer array that can be access at
  * any index `i` and provides the number of data to skip, until the next
- * dimension would start.
+ * dimension would start. These are the strides of the tensor, so views
+ * are supported as well.
  * </p>
  * 
  * @param *tensor   The tensor from which to get the jump table from.
@@ -490,11 +915,7 @@ int *generateDimensionBasedCummulativeJumpTable(const Tensor* tensor) {
         return NULL;
     }
 
-    for (int i = tensor->dimensions - 1; i >= 0; i--) {
-        jumpTable[i] = i == (tensor->dimensions - 1) ?
-                            1 : jumpTable[i + 1] * tensor->shape[i + 1];
-    }
-
+    (void)memcpy(jumpTable, tensor->strides, tensor->dimensions * sizeof(int));
     return jumpTable;
 }
 
@@ -570,4 +991,47 @@ Tensor* getTensorBaseByType(const void* tensor, const TensorType type) {
     }
 
     return NULL;
+}
+
+/**
+ * Gets the data pointer of a given tensor.
+ * 
+ * @param *tensor   The generic tensor from which to get the data.
+ * @param type      Type of the tensor.
+ * 
+ * @return Pointer to the first element of the tensor.
+ */
+void* getTensorDataByType(const void* tensor, const TensorType type) {
+    switch (type) {
+    case _TENSOR_TYPE_INTEGER_:
+        return ((IntegerTensor*)tensor)->data;
+    case _TENSOR_TYPE_FLOAT_:
+        return ((FloatTensor*)tensor)->data;
+    case _TENSOR_TYPE_DOUBLE_:
+        return ((DoubleTensor*)tensor)->data;
+    default:
+        (void)throwIllegalArgumentException("Tensor type invalid!");
+    }
+
+    return NULL;
+}
+
+/**
+ * Frees a given tensor of the given type.
+ * 
+ * @param *tensor   The generic tensor to free.
+ * @param type      Type of the tensor.
+ */
+void freeTensorByType(void* tensor, const TensorType type) {
+    switch (type) {
+    case _TENSOR_TYPE_INTEGER_:
+        (void)freeIntegerTensor((IntegerTensor*)tensor);
+        break;
+    case _TENSOR_TYPE_FLOAT_:
+        (void)freeFloatTensor((FloatTensor*)tensor);
+        break;
+    case _TENSOR_TYPE_DOUBLE_:
+        (void)freeDoubleTensor((DoubleTensor*)tensor);
+        break;
+    }
 }
\ No newline at end of file
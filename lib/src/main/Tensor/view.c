@@ -0,0 +1,582 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "Tensor/tensor.h"
+#include "Tensor/view.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Gets the size of a single element of the given tensor type.
+ * 
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The size of an element in bytes.
+ */
+static size_t getElementSize(const TensorType tensorType) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        return sizeof(int);
+    case _TENSOR_TYPE_FLOAT_:
+        return sizeof(float);
+    case _TENSOR_TYPE_DOUBLE_:
+        return sizeof(double);
+    default:
+        return 0;
+    }
+}
+
+/**
+ * Gets the data pointer of the given tensor.
+ * 
+ * @param *tensor       The tensor.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return Pointer to the first element of the tensor.
+ */
+static char* getTensorData(const void* tensor, const TensorType tensorType) {
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_:
+        return (char*)((IntegerTensor*)tensor)->data;
+    case _TENSOR_TYPE_FLOAT_:
+        return (char*)((FloatTensor*)tensor)->data;
+    case _TENSOR_TYPE_DOUBLE_:
+        return (char*)((DoubleTensor*)tensor)->data;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * Creates a view on the data of the given tensor. The view does not own
+ * the data, so no element is copied and changes to the elements are
+ * visible in both tensors.
+ * 
+ * <p><b>Note:</b><br>
+ * The view must be freed with the free function of its type, which does
+ * not free the shared data. The tensor the view was created from must
+ * outlive the view.
+ * </p>
+ * 
+ * @param *tensor       Tensor from which to create the view.
+ * @param dimensions    Number of dimensions of the view.
+ * @param *shape        Shape of the view.
+ * @param *strides      Strides of each dimension of the view in elements.
+ * @param offset        Offset of the first element of the view in the data of the tensor.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The created view.
+ * 
+ * @throws NullPointerException - When the tensor is `NULL`.
+ * @throws IllegalArgumentException - When the tensor type does not exist.
+ */
+void* createTensorView(const void* tensor, const int dimensions, const int* shape,
+    const int* strides, const size_t offset, const TensorType tensorType) {
+    if (tensor == NULL) {
+        (void)throwNullPointerException("Can't create a view of a tensor, that is NULL.");
+        return NULL;
+    } else if (getElementSize(tensorType) == 0) {
+        (void)throwIllegalArgumentException("The tensor type does not exist!");
+        return NULL;
+    }
+
+    const Tensor* parent = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    Tensor* base = (Tensor*)createTensorBase(dimensions, shape);
+
+    if (base == NULL) {
+        return NULL;
+    }
+
+    (void)memcpy(base->strides, strides, dimensions * sizeof(int));
+    base->offset = parent->offset + offset;
+    base->ownsData = false;
+
+    char* data = getTensorData(tensor, tensorType) + offset * getElementSize(tensorType);
+    void* view = NULL;
+
+    switch (tensorType) {
+    case _TENSOR_TYPE_INTEGER_: {
+        IntegerTensor* integerView = (IntegerTensor*)calloc(1, sizeof(IntegerTensor));
+        if (integerView != NULL) integerView->data = (int*)data;
+        view = integerView;
+        break;
+    }
+    case _TENSOR_TYPE_FLOAT_: {
+        FloatTensor* floatView = (FloatTensor*)calloc(1, sizeof(FloatTensor));
+        if (floatView != NULL) floatView->data = (float*)data;
+        view = floatView;
+        break;
+    }
+    case _TENSOR_TYPE_DOUBLE_: {
+        DoubleTensor* doubleView = (DoubleTensor*)calloc(1, sizeof(DoubleTensor));
+        if (doubleView != NULL) doubleView->data = (double*)data;
+        view = doubleView;
+        break;
+    }
+    }
+
+    if (view == NULL) {
+        (void)freeTensor(base);
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a view.");
+        return NULL;
+    }
+
+    // All typed tensors start with the base.
+    *(Tensor**)view = base;
+    return view;
+}
+
+/**
+ * Allocates a copy of the shape and the strides of the given tensor base.
+ * The strides start at index `dimensions` of the returned array.
+ * 
+ * @param *base     Tensor base to copy.
+ * 
+ * @return The copied shape and strides.
+ */
+static int* copyShapeAndStrides(const Tensor* base) {
+    int* shape = (int*)malloc(2 * base->dimensions * sizeof(int));
+
+    if (shape == NULL) {
+        (void)throwMemoryAllocationException("An error occured while trying to allocate memory for a view.");
+        return NULL;
+    }
+
+    (void)memcpy(shape, base->shape, base->dimensions * sizeof(int));
+    (void)memcpy(shape + base->dimensions, base->strides, base->dimensions * sizeof(int));
+    return shape;
+}
+
+/**
+ * Checks whether the given dimension exists in the tensor.
+ * 
+ * @param *base     Tensor base to check.
+ * @param dim       The dimension.
+ * 
+ * @return `true` when the dimension exists, `false` if not.
+ * 
+ * @throws IllegalArgumentException - When the dimension does not exist.
+ */
+static int checkViewDimension(const Tensor* base, const int dim) {
+    if (dim < 0 || dim >= base->dimensions) {
+        (void)throwIllegalArgumentException("The dimension of the view is out of range.");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Creates a view of every `step`-th index in the range [start; end) of a
+ * dimension.
+ * 
+ * @param *tensor       Tensor from which to create the view.
+ * @param dim           Dimension to slice.
+ * @param start         First index of the slice.
+ * @param end           End of the slice (exclusive).
+ * @param step          Step between two indices of the slice.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The sliced view.
+ * 
+ * @throws IllegalArgumentException - When the dimension or range is out of bounds.
+ * @throws IllegalArgumentException - When the step is not a positive integer.
+ */
+void* slice(const void* tensor, const int dim, const int start,
+    const int end, const int step, const TensorType tensorType) {
+    if (tensor == NULL) {
+        (void)throwNullPointerException("Can't create a view of a tensor, that is NULL.");
+        return NULL;
+    }
+
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+
+    if (checkViewDimension(base, dim) == false) {
+        return NULL;
+    } else if (step <= 0) {
+        (void)throwIllegalArgumentException("The step of a slice must be a positive integer.");
+        return NULL;
+    } else if (start < 0 || end > base->shape[dim] || start >= end) {
+        (void)throwIllegalArgumentException("The range of the slice is out of bounds.");
+        return NULL;
+    }
+
+    int* shape = copyShapeAndStrides(base);
+
+    if (shape == NULL) {
+        return NULL;
+    }
+
+    int* strides = shape + base->dimensions;
+    shape[dim] = (end - start + step - 1) / step;
+    strides[dim] *= step;
+
+    void* view = createTensorView(tensor, base->dimensions, shape, strides,
+                    (size_t)start * base->strides[dim], tensorType);
+    (void)free(shape);
+    return view;
+}
+
+/**
+ * Creates a view of a single index of a dimension. The dimension is
+ * removed from the view.
+ * 
+ * @param *tensor       Tensor from which to create the view.
+ * @param dim           Dimension to select from.
+ * @param index         The index to select.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The view with one dimension less.
+ * 
+ * @throws IllegalArgumentException - When the dimension or index is out of bounds.
+ * @throws IllegalArgumentException - When the tensor has only one dimension.
+ */
+void* selectIndex(const void* tensor, const int dim, const int index, const TensorType tensorType) {
+    if (tensor == NULL) {
+        (void)throwNullPointerException("Can't create a view of a tensor, that is NULL.");
+        return NULL;
+    }
+
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+
+    if (checkViewDimension(base, dim) == false) {
+        return NULL;
+    } else if (base->dimensions <= 1) {
+        (void)throwIllegalArgumentException("Can't select from a one dimensional tensor, use narrow instead.");
+        return NULL;
+    } else if (index < 0 || index >= base->shape[dim]) {
+        (void)throwIllegalArgumentException("The index of the selection is out of bounds.");
+        return NULL;
+    }
+
+    int* shape = copyShapeAndStrides(base);
+
+    if (shape == NULL) {
+        return NULL;
+    }
+
+    int* strides = shape + base->dimensions;
+    const int dimensions = base->dimensions - 1;
+
+    for (int i = dim; i < dimensions; i++) {
+        shape[i] = shape[i + 1];
+        strides[i] = strides[i + 1];
+    }
+
+    // Move the strides next to the shrunk shape.
+    (void)memmove(shape + dimensions, strides, dimensions * sizeof(int));
+
+    void* view = createTensorView(tensor, dimensions, shape, shape + dimensions,
+                    (size_t)index * base->strides[dim], tensorType);
+    (void)free(shape);
+    return view;
+}
+
+/**
+ * Creates a view with two swapped dimensions.
+ * 
+ * @param *tensor       Tensor from which to create the view.
+ * @param dim0          First dimension to swap.
+ * @param dim1          Second dimension to swap.
+ * @param tensorType    Type of the tensor.
+ * 
+ * @return The transposed view.
+ * 
+ * @throws IllegalArgumentException - When a dimension is out of bounds.
+ */
+void* transpose(const void* tensor, const int dim0, const int dim1, const TensorType tensorType) {
+    if (tensor == NULL) {
+        (void)throwNullPointerException("Can't create a view of a tensor, that is NULL.");
+        return NULL;
+    }
+
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+
+    if (checkViewDimension(base, dim0) == false || checkViewDimension(base, dim1) == false) {
+        return NULL;
+    }
+
+    int* shape = copyShapeAndStrides(base);
+
+    if (shape == NULL) {
+        return NULL;
+    }
+
+    int* strides = shape + base->dimensions;
+    shape[dim0] = base->shape[dim1];
+    shape[dim1] = base->shape[dim0];
+    strides[dim0] = base->strides[dim1];
+    strides[dim1] = base->strides[dim0];
+
+    void* view = createTensorView(tensor, base->dimensions, shape, strides, 0, tensorType);
+    (void)free(shape);
+    return view;
+}
+
+/**
+ * Copies the elements of the given tensor into the dense destination.
+ * 
+ * @param *tensor       Tensor to copy.
+ * @param *destination  Dense tensor with the same shape.
+ * @param tensorType    Type of the tensors.
+ */
+static void copyToContiguous(const void* tensor, const void* destination, const TensorType tensorType) {
+    const Tensor* base = (Tensor*)getTensorBaseByType(tensor, tensorType);
+    const size_t elementSize = getElementSize(tensorType);
+    const size_t runLength = Tensor_getContiguousLength(base);
+    const char* data = getTensorData(tensor, tensorType);
+    char* dest = getTensorData(destination, tensorType);
+
+    for (size_t index = 0; index < base->dataPoints; index += runLength) {
+        const size_t offset = Tensor_getElementOffset(base, index);
+        (void)memcpy(dest + index * elementSize, data + offset * elementSize, runLength * elementSize);
+    }
+}
+
+/**
+ * Creates a view of every `step`-th index in the range [start; end) of a
+ * dimension.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to slice.
+ * @param start     First index of the slice.
+ * @param end       End of the slice (exclusive).
+ * @param step      Step between two indices of the slice.
+ * 
+ * @return The sliced view, that shares the data with the tensor.
+ */
+IntegerTensor* IntegerTensor_slice(const IntegerTensor* tensor, const int dim, const int start, const int end, const int step) {
+    return (IntegerTensor*)slice(tensor, dim, start, end, step, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a view of `length` indices of a dimension, starting at `start`.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to narrow.
+ * @param start     First index of the view.
+ * @param length    Number of indices in the view.
+ * 
+ * @return The narrowed view, that shares the data with the tensor.
+ */
+IntegerTensor* IntegerTensor_narrow(const IntegerTensor* tensor, const int dim, const int start, const int length) {
+    return (IntegerTensor*)slice(tensor, dim, start, start + length, 1, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a view of a single index of a dimension, e.g. one frame of a batch.
+ * The dimension is removed from the view.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to select from.
+ * @param index     The index to select.
+ * 
+ * @return The view with one dimension less, that shares the data with the tensor.
+ */
+IntegerTensor* IntegerTensor_select(const IntegerTensor* tensor, const int dim, const int index) {
+    return (IntegerTensor*)selectIndex(tensor, dim, index, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a view with two swapped dimensions.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim0      First dimension to swap.
+ * @param dim1      Second dimension to swap.
+ * 
+ * @return The transposed view, that shares the data with the tensor.
+ */
+IntegerTensor* IntegerTensor_transpose(const IntegerTensor* tensor, const int dim0, const int dim1) {
+    return (IntegerTensor*)transpose(tensor, dim0, dim1, _TENSOR_TYPE_INTEGER_);
+}
+
+/**
+ * Creates a dense copy of the given tensor, e.g. to pass a view to an
+ * operation that requires contiguous data.
+ * 
+ * @param *tensor   Tensor or view to copy.
+ * 
+ * @return A new tensor that owns its data.
+ */
+IntegerTensor* IntegerTensor_contiguous(const IntegerTensor* tensor) {
+    IntegerTensor* copy = IntegerTensor_zeros(tensor->base->dimensions, tensor->base->shape);
+
+    if (copy != NULL) {
+        (void)copyToContiguous(tensor, copy, _TENSOR_TYPE_INTEGER_);
+    }
+
+    return copy;
+}
+
+
+/**
+ * Creates a view of every `step`-th index in the range [start; end) of a
+ * dimension.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to slice.
+ * @param start     First index of the slice.
+ * @param end       End of the slice (exclusive).
+ * @param step      Step between two indices of the slice.
+ * 
+ * @return The sliced view, that shares the data with the tensor.
+ */
+FloatTensor* FloatTensor_slice(const FloatTensor* tensor, const int dim, const int start, const int end, const int step) {
+    return (FloatTensor*)slice(tensor, dim, start, end, step, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a view of `length` indices of a dimension, starting at `start`.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to narrow.
+ * @param start     First index of the view.
+ * @param length    Number of indices in the view.
+ * 
+ * @return The narrowed view, that shares the data with the tensor.
+ */
+FloatTensor* FloatTensor_narrow(const FloatTensor* tensor, const int dim, const int start, const int length) {
+    return (FloatTensor*)slice(tensor, dim, start, start + length, 1, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a view of a single index of a dimension, e.g. one frame of a batch.
+ * The dimension is removed from the view.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to select from.
+ * @param index     The index to select.
+ * 
+ * @return The view with one dimension less, that shares the data with the tensor.
+ */
+FloatTensor* FloatTensor_select(const FloatTensor* tensor, const int dim, const int index) {
+    return (FloatTensor*)selectIndex(tensor, dim, index, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a view with two swapped dimensions.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim0      First dimension to swap.
+ * @param dim1      Second dimension to swap.
+ * 
+ * @return The transposed view, that shares the data with the tensor.
+ */
+FloatTensor* FloatTensor_transpose(const FloatTensor* tensor, const int dim0, const int dim1) {
+    return (FloatTensor*)transpose(tensor, dim0, dim1, _TENSOR_TYPE_FLOAT_);
+}
+
+/**
+ * Creates a dense copy of the given tensor, e.g. to pass a view to an
+ * operation that requires contiguous data.
+ * 
+ * @param *tensor   Tensor or view to copy.
+ * 
+ * @return A new tensor that owns its data.
+ */
+FloatTensor* FloatTensor_contiguous(const FloatTensor* tensor) {
+    FloatTensor* copy = FloatTensor_zeros(tensor->base->dimensions, tensor->base->shape);
+
+    if (copy != NULL) {
+        (void)copyToContiguous(tensor, copy, _TENSOR_TYPE_FLOAT_);
+    }
+
+    return copy;
+}
+
+/**
+ * Creates a view of every `step`-th index in the range [start; end) of a
+ * dimension.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to slice.
+ * @param start     First index of the slice.
+ * @param end       End of the slice (exclusive).
+ * @param step      Step between two indices of the slice.
+ * 
+ * @return The sliced view, that shares the data with the tensor.
+ */
+DoubleTensor* DoubleTensor_slice(const DoubleTensor* tensor, const int dim, const int start, const int end, const int step) {
+    return (DoubleTensor*)slice(tensor, dim, start, end, step, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a view of `length` indices of a dimension, starting at `start`.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to narrow.
+ * @param start     First index of the view.
+ * @param length    Number of indices in the view.
+ * 
+ * @return The narrowed view, that shares the data with the tensor.
+ */
+DoubleTensor* DoubleTensor_narrow(const DoubleTensor* tensor, const int dim, const int start, const int length) {
+    return (DoubleTensor*)slice(tensor, dim, start, start + length, 1, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a view of a single index of a dimension, e.g. one frame of a batch.
+ * The dimension is removed from the view.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim       Dimension to select from.
+ * @param index     The index to select.
+ * 
+ * @return The view with one dimension less, that shares the data with the tensor.
+ */
+DoubleTensor* DoubleTensor_select(const DoubleTensor* tensor, const int dim, const int index) {
+    return (DoubleTensor*)selectIndex(tensor, dim, index, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a view with two swapped dimensions.
+ * 
+ * @param *tensor   Tensor from which to create the view.
+ * @param dim0      First dimension to swap.
+ * @param dim1      Second dimension to swap.
+ * 
+ * @return The transposed view, that shares the data with the tensor.
+ */
+DoubleTensor* DoubleTensor_transpose(const DoubleTensor* tensor, const int dim0, const int dim1) {
+    return (DoubleTensor*)transpose(tensor, dim0, dim1, _TENSOR_TYPE_DOUBLE_);
+}
+
+/**
+ * Creates a dense copy of the given tensor, e.g. to pass a view to an
+ * operation that requires contiguous data.
+ * 
+ * @param *tensor   Tensor or view to copy.
+ * 
+ * @return A new tensor that owns its data.
+ */
+DoubleTensor* DoubleTensor_contiguous(const DoubleTensor* tensor) {
+    DoubleTensor* copy = DoubleTensor_zeros(tensor->base->dimensions, tensor->base->shape);
+
+    if (copy != NULL) {
+        (void)copyToContiguous(tensor, copy, _TENSOR_TYPE_DOUBLE_);
+    }
+
+    return copy;
+}
\ No newline at end of file
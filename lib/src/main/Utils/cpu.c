@@ -0,0 +1,228 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Utils/cpu.h"
+
+#define true 1
+#define false 0
+
+/**
+ * Cache sizes, that are assumed when sysfs does not report them.
+ */
+#define CPU_DEFAULT_L1D_CACHE (32 * 1024)
+#define CPU_DEFAULT_L2_CACHE (256 * 1024)
+#define CPU_DEFAULT_L3_CACHE (8 * 1024 * 1024)
+
+/**
+ * Number of cache descriptions of the first CPU, that are read from sysfs.
+ */
+#define CPU_CACHE_INDICES 8
+
+static CpuFeatures CPU_FEATURES;
+static int CPU_FEATURES_DETECTED = false;
+
+static CacheSizes CACHE_SIZES;
+static CacheSizes CACHE_SIZE_OVERRIDES;
+static int CACHE_SIZES_DETECTED = false;
+
+/**
+ * Queries the features of the executing CPU. The detection runs over
+ * `cpuid` (including the OS support check of the extended registers)
+ * once and is cached afterwards.
+ * 
+ * <p><b>Note:</b><br>
+ * On non x86 platforms all features are reported as unavailable,
+ * which results in the scalar kernels beeing used.
+ * </p>
+ * 
+ * @return Pointer to the detected CPU features.
+ */
+const CpuFeatures* getCpuFeatures() {
+    if (CPU_FEATURES_DETECTED == true) {
+        return &CPU_FEATURES;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    (void)__builtin_cpu_init();
+    CPU_FEATURES.sse2 = __builtin_cpu_supports("sse2") ? true : false;
+    CPU_FEATURES.avx2 = __builtin_cpu_supports("avx2") ? true : false;
+    CPU_FEATURES.avx512f = __builtin_cpu_supports("avx512f") ? true : false;
+    CPU_FEATURES.avx512bw = __builtin_cpu_supports("avx512bw") ? true : false;
+    CPU_FEATURES.avx512vnni = __builtin_cpu_supports("avx512vnni") ? true : false;
+#endif
+
+    CPU_FEATURES_DETECTED = true;
+    return &CPU_FEATURES;
+}
+
+/**
+ * Determines the highest SIMD level the executing CPU supports.
+ * 
+ * @return The best available SimdLevel.
+ */
+SimdLevel detectSimdLevel() {
+    const CpuFeatures* features = getCpuFeatures();
+
+    if (features->avx512f == true) {
+        return SIMD_LEVEL_AVX512;
+    } else if (features->avx2 == true) {
+        return SIMD_LEVEL_AVX2;
+    } else if (features->sse2 == true) {
+        return SIMD_LEVEL_SSE2;
+    }
+
+    return SIMD_LEVEL_SCALAR;
+}
+
+/**
+ * Returns the display name of the given SimdLevel.
+ * 
+ * @param level     The level to get the name of.
+ * 
+ * @return The display name of the level.
+ */
+const char* getSimdLevelName(const SimdLevel level) {
+    switch (level) {
+    case SIMD_LEVEL_SSE2:
+        return "SSE2";
+    case SIMD_LEVEL_AVX2:
+        return "AVX2";
+    case SIMD_LEVEL_AVX512:
+        return "AVX-512";
+    default:
+        return "Scalar";
+    }
+}
+
+/**
+ * Reads a single line of a sysfs file of a cache description.
+ * 
+ * @param index     Index of the cache description.
+ * @param *name     Name of the file.
+ * @param *buffer   Buffer to read the line into.
+ * @param size      Size of the buffer.
+ * 
+ * @return `false` when the file could not be read.
+ */
+static int readCacheAttribute(const int index, const char* name, char* buffer, const int size) {
+    char path[128];
+    (void)snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/%s", index, name);
+    FILE* file = fopen(path, "r");
+
+    if (file == NULL) {
+        return false;
+    }
+
+    const int success = fgets(buffer, size, file) != NULL;
+    (void)fclose(file);
+    return success ? true : false;
+}
+
+/**
+ * Detects the data cache sizes of the first CPU over sysfs. Caches, that
+ * are not reported, keep their default size.
+ * 
+ * @param *sizes    The sizes to write the detected caches to.
+ */
+static void detectCacheSizes(CacheSizes* sizes) {
+    sizes->l1d = CPU_DEFAULT_L1D_CACHE;
+    sizes->l2 = CPU_DEFAULT_L2_CACHE;
+    sizes->l3 = CPU_DEFAULT_L3_CACHE;
+
+    for (int index = 0; index < CPU_CACHE_INDICES; index++) {
+        char level[16];
+        char type[32];
+        char size[32];
+
+        if (readCacheAttribute(index, "level", level, sizeof(level)) == false
+            || readCacheAttribute(index, "type", type, sizeof(type)) == false
+            || readCacheAttribute(index, "size", size, sizeof(size)) == false
+            || type[0] == 'I') {
+            continue;
+        }
+
+        char* unit = NULL;
+        size_t bytes = (size_t)strtoul(size, &unit, 10);
+
+        if (*unit == 'K') {
+            bytes *= 1024;
+        } else if (*unit == 'M') {
+            bytes *= 1024 * 1024;
+        }
+
+        if (bytes == 0) {
+            continue;
+        } else if (atoi(level) == 1) {
+            sizes->l1d = bytes;
+        } else if (atoi(level) == 2) {
+            sizes->l2 = bytes;
+        } else if (atoi(level) == 3) {
+            sizes->l3 = bytes;
+        }
+    }
+}
+
+/**
+ * Returns the data cache sizes of a core, that the kernels size their
+ * tiles by. The sizes are read from sysfs once and are cached afterwards.
+ * 
+ * <p><b>Note:</b><br>
+ * Sizes configured with configureCacheSizes take precedence over the
+ * detected ones.
+ * </p>
+ * 
+ * @return Pointer to the cache sizes.
+ */
+const CacheSizes* getCacheSizes() {
+    if (CACHE_SIZES_DETECTED == true) {
+        return &CACHE_SIZES;
+    }
+
+    (void)detectCacheSizes(&CACHE_SIZES);
+
+    if (CACHE_SIZE_OVERRIDES.l1d > 0) CACHE_SIZES.l1d = CACHE_SIZE_OVERRIDES.l1d;
+    if (CACHE_SIZE_OVERRIDES.l2 > 0) CACHE_SIZES.l2 = CACHE_SIZE_OVERRIDES.l2;
+    if (CACHE_SIZE_OVERRIDES.l3 > 0) CACHE_SIZES.l3 = CACHE_SIZE_OVERRIDES.l3;
+
+    CACHE_SIZES_DETECTED = true;
+    return &CACHE_SIZES;
+}
+
+/**
+ * Overrides the cache sizes, that the kernels size their tiles by.
+ * 
+ * <p><b>Important:</b><br>
+ * This must not be called while tensor operations are running.
+ * </p>
+ * 
+ * @param l1d   Size of the L1 data cache in bytes, `0` for the detected size.
+ * @param l2    Size of the L2 cache in bytes, `0` for the detected size.
+ * @param l3    Size of the L3 cache in bytes, `0` for the detected size.
+ */
+void configureCacheSizes(const size_t l1d, const size_t l2, const size_t l3) {
+    CACHE_SIZE_OVERRIDES.l1d = l1d;
+    CACHE_SIZE_OVERRIDES.l2 = l2;
+    CACHE_SIZE_OVERRIDES.l3 = l3;
+    CACHE_SIZES_DETECTED = false;
+}
\ No newline at end of file
@@ -0,0 +1,306 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "Utils/fft.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+#define FFT_PI 3.14159265358979323846
+
+struct FftPlan {
+    size_t length;
+
+    /**
+     * Interleaved complex twiddle factors exp(-2 * pi * i * k / length)
+     * for k in [0; length / 2).
+     */
+    double* twiddles;
+
+    /**
+     * Bit reversal permutation of the full and the half length.
+     */
+    size_t* reversed;
+    size_t* reversedHalf;
+};
+
+/**
+ * Calculates the bit reversal permutation for a power of two length.
+ * 
+ * @param length    Length of the permutation.
+ * 
+ * @return The permutation oddR `NULL` on an allocation failure.
+ */
+static size_t* createBitReversal(const size_t length) {
+    size_t* reversed = (size_t*)malloc((length > 0 ? length : 1) * sizeof(size_t));
+
+    if (reversed == NULL) {
+        return NULL;
+    }
+
+    int bits = 0;
+
+    while (((size_t)1 << bits) < length) {
+        bits++;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        size_t r = 0;
+
+        for (int b = 0; b < bits; b++) {
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+
+        reversed[i] = r;
+    }
+
+    return reversed;
+}
+
+/**
+ * Creates the plan of an FFT with the given length.
+ * 
+ * @param length    Number of points, must be a power of two.
+ * 
+ * @return The plan oddR `NULL` on failure.
+ * 
+ * @throw IllegalArgumentException - When the length is not a power of two.
+ * @throw MemoryAllocationException - When the tables could not be allocated.
+ */
+FftPlan* createFftPlan(const size_t length) {
+    if (length == 0 || (length & (length - 1)) != 0) {
+        (void)throwIllegalArgumentException("The FFT length must be a power of two.");
+        return NULL;
+    }
+
+    FftPlan* plan = (FftPlan*)calloc(1, sizeof(FftPlan));
+
+    if (plan == NULL) {
+        (void)throwMemoryAllocationException("Error on allocating memory for the FFT plan.");
+        return NULL;
+    }
+
+    plan->length = length;
+    plan->twiddles = (double*)malloc((length / 2 + 1) * 2 * sizeof(double));
+    plan->reversed = createBitReversal(length);
+    plan->reversedHalf = createBitReversal(length / 2);
+
+    if (plan->twiddles == NULL || plan->reversed == NULL || plan->reversedHalf == NULL) {
+        (void)FftPlan_free(plan);
+        (void)throwMemoryAllocationException("Error on allocating memory for the FFT tables.");
+        return NULL;
+    }
+
+    for (size_t k = 0; k < length / 2; k++) {
+        const double angle = -2.0 * FFT_PI * (double)k / (double)length;
+        plan->twiddles[2 * k] = cos(angle);
+        plan->twiddles[2 * k + 1] = sin(angle);
+    }
+
+    return plan;
+}
+
+/**
+ * Gets the number of points of the FFT plan.
+ * 
+ * @param *plan     The plan.
+ * 
+ * @return The length of the plan.
+ */
+size_t FftPlan_getLength(const FftPlan* plan) {
+    return plan->length;
+}
+
+/**
+ * Frees the given FFT plan.
+ * 
+ * @param *plan     The plan to free.
+ */
+void FftPlan_free(FftPlan* plan) {
+    if (plan == NULL) {
+        return;
+    }
+
+    if (plan->twiddles != NULL) (void)free(plan->twiddles);
+    if (plan->reversed != NULL) (void)free(plan->reversed);
+    if (plan->reversedHalf != NULL) (void)free(plan->reversedHalf);
+    (void)free(plan);
+}
+
+/**
+ * Executes an iterative radix-2 FFT of `length` points in place. The
+ * twiddle factors of the plan are used with the distance `plan->length / length`,
+ * so the same plan serves the half length transform of a real FFT.
+ * 
+ * @param *plan         The plan with the twiddle factors.
+ * @param *reversed     Bit reversal permutation of `length`.
+ * @param length        Number of points to transform.
+ * @param *data         Interleaved complex values.
+ * @param inverse       `true` for the (unscaled) inverse transform.
+ */
+static void transform(const FftPlan* plan, const size_t* reversed,
+    const size_t length, double* data, const int inverse) {
+    for (size_t i = 0; i < length; i++) {
+        const size_t j = reversed[i];
+
+        if (i < j) {
+            const double re = data[2 * i];
+            const double im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+
+    const double sign = inverse ? -1.0 : 1.0;
+
+    for (size_t size = 2; size <= length; size <<= 1) {
+        const size_t half = size / 2;
+        const size_t step = plan->length / size;
+
+        for (size_t start = 0; start < length; start += size) {
+            double* a = data + 2 * start;
+            double* b = a + 2 * half;
+
+            for (size_t k = 0; k < half; k++) {
+                const double wr = plan->twiddles[2 * k * step];
+                const double wi = sign * plan->twiddles[2 * k * step + 1];
+                const double vr = b[2 * k] * wr - b[2 * k + 1] * wi;
+                const double vi = b[2 * k] * wi + b[2 * k + 1] * wr;
+                b[2 * k] = a[2 * k] - vr;
+                b[2 * k + 1] = a[2 * k + 1] - vi;
+                a[2 * k] += vr;
+                a[2 * k + 1] += vi;
+            }
+        }
+    }
+}
+
+/**
+ * Executes a complex FFT with the length of the plan in place.
+ * 
+ * <p><b>Note:</b><br>
+ * The inverse transform is not scaled, applying both transforms multiplies
+ * the values by the length.
+ * </p>
+ * 
+ * @param *plan     The plan.
+ * @param *data     `length` interleaved complex values (real, imaginary).
+ * @param inverse   `true` for the inverse transform, else `false`.
+ */
+void Fft_complex(const FftPlan* plan, double* data, const int inverse) {
+    (void)transform(plan, plan->reversed, plan->length, data, inverse);
+}
+
+/**
+ * Executes the FFT of `length` real values and writes the `length / 2 + 1`
+ * non-redundant complex values of the spectrum.
+ * 
+ * <p><b>Functionality:</b><br>
+ * The even and odd values are packed into one complex signal of half the
+ * length, transformed and separated again with the symmetry of real signals.
+ * </p>
+ * 
+ * @param *plan     The plan, its length must be at least 2.
+ * @param *input    `length` real values.
+ * @param *output   `length / 2 + 1` interleaved complex values.
+ */
+void Fft_realForward(const FftPlan* plan, const double* input, double* output) {
+    const size_t half = plan->length / 2;
+
+    for (size_t i = 0; i < 2 * half; i++) {
+        output[i] = input[i];
+    }
+
+    (void)transform(plan, plan->reversedHalf, half, output, false);
+
+    const double r0 = output[0];
+    const double i0 = output[1];
+    output[0] = r0 + i0;
+    output[1] = 0.0;
+    output[2 * half] = r0 - i0;
+    output[2 * half + 1] = 0.0;
+
+    for (size_t k = 1; k <= half / 2; k++) {
+        const size_t m = half - k;
+        const double zr = output[2 * k];
+        const double zi = output[2 * k + 1];
+        const double cr = output[2 * m];
+        const double ci = -output[2 * m + 1];
+        const double er = 0.5 * (zr + cr);
+        const double ei = 0.5 * (zi + ci);
+        const double oddR = 0.5 * (zi - ci);
+        const double oddI = -0.5 * (zr - cr);
+        const double wr = plan->twiddles[2 * k];
+        const double wi = plan->twiddles[2 * k + 1];
+        const double tr = wr * oddR - wi * oddI;
+        const double ti = wr * oddI + wi * oddR;
+
+        output[2 * k] = er + tr;
+        output[2 * k + 1] = ei + ti;
+        // The bin `half - k` is built from the same pair with conjugated roles.
+        output[2 * m] = er - tr;
+        output[2 * m + 1] = -(ei - ti);
+    }
+}
+
+/**
+ * Executes the inverse FFT of a real signal from the `length / 2 + 1`
+ * non-redundant complex values of its spectrum.
+ * 
+ * <p><b>Note:</b><br>
+ * The result is not scaled, it is `length` times the original signal.
+ * The input is left unchanged.
+ * </p>
+ * 
+ * @param *plan     The plan, its length must be at least 2.
+ * @param *input    `length / 2 + 1` interleaved complex values.
+ * @param *output   `length` real values.
+ */
+void Fft_realInverse(const FftPlan* plan, const double* input, double* output) {
+    const size_t half = plan->length / 2;
+
+    for (size_t k = 0; k < half; k++) {
+        const size_t m = half - k;
+        const double xr = input[2 * k];
+        const double xi = input[2 * k + 1];
+        const double cr = input[2 * m];
+        const double ci = -input[2 * m + 1];
+        const double er = xr + cr;
+        const double ei = xi + ci;
+        const double dr = xr - cr;
+        const double di = xi - ci;
+        const double wr = plan->twiddles[2 * k];
+        const double wi = -plan->twiddles[2 * k + 1];
+        const double oddR = dr * wr - di * wi;
+        const double oddI = dr * wi + di * wr;
+
+        output[2 * k] = er - oddI;
+        output[2 * k + 1] = ei + oddR;
+    }
+
+    (void)transform(plan, plan->reversedHalf, half, output, true);
+}
\ No newline at end of file
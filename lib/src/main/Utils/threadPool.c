@@ -0,0 +1,519 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "Utils/threadPool.h"
+#include "Error/exceptions.h"
+
+#define true 1
+#define false 0
+
+#define CACHE_LINE_SIZE 64
+
+/**
+ * Queue of chunk indices [begin; end) that belongs to one thread of the pool.
+ * The owner takes chunks from the front, while idle threads steal the
+ * back half. Each queue sits on its own cache line.
+ */
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) pthread_mutex_t lock;
+    size_t begin;
+    size_t end;
+} WorkQueue;
+
+typedef struct {
+    ThreadPool* pool;
+    int slot;
+    int cpu;
+} WorkerArgument;
+
+struct ThreadPool {
+    /**
+     * Number of threads executing a parallel loop, including the
+     * thread that calls `ThreadPool_parallelFor`.
+     */
+    int workerCount;
+    pthread_t* threads;
+    WorkerArgument* arguments;
+    WorkQueue* queues;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t workAvailable;
+    pthread_cond_t workDone;
+    pthread_mutex_t jobLock;
+    unsigned long generation;
+    int jobActive;
+    int activeWorkers;
+    int shutdown;
+
+    ParallelTask task;
+    void* context;
+    size_t start;
+    size_t end;
+    size_t grainSize;
+};
+
+/**
+ * Marks threads, that are currently executing a task of a pool. Parallel
+ * loops that are started from within a task are executed serially by the
+ * calling thread, since all other threads are busy anyway.
+ */
+static _Thread_local int INSIDE_PARALLEL_REGION = false;
+
+static ThreadPool* DEFAULT_POOL = NULL;
+static pthread_mutex_t DEFAULT_POOL_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Executes the given chunk of the current job.
+ * 
+ * @param *pool     Pool with the job.
+ * @param chunk     Index of the chunk to execute.
+ */
+static void executeChunk(const ThreadPool* pool, const size_t chunk) {
+    const size_t chunkStart = pool->start + chunk * pool->grainSize;
+    const size_t chunkEnd = pool->end - chunkStart > pool->grainSize ?
+                            chunkStart + pool->grainSize : pool->end;
+    (void)pool->task(chunkStart, chunkEnd, pool->context);
+}
+
+/**
+ * Steals the back half of the chunks of another queue and puts them into
+ * the queue of the given slot.
+ * 
+ * @param *pool     Pool to steal in.
+ * @param slot      The slot of the stealing thread.
+ * 
+ * @return `true` when chunks were stolen, `false` when all queues are empty.
+ */
+static int stealWork(ThreadPool* pool, const int slot) {
+    for (int i = 1; i < pool->workerCount; i++) {
+        WorkQueue* victim = &pool->queues[(slot + i) % pool->workerCount];
+        (void)pthread_mutex_lock(&victim->lock);
+
+        if (victim->begin < victim->end) {
+            const size_t remaining = victim->end - victim->begin;
+            const size_t stolenBegin = victim->end - (remaining + 1) / 2;
+            const size_t stolenEnd = victim->end;
+            victim->end = stolenBegin;
+            (void)pthread_mutex_unlock(&victim->lock);
+
+            WorkQueue* own = &pool->queues[slot];
+            (void)pthread_mutex_lock(&own->lock);
+            own->begin = stolenBegin;
+            own->end = stolenEnd;
+            (void)pthread_mutex_unlock(&own->lock);
+            return true;
+        }
+
+        (void)pthread_mutex_unlock(&victim->lock);
+    }
+
+    return false;
+}
+
+/**
+ * Executes chunks from the queue of the given slot until it is empty and
+ * steals from the other queues afterwards, until no work is left.
+ * 
+ * @param *pool     Pool with the job.
+ * @param slot      Slot of the executing thread.
+ */
+static void executeQueue(ThreadPool* pool, const int slot) {
+    WorkQueue* own = &pool->queues[slot];
+
+    while (true) {
+        (void)pthread_mutex_lock(&own->lock);
+
+        if (own->begin < own->end) {
+            const size_t chunk = own->begin++;
+            (void)pthread_mutex_unlock(&own->lock);
+            (void)executeChunk(pool, chunk);
+            continue;
+        }
+
+        (void)pthread_mutex_unlock(&own->lock);
+
+        if (stealWork(pool, slot) == false) {
+            return;
+        }
+    }
+}
+
+/**
+ * Pins the calling thread to the given CPU.
+ * 
+ * @param cpu   Index of the CPU.
+ */
+static void pinThread(const int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+}
+
+/**
+ * Main loop of a worker thread. It sleeps until a new job is published,
+ * participates in it and reports back once no work is left.
+ * 
+ * @param *argument     The WorkerArgument of the thread.
+ */
+static void* workerMain(void* argument) {
+    const WorkerArgument* worker = (WorkerArgument*)argument;
+    ThreadPool* pool = worker->pool;
+    INSIDE_PARALLEL_REGION = true;
+
+    if (worker->cpu >= 0) {
+        (void)pinThread(worker->cpu);
+    }
+
+    (void)pthread_mutex_lock(&pool->mutex);
+    unsigned long seenGeneration = pool->generation;
+
+    while (true) {
+        while (pool->shutdown == false && pool->generation == seenGeneration) {
+            (void)pthread_cond_wait(&pool->workAvailable, &pool->mutex);
+        }
+
+        if (pool->shutdown == true) {
+            break;
+        }
+
+        seenGeneration = pool->generation;
+
+        if (pool->jobActive == false) {
+            continue;
+        }
+
+        pool->activeWorkers++;
+        (void)pthread_mutex_unlock(&pool->mutex);
+        (void)executeQueue(pool, worker->slot);
+        (void)pthread_mutex_lock(&pool->mutex);
+
+        if (--pool->activeWorkers == 0) {
+            (void)pthread_cond_signal(&pool->workDone);
+        }
+    }
+
+    (void)pthread_mutex_unlock(&pool->mutex);
+    return NULL;
+}
+
+/**
+ * Collects the CPUs the process is allowed to run on.
+ * 
+ * @param *cpus     Array to write the CPU indices to (size `CPU_SETSIZE`).
+ * 
+ * @return The number of allowed CPUs.
+ */
+static int getAllowedCpus(int* cpus) {
+    cpu_set_t set;
+    int count = 0;
+
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &set) != 0) {
+        return 0;
+    }
+
+    for (int i = 0; i < CPU_SETSIZE; i++) {
+        if (CPU_ISSET(i, &set)) {
+            cpus[count++] = i;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Creates a persistent work-stealing thread pool.
+ * 
+ * <p><b>Functionality:</b><br>
+ * A parallel loop is split into chunks of `grainSize` indices, which are
+ * distributed evenly over the queues of all threads. Every thread works on
+ * its own queue first and steals half of the remaining chunks of another
+ * thread once its queue runs empty. The thread calling
+ * `ThreadPool_parallelFor` participates as well, so only
+ * `workerCount - 1` threads are spawned.
+ * </p>
+ * 
+ * @param workerCount   Number of threads that execute a parallel loop.
+ * @param pinThreads    Whether each worker should be pinned to its own core.
+ * 
+ * @return The created ThreadPool.
+ * 
+ * @throws IllegalArgumentException - When the worker count is not a positive integer.
+ * @throws MemoryAllocationException - When the pool could not be allocated.
+ */
+ThreadPool* createThreadPool(const int workerCount, const int pinThreads) {
+    if (workerCount <= 0) {
+        (void)throwIllegalArgumentException("Worker count must be a positive integer.");
+        return NULL;
+    }
+
+    ThreadPool* pool = (ThreadPool*)calloc(1, sizeof(ThreadPool));
+    pthread_t* threads = (pthread_t*)calloc(workerCount, sizeof(pthread_t));
+    WorkerArgument* arguments = (WorkerArgument*)calloc(workerCount, sizeof(WorkerArgument));
+    WorkQueue* queues = (WorkQueue*)aligned_alloc(CACHE_LINE_SIZE, workerCount * sizeof(WorkQueue));
+
+    if (pool == NULL || threads == NULL || arguments == NULL || queues == NULL) {
+        if (pool != NULL) (void)free(pool);
+        if (threads != NULL) (void)free(threads);
+        if (arguments != NULL) (void)free(arguments);
+        if (queues != NULL) (void)free(queues);
+        (void)throwMemoryAllocationException("While trying to create a ThreadPool.");
+        return NULL;
+    }
+
+    for (int i = 0; i < workerCount; i++) {
+        (void)pthread_mutex_init(&queues[i].lock, NULL);
+        queues[i].begin = 0;
+        queues[i].end = 0;
+    }
+
+    (void)pthread_mutex_init(&pool->mutex, NULL);
+    (void)pthread_mutex_init(&pool->jobLock, NULL);
+    (void)pthread_cond_init(&pool->workAvailable, NULL);
+    (void)pthread_cond_init(&pool->workDone, NULL);
+    pool->threads = threads;
+    pool->arguments = arguments;
+    pool->queues = queues;
+    pool->workerCount = workerCount;
+
+    int cpus[CPU_SETSIZE];
+    const int cpuCount = pinThreads == true ? getAllowedCpus(cpus) : 0;
+
+    for (int i = 1; i < workerCount; i++) {
+        arguments[i].pool = pool;
+        arguments[i].slot = i;
+        arguments[i].cpu = cpuCount > 0 ? cpus[i % cpuCount] : -1;
+
+        if (pthread_create(&threads[i], NULL, workerMain, &arguments[i]) != 0) {
+            // Continue with the threads that could be started.
+            pool->workerCount = i;
+            break;
+        }
+    }
+
+    return pool;
+}
+
+/**
+ * Executes the given task in parallel over the index range [start; end).
+ * 
+ * <p><b>Note:</b><br>
+ * The task receives sub-ranges with at most `grainSize` indices. Ranges
+ * that fit into a single chunk, pools with a single thread and loops that
+ * are started from within a task are executed directly by the calling
+ * thread. The function returns after all indices were processed.
+ * </p>
+ * 
+ * @param *pool         Pool to execute the loop on.
+ * @param start         First index of the range.
+ * @param end           End of the range (exclusive).
+ * @param grainSize     Maximum number of indices per chunk.
+ * @param task          Task that processes a sub-range.
+ * @param *context      Context passed to each task call.
+ * 
+ * @throws NullPointerException - When the task is `NULL`.
+ */
+void ThreadPool_parallelFor(ThreadPool* pool, const size_t start, const size_t end,
+    const size_t grainSize, const ParallelTask task, void* context) {
+    if (task == NULL) {
+        (void)throwNullPointerException("Task of a parallel loop must not be NULL.");
+        return;
+    } else if (end <= start) {
+        return;
+    }
+
+    const size_t grain = grainSize == 0 ? 1 : grainSize;
+    const size_t chunks = (end - start + grain - 1) / grain;
+
+    if (pool == NULL || pool->workerCount <= 1 || chunks <= 1 || INSIDE_PARALLEL_REGION == true) {
+        (void)task(start, end, context);
+        return;
+    }
+
+    (void)pthread_mutex_lock(&pool->jobLock);
+    pool->task = task;
+    pool->context = context;
+    pool->start = start;
+    pool->end = end;
+    pool->grainSize = grain;
+
+    for (int i = 0; i < pool->workerCount; i++) {
+        pool->queues[i].begin = chunks * i / pool->workerCount;
+        pool->queues[i].end = chunks * (i + 1) / pool->workerCount;
+    }
+
+    (void)pthread_mutex_lock(&pool->mutex);
+    pool->jobActive = true;
+    pool->generation++;
+    (void)pthread_cond_broadcast(&pool->workAvailable);
+    (void)pthread_mutex_unlock(&pool->mutex);
+
+    INSIDE_PARALLEL_REGION = true;
+    (void)executeQueue(pool, 0);
+    INSIDE_PARALLEL_REGION = false;
+
+    (void)pthread_mutex_lock(&pool->mutex);
+
+    while (pool->activeWorkers > 0) {
+        (void)pthread_cond_wait(&pool->workDone, &pool->mutex);
+    }
+
+    pool->jobActive = false;
+    (void)pthread_mutex_unlock(&pool->mutex);
+    (void)pthread_mutex_unlock(&pool->jobLock);
+}
+
+/**
+ * Returns the number of threads executing a parallel loop of the pool.
+ * 
+ * @param *pool     The pool.
+ * 
+ * @return The number of threads, including the calling thread.
+ */
+int ThreadPool_getWorkerCount(const ThreadPool* pool) {
+    return pool == NULL ? 1 : pool->workerCount;
+}
+
+/**
+ * Stops all workers of the given pool and frees it.
+ * 
+ * @param *pool     The pool to free.
+ */
+void ThreadPool_free(ThreadPool* pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    (void)pthread_mutex_lock(&pool->mutex);
+    pool->shutdown = true;
+    (void)pthread_cond_broadcast(&pool->workAvailable);
+    (void)pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 1; i < pool->workerCount; i++) {
+        (void)pthread_join(pool->threads[i], NULL);
+    }
+
+    for (int i = 0; i < pool->workerCount; i++) {
+        (void)pthread_mutex_destroy(&pool->queues[i].lock);
+    }
+
+    (void)pthread_mutex_destroy(&pool->mutex);
+    (void)pthread_mutex_destroy(&pool->jobLock);
+    (void)pthread_cond_destroy(&pool->workAvailable);
+    (void)pthread_cond_destroy(&pool->workDone);
+    (void)free(pool->queues);
+    (void)free(pool->arguments);
+    (void)free(pool->threads);
+    (void)free(pool);
+}
+
+/**
+ * Determines the number of threads of the default pool. The environment
+ * variable `TO_CORE_NUM_THREADS` takes precedence over the number of CPUs
+ * the process may run on.
+ * 
+ * @return The default number of threads.
+ */
+static int getDefaultWorkerCount() {
+    const char* environment = getenv("TO_CORE_NUM_THREADS");
+
+    if (environment != NULL && atoi(environment) > 0) {
+        return atoi(environment);
+    }
+
+    cpu_set_t set;
+
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &set) == 0 && CPU_COUNT(&set) > 0) {
+        return CPU_COUNT(&set);
+    }
+
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+/**
+ * Returns the pool that is shared by all tensor operations. It is
+ * created on the first call.
+ * 
+ * @return The default ThreadPool.
+ */
+ThreadPool* getDefaultThreadPool() {
+    (void)pthread_mutex_lock(&DEFAULT_POOL_LOCK);
+
+    if (DEFAULT_POOL == NULL) {
+        DEFAULT_POOL = (ThreadPool*)createThreadPool(getDefaultWorkerCount(), false);
+    }
+
+    (void)pthread_mutex_unlock(&DEFAULT_POOL_LOCK);
+    return DEFAULT_POOL;
+}
+
+/**
+ * Replaces the pool that is shared by all tensor operations.
+ * 
+ * <p><b>Important:</b><br>
+ * This must not be called while tensor operations are running.
+ * </p>
+ * 
+ * @param workerCount   Number of threads, `0` for the default number.
+ * @param pinThreads    Whether the workers should be pinned to a core each.
+ */
+void configureDefaultThreadPool(const int workerCount, const int pinThreads) {
+    (void)pthread_mutex_lock(&DEFAULT_POOL_LOCK);
+
+    if (DEFAULT_POOL != NULL) {
+        (void)ThreadPool_free(DEFAULT_POOL);
+    }
+
+    DEFAULT_POOL = (ThreadPool*)createThreadPool(workerCount > 0 ?
+                    workerCount : getDefaultWorkerCount(), pinThreads);
+    (void)pthread_mutex_unlock(&DEFAULT_POOL_LOCK);
+}
+
+/**
+ * Executes the given task in parallel over the index range [start; end)
+ * on the default pool.
+ * 
+ * @param start         First index of the range.
+ * @param end           End of the range (exclusive).
+ * @param grainSize     Maximum number of indices per chunk.
+ * @param task          Task that processes a sub-range.
+ * @param *context      Context passed to each task call.
+ * 
+ * @see #ThreadPool_parallelFor(ThreadPool* pool, const size_t start, const size_t end,
+    const size_t grainSize, const ParallelTask task, void* context)
+ */
+void parallelFor(const size_t start, const size_t end, const size_t grainSize,
+    const ParallelTask task, void* context) {
+    if (task != NULL && end > start && (end - start <= grainSize || INSIDE_PARALLEL_REGION == true)) {
+        (void)task(start, end, context);
+        return;
+    }
+
+    (void)ThreadPool_parallelFor(getDefaultThreadPool(), start, end, grainSize, task, context);
+}
\ No newline at end of file
@@ -24,7 +24,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Tests/testTensorOperations.h"
 #include "Tensor/tensor.h"
+#include "Tensor/view.h"
 #include "Operations/convolution.h"
+#include "Operations/convolutionStream.h"
+#include "Operations/pooling.h"
+#include "Operations/simd.h"
+#include "Utils/cpu.h"
+#include "Utils/threadPool.h"
 
 #include "testSuite.h"
 
@@ -193,4 +199,1367 @@ void testTensorConvolve3D_002() {
     testSuite_assertEquals(1124, dest->data[9]);
     testSuite_assertEquals(604, dest->data[10]);
     testSuite_assertEquals(1382, dest->data[11]);
+}
+
+void testTensorConvolveGemm_001() {
+    printf("TestTensorConvolveGemm_001...\n");
+    int shape[] = {3, 21, 37};
+    int kernelShape[] = {2, 3, 4};
+    int outputShape[] = {2, 19, 34};
+    int stridedShape[] = {1, 7, 12};
+    IntegerTensor* t = IntegerTensor_zeros(3, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(3, kernelShape);
+    IntegerTensor* direct = IntegerTensor_zeros(3, outputShape);
+    IntegerTensor* gemm = IntegerTensor_zeros(3, outputShape);
+    DoubleTensor* td = DoubleTensor_zeros(3, shape);
+    DoubleTensor* kernelD = DoubleTensor_zeros(3, kernelShape);
+    DoubleTensor* directD = DoubleTensor_zeros(3, outputShape);
+    DoubleTensor* gemmD = DoubleTensor_zeros(3, outputShape);
+
+    for (int i = 0; i < 3 * 21 * 37; i++) {
+        t->data[i] = (i * 37 + 11) % 29 - 14;
+        td->data[i] = t->data[i] * 0.25;
+    }
+
+    for (int i = 0; i < 2 * 3 * 4; i++) {
+        kernel->data[i] = (i * 7 + 3) % 11 - 5;
+        kernelD->data[i] = kernel->data[i] * 0.5;
+    }
+
+    ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    IntegerTensor_convolveWithSettings(t, kernel, direct, &settings);
+    DoubleTensor_convolveWithSettings(td, kernelD, directD, &settings);
+    settings.algorithm = CONVOLUTION_ALGORITHM_GEMM;
+    IntegerTensor_convolveWithSettings(t, kernel, gemm, &settings);
+    DoubleTensor_convolveWithSettings(td, kernelD, gemmD, &settings);
+
+    for (int i = 0; i < 2 * 19 * 34; i++) {
+        testSuite_assertEquals(direct->data[i], gemm->data[i]);
+        testSuite_assertInBetween(gemmD->data[i], directD->data[i] - 1e-9, directD->data[i] + 1e-9);
+    }
+
+    IntegerTensor* strided = IntegerTensor_zeros(3, stridedShape);
+    IntegerTensor* stridedGemm = IntegerTensor_zeros(3, stridedShape);
+    IntegerTensor_convolve(t, kernel, strided, 3);
+    settings.stride = 3;
+    IntegerTensor_convolveWithSettings(t, kernel, stridedGemm, &settings);
+
+    for (int i = 0; i < 7 * 12; i++) {
+        testSuite_assertEquals(strided->data[i], stridedGemm->data[i]);
+    }
+
+    IntegerTensor* crop = IntegerTensor_narrow(t, 2, 3, 30);
+    IntegerTensor* cropCopy = IntegerTensor_contiguous(crop);
+    int cropOutputShape[] = {2, 19, 27};
+    IntegerTensor* cropDirect = IntegerTensor_zeros(3, cropOutputShape);
+    IntegerTensor* cropGemm = IntegerTensor_zeros(3, cropOutputShape);
+    settings.stride = 1;
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    IntegerTensor_convolveWithSettings(cropCopy, kernel, cropDirect, &settings);
+    settings.algorithm = CONVOLUTION_ALGORITHM_GEMM;
+    IntegerTensor_convolveWithSettings(crop, kernel, cropGemm, &settings);
+
+    for (int i = 0; i < 2 * 19 * 27; i++) {
+        testSuite_assertEquals(cropDirect->data[i], cropGemm->data[i]);
+    }
+
+    printf("> Pass\n\n");
+
+    freeIntegerTensor(cropGemm);
+    freeIntegerTensor(cropDirect);
+    freeIntegerTensor(cropCopy);
+    freeIntegerTensor(crop);
+    freeIntegerTensor(stridedGemm);
+    freeIntegerTensor(strided);
+    freeDoubleTensor(gemmD);
+    freeDoubleTensor(directD);
+    freeDoubleTensor(kernelD);
+    freeDoubleTensor(td);
+    freeIntegerTensor(gemm);
+    freeIntegerTensor(direct);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(t);
+}
+
+void testTensorConvolveWinograd_001() {
+    printf("TestTensorConvolveWinograd_001...\n");
+    int shape[] = {2, 23, 30};
+    int kernelShape[] = {2, 3, 3};
+    int outputShape[] = {1, 21, 28};
+    FloatTensor* t = FloatTensor_zeros(3, shape);
+    FloatTensor* kernel = FloatTensor_zeros(3, kernelShape);
+    FloatTensor* direct = FloatTensor_zeros(3, outputShape);
+    DoubleTensor* td = DoubleTensor_zeros(3, shape);
+    DoubleTensor* kernelD = DoubleTensor_zeros(3, kernelShape);
+    DoubleTensor* directD = DoubleTensor_zeros(3, outputShape);
+    DoubleTensor* winogradD = DoubleTensor_zeros(3, outputShape);
+
+    for (int i = 0; i < 2 * 23 * 30; i++) {
+        t->data[i] = (float)((i * 37 + 11) % 29 - 14) * 0.125f;
+        td->data[i] = t->data[i];
+    }
+
+    for (int i = 0; i < 2 * 3 * 3; i++) {
+        kernel->data[i] = (float)((i * 7 + 3) % 11 - 5) * 0.5f;
+        kernelD->data[i] = kernel->data[i];
+    }
+
+    ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    FloatTensor_convolveWithSettings(t, kernel, direct, &settings);
+    DoubleTensor_convolveWithSettings(td, kernelD, directD, &settings);
+    settings.algorithm = CONVOLUTION_ALGORITHM_WINOGRAD;
+    DoubleTensor_convolveWithSettings(td, kernelD, winogradD, &settings);
+
+    ConvolutionLayer* layer = Float_createConvolutionLayer(kernel, NULL, 1);
+    testSuite_assertEquals(1, layer->winograd != NULL);
+    ConvolutionLayer_setAlgorithm(layer, CONVOLUTION_ALGORITHM_WINOGRAD);
+    ConvolutionLayer_forward(layer, t);
+    FloatTensor* winograd = (FloatTensor*)layer->base->destination;
+
+    for (int i = 0; i < 21 * 28; i++) {
+        testSuite_assertInBetween(winogradD->data[i], directD->data[i] - 1e-9, directD->data[i] + 1e-9);
+        testSuite_assertInBetween(winograd->data[i], direct->data[i] - 1e-3, direct->data[i] + 1e-3);
+    }
+
+    ConvolutionLayer* strided = Float_createConvolutionLayer(kernel, NULL, 2);
+    testSuite_assertEquals(1, strided->winograd == NULL);
+
+    printf("> Pass\n\n");
+
+    ConvolutionLayer_free(strided);
+    freeFloatTensor(winograd);
+    ConvolutionLayer_free(layer);
+    freeDoubleTensor(winogradD);
+    freeDoubleTensor(directD);
+    freeDoubleTensor(kernelD);
+    freeDoubleTensor(td);
+    freeFloatTensor(direct);
+    freeFloatTensor(kernel);
+    freeFloatTensor(t);
+}
+
+void testTensorConvolveFft_001() {
+    printf("TestTensorConvolveFft_001...\n");
+    int shape[] = {70, 90};
+    int kernelShape[] = {17, 23};
+    int outputShape[] = {54, 68};
+    int stridedShape[] = {27, 34};
+    DoubleTensor* t = DoubleTensor_zeros(2, shape);
+    DoubleTensor* kernel = DoubleTensor_zeros(2, kernelShape);
+    DoubleTensor* direct = DoubleTensor_zeros(2, outputShape);
+    DoubleTensor* fft = DoubleTensor_zeros(2, outputShape);
+    DoubleTensor* stridedDirect = DoubleTensor_zeros(2, stridedShape);
+    DoubleTensor* stridedFft = DoubleTensor_zeros(2, stridedShape);
+
+    for (int i = 0; i < 70 * 90; i++) {
+        t->data[i] = ((i * 37 + 11) % 29 - 14) * 0.25;
+    }
+
+    for (int i = 0; i < 17 * 23; i++) {
+        kernel->data[i] = ((i * 7 + 3) % 11 - 5) * 0.5;
+    }
+
+    ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    DoubleTensor_convolveWithSettings(t, kernel, direct, &settings);
+    settings.algorithm = CONVOLUTION_ALGORITHM_FFT;
+    DoubleTensor_convolveWithSettings(t, kernel, fft, &settings);
+
+    for (int i = 0; i < 54 * 68; i++) {
+        testSuite_assertInBetween(fft->data[i], direct->data[i] - 1e-8, direct->data[i] + 1e-8);
+    }
+
+    settings.stride = 2;
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    DoubleTensor_convolveWithSettings(t, kernel, stridedDirect, &settings);
+    settings.algorithm = CONVOLUTION_ALGORITHM_FFT;
+    DoubleTensor_convolveWithSettings(t, kernel, stridedFft, &settings);
+
+    for (int i = 0; i < 27 * 34; i++) {
+        testSuite_assertInBetween(stridedFft->data[i], stridedDirect->data[i] - 1e-8, stridedDirect->data[i] + 1e-8);
+    }
+
+    printf("> Pass\n\n");
+
+    freeDoubleTensor(stridedFft);
+    freeDoubleTensor(stridedDirect);
+    freeDoubleTensor(fft);
+    freeDoubleTensor(direct);
+    freeDoubleTensor(kernel);
+    freeDoubleTensor(t);
+}
+
+void testTensorConvolveDirect_001() {
+    printf("TestTensorConvolveDirect_001...\n");
+    int shape[] = {4, 9, 13};
+    int kernelShape[] = {2, 3, 4};
+    int outputShape[] = {2, 4, 4};
+    FloatTensor* t = FloatTensor_zeros(3, shape);
+    FloatTensor* kernel = FloatTensor_zeros(3, kernelShape);
+    FloatTensor* dest = FloatTensor_zeros(3, outputShape);
+
+    for (int i = 0; i < 4 * 9 * 13; i++) {
+        t->data[i] = (float)((i * 37 + 11) % 29 - 14) / 7.0f;
+    }
+
+    for (int i = 0; i < 2 * 3 * 4; i++) {
+        kernel->data[i] = (float)((i * 7 + 3) % 11 - 5) / 3.0f;
+    }
+
+    FloatTensor* view = FloatTensor_narrow(t, 2, 2, 11);
+    ConvolutionSettings settings = getDefaultConvolutionSettings(2);
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    FloatTensor_convolveWithSettings(view, kernel, dest, &settings);
+
+    for (int z = 0; z < 2; z++) {
+        for (int y = 0; y < 4; y++) {
+            for (int x = 0; x < 4; x++) {
+                float planes = 0;
+
+                for (int kz = 0; kz < 2; kz++) {
+                    float rows = 0;
+
+                    for (int ky = 0; ky < 3; ky++) {
+                        float taps = 0;
+
+                        for (int kx = 0; kx < 4; kx++) {
+                            taps += t->data[(z * 2 + kz) * 9 * 13 + (y * 2 + ky) * 13 + x * 2 + kx + 2]
+                                * kernel->data[kz * 12 + ky * 4 + kx];
+                        }
+
+                        rows += taps;
+                    }
+
+                    planes += rows;
+                }
+
+                const float got = dest->data[z * 16 + y * 4 + x];
+                testSuite_assertInBetween(got, planes, planes);
+            }
+        }
+    }
+
+    printf("> Pass\n\n");
+
+    freeFloatTensor(view);
+    freeFloatTensor(dest);
+    freeFloatTensor(kernel);
+    freeFloatTensor(t);
+}
+
+void testTensorConvolveDirect_002() {
+    printf("TestTensorConvolveDirect_002...\n");
+    int shape[] = {7, 41};
+    int kernelShape[] = {2, 6};
+    IntegerTensor* t = IntegerTensor_zeros(2, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, kernelShape);
+    const SimdLevel detected = getSimdLevel();
+
+    for (int i = 0; i < 7 * 41; i++) {
+        t->data[i] = (i * 37 + 11) % 29 - 14;
+    }
+
+    for (int i = 0; i < 2 * 6; i++) {
+        kernel->data[i] = (i * 7 + 3) % 11 - 5;
+    }
+
+    // Six taps per row leave a remainder of two after the unrolled taps.
+    for (int stride = 2; stride <= 3; stride++) {
+        int outputShape[] = {(7 - 2) / stride + 1, (41 - 6) / stride + 1};
+        IntegerTensor* dest = IntegerTensor_zeros(2, outputShape);
+        ConvolutionSettings settings = getDefaultConvolutionSettings(stride);
+        settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+
+        for (int level = SIMD_LEVEL_SCALAR; level <= (int)detected; level++) {
+            setSimdLevel((SimdLevel)level);
+            IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+
+            for (int y = 0; y < outputShape[0]; y++) {
+                for (int x = 0; x < outputShape[1]; x++) {
+                    int expected = 0;
+
+                    for (int ky = 0; ky < 2; ky++) {
+                        for (int kx = 0; kx < 6; kx++) {
+                            expected += t->data[(y * stride + ky) * 41 + x * stride + kx] * kernel->data[ky * 6 + kx];
+                        }
+                    }
+
+                    testSuite_assertEquals(expected, dest->data[y * outputShape[1] + x]);
+                }
+            }
+        }
+
+        freeIntegerTensor(dest);
+    }
+
+    setSimdLevel(detected);
+    printf("> Pass\n\n");
+
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(t);
+}
+
+void testTensorConvolvePadding_001() {
+    printf("TestTensorConvolvePadding_001...\n");
+    int shape[] = {4};
+    int kernelShape[] = {3};
+    IntegerTensor* t = IntegerTensor_zeros(1, shape);
+    IntegerTensor* kernel = IntegerTensor_ones(1, kernelShape);
+    IntegerTensor* dest = IntegerTensor_zeros(1, shape);
+
+    for (int i = 0; i < 4; i++) {
+        t->data[i] = i + 1;
+    }
+
+    // Padded [0, 1, 2, 3, 4, 0].
+    ConvolutionSettings settings = getPaddedConvolutionSettings(1, CONVOLUTION_PADDING_ZERO,
+                                    CONVOLUTION_PADDING_SAME);
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+    testSuite_assertEquals(3, dest->data[0]);
+    testSuite_assertEquals(6, dest->data[1]);
+    testSuite_assertEquals(9, dest->data[2]);
+    testSuite_assertEquals(7, dest->data[3]);
+
+    // Padded [2, 1, 2, 3, 4, 3].
+    settings.padding = CONVOLUTION_PADDING_REFLECT;
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+    testSuite_assertEquals(5, dest->data[0]);
+    testSuite_assertEquals(10, dest->data[3]);
+
+    // Padded [1, 1, 2, 3, 4, 4].
+    settings.padding = CONVOLUTION_PADDING_REPLICATE;
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+    testSuite_assertEquals(4, dest->data[0]);
+    testSuite_assertEquals(11, dest->data[3]);
+
+    // Padded [0, 0, 1, 2, 3, 4, 0, 0] with stride 2.
+    settings = getPaddedConvolutionSettings(2, CONVOLUTION_PADDING_ZERO, 2);
+    settings.algorithm = CONVOLUTION_ALGORITHM_GEMM;
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+    testSuite_assertEquals(1, dest->data[0]);
+    testSuite_assertEquals(6, dest->data[1]);
+    testSuite_assertEquals(7, dest->data[2]);
+
+    int imageShape[] = {5, 7};
+    int squareShape[] = {3, 3};
+    IntegerTensor* image = IntegerTensor_ones(2, imageShape);
+    IntegerTensor* square = IntegerTensor_ones(2, squareShape);
+    ConvolutionLayer* layer = Integer_createConvolutionLayer(square, NULL, 1);
+    ConvolutionLayer_setPadding(layer, CONVOLUTION_PADDING_ZERO, CONVOLUTION_PADDING_SAME);
+    ConvolutionLayer_forward(layer, image);
+
+    const IntegerTensor* result = (IntegerTensor*)layer->base->destination;
+    testSuite_assertEquals(5, result->base->shape[0]);
+    testSuite_assertEquals(7, result->base->shape[1]);
+    testSuite_assertEquals(4, result->data[0]);
+    testSuite_assertEquals(6, result->data[1]);
+    testSuite_assertEquals(9, result->data[8]);
+    testSuite_assertEquals(4, result->data[34]);
+
+    printf("> Pass\n\n");
+
+    freeIntegerTensor((IntegerTensor*)result);
+    ConvolutionLayer_free(layer);
+    freeIntegerTensor(square);
+    freeIntegerTensor(image);
+    freeIntegerTensor(dest);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(t);
+}
+
+void testTensorConvolveFilters_001() {
+    printf("TestTensorConvolveFilters_001...\n");
+    int shape[] = {3, 6, 7};
+    int filterShape[] = {6, 3, 2, 3};
+    int outputShape[] = {6, 5, 5};
+    IntegerTensor* t = IntegerTensor_zeros(3, shape);
+    IntegerTensor* filters = IntegerTensor_zeros(4, filterShape);
+    IntegerTensor* dest = IntegerTensor_zeros(3, outputShape);
+
+    for (int i = 0; i < 3 * 6 * 7; i++) {
+        t->data[i] = (i * 37 + 11) % 29 - 14;
+    }
+
+    for (int i = 0; i < 6 * 3 * 2 * 3; i++) {
+        filters->data[i] = (i * 7 + 3) % 11 - 5;
+    }
+
+    ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+    IntegerTensor_convolveFilters(t, filters, dest, &settings);
+
+    for (int n = 0; n < 6; n++) {
+        for (int y = 0; y < 5; y++) {
+            for (int x = 0; x < 5; x++) {
+                int sum = 0;
+
+                for (int c = 0; c < 3; c++) {
+                    for (int ky = 0; ky < 2; ky++) {
+                        for (int kx = 0; kx < 3; kx++) {
+                            sum += t->data[c * 42 + (y + ky) * 7 + x + kx]
+                                * filters->data[n * 18 + c * 6 + ky * 3 + kx];
+                        }
+                    }
+                }
+
+                testSuite_assertEquals(sum, dest->data[n * 25 + y * 5 + x]);
+            }
+        }
+    }
+
+    ConvolutionLayer* layer = Integer_createFilterConvolutionLayer(filters, NULL, 2);
+    ConvolutionLayer_setPadding(layer, CONVOLUTION_PADDING_ZERO, CONVOLUTION_PADDING_SAME);
+    ConvolutionLayer_forward(layer, t);
+
+    const IntegerTensor* result = (IntegerTensor*)layer->base->destination;
+    testSuite_assertEquals(6, result->base->shape[0]);
+    testSuite_assertEquals(3, result->base->shape[1]);
+    testSuite_assertEquals(4, result->base->shape[2]);
+    testSuite_assertEquals(dest->data[25 + 2 * 5 + 1], result->data[12 + 4 + 1]);
+
+    printf("> Pass\n\n");
+
+    freeIntegerTensor((IntegerTensor*)result);
+    ConvolutionLayer_free(layer);
+    freeIntegerTensor(dest);
+    freeIntegerTensor(filters);
+    freeIntegerTensor(t);
+}
+
+void testTensorConvolveFixed_001() {
+    printf("TestTensorConvolveFixed_001...\n");
+    int shape[] = {1, 17, 40};
+    int kernelShape[] = {1, 5, 5};
+    int outputShape[] = {1, 7, 18};
+    int lineShape[] = {40};
+    int tapShape[] = {7};
+    int lineOutputShape[] = {34};
+    DoubleTensor* t = DoubleTensor_zeros(3, shape);
+    DoubleTensor* kernel = DoubleTensor_zeros(3, kernelShape);
+    DoubleTensor* dest = DoubleTensor_zeros(3, outputShape);
+    DoubleTensor* line = DoubleTensor_zeros(1, lineShape);
+    DoubleTensor* taps = DoubleTensor_zeros(1, tapShape);
+    DoubleTensor* lineDest = DoubleTensor_zeros(1, lineOutputShape);
+
+    for (int i = 0; i < 17 * 40; i++) {
+        t->data[i] = (double)((i * 37 + 11) % 29 - 14) / 7.0;
+    }
+
+    for (int i = 0; i < 25; i++) {
+        kernel->data[i] = (double)((i * 7 + 3) % 11 - 5) / 3.0;
+    }
+
+    for (int i = 0; i < 40; i++) {
+        line->data[i] = t->data[i];
+    }
+
+    for (int i = 0; i < 7; i++) {
+        taps->data[i] = kernel->data[i];
+    }
+
+    DoubleTensor_convolve(t, kernel, dest, 2);
+    DoubleTensor_convolve(line, taps, lineDest, 1);
+
+    for (int y = 0; y < 7; y++) {
+        for (int x = 0; x < 18; x++) {
+            double sum = 0;
+
+            for (int ky = 0; ky < 5; ky++) {
+                double row = 0;
+
+                for (int kx = 0; kx < 5; kx++) {
+                    row += t->data[(y * 2 + ky) * 40 + x * 2 + kx] * kernel->data[ky * 5 + kx];
+                }
+
+                sum += row;
+            }
+
+            testSuite_assertInBetween(dest->data[y * 18 + x], sum, sum);
+        }
+    }
+
+    for (int x = 0; x < 34; x++) {
+        double sum = 0;
+
+        for (int kx = 0; kx < 7; kx++) {
+            sum += line->data[x + kx] * taps->data[kx];
+        }
+
+        testSuite_assertInBetween(lineDest->data[x], sum, sum);
+    }
+
+    printf("> Pass\n\n");
+
+    freeDoubleTensor(lineDest);
+    freeDoubleTensor(taps);
+    freeDoubleTensor(line);
+    freeDoubleTensor(dest);
+    freeDoubleTensor(kernel);
+    freeDoubleTensor(t);
+}
+
+void testTensorConvolveSeparable_001() {
+    printf("TestTensorConvolveSeparable_001...\n");
+    int shape[] = {11, 14};
+    int kernelShape[] = {5, 5};
+    int outputShape[] = {4, 5};
+    int column[] = {1, 2, 0, -2, -1};
+    int row[] = {1, 4, 6, 4, 1};
+    IntegerTensor* t = IntegerTensor_zeros(2, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, kernelShape);
+    IntegerTensor* dense = IntegerTensor_zeros(2, kernelShape);
+    IntegerTensor* dest = IntegerTensor_zeros(2, outputShape);
+
+    for (int i = 0; i < 11 * 14; i++) {
+        t->data[i] = (i * 37 + 11) % 29 - 14;
+    }
+
+    for (int i = 0; i < 25; i++) {
+        kernel->data[i] = column[i / 5] * row[i % 5];
+        dense->data[i] = (i * 7 + 3) % 11 - 5;
+    }
+
+    ConvolutionLayer* layer = Integer_createConvolutionLayer(kernel, NULL, 2);
+    ConvolutionLayer* denseLayer = Integer_createConvolutionLayer(dense, NULL, 2);
+    ConvolutionLayer_setPadding(layer, CONVOLUTION_PADDING_REFLECT, CONVOLUTION_PADDING_SAME);
+    ConvolutionLayer_forward(layer, t);
+    IntegerTensor* result = (IntegerTensor*)layer->base->destination;
+
+    testSuite_assertEquals(layer->separable != NULL, 1);
+    testSuite_assertEquals(denseLayer->separable == NULL, 1);
+    testSuite_assertEquals(layer->separable->sizes[0], 5);
+
+    for (int y = 0; y < 6; y++) {
+        for (int x = 0; x < 7; x++) {
+            int sum = 0;
+
+            for (int ky = 0; ky < 5; ky++) {
+                for (int kx = 0; kx < 5; kx++) {
+                    int iy = y * 2 - 2 + ky;
+                    int ix = x * 2 - 1 + kx;
+                    iy = iy < 0 ? -iy : (iy > 10 ? 20 - iy : iy);
+                    ix = ix < 0 ? -ix : (ix > 13 ? 26 - ix : ix);
+                    sum += t->data[iy * 14 + ix] * kernel->data[ky * 5 + kx];
+                }
+            }
+
+            testSuite_assertEquals(result->data[y * 7 + x], sum);
+        }
+    }
+
+    ConvolutionSettings settings = getDefaultConvolutionSettings(2);
+    settings.algorithm = CONVOLUTION_ALGORITHM_SEPARABLE;
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 5; x++) {
+            int sum = 0;
+
+            for (int ky = 0; ky < 5; ky++) {
+                for (int kx = 0; kx < 5; kx++) {
+                    sum += t->data[(y * 2 + ky) * 14 + x * 2 + kx] * kernel->data[ky * 5 + kx];
+                }
+            }
+
+            testSuite_assertEquals(dest->data[y * 5 + x], sum);
+        }
+    }
+
+    printf("> Pass\n\n");
+
+    freeIntegerTensor(result);
+    ConvolutionLayer_free(layer);
+    ConvolutionLayer_free(denseLayer);
+    freeIntegerTensor(dest);
+    freeIntegerTensor(dense);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(t);
+}
+
+void testTensorConvolveBox_001() {
+    printf("TestTensorConvolveBox_001...\n");
+    int shape[] = {12, 15};
+    int kernelShape[] = {9, 9};
+    int tableShape[] = {3, 4};
+    IntegerTensor* t = IntegerTensor_zeros(2, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, kernelShape);
+    IntegerTensor* dest = IntegerTensor_zeros(2, shape);
+    IntegerTensor* small = IntegerTensor_zeros(2, tableShape);
+    IntegerTensor* table = IntegerTensor_zeros(2, tableShape);
+
+    for (int i = 0; i < 12 * 15; i++) {
+        t->data[i] = (i * 37 + 11) % 29 - 14;
+    }
+
+    for (int i = 0; i < 81; i++) {
+        kernel->data[i] = 2;
+    }
+
+    for (int i = 0; i < 12; i++) {
+        small->data[i] = i + 1;
+    }
+
+    ConvolutionSettings settings = getPaddedConvolutionSettings(1, CONVOLUTION_PADDING_ZERO, CONVOLUTION_PADDING_SAME);
+    settings.algorithm = CONVOLUTION_ALGORITHM_BOX;
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+    IntegerTensor_integralImage(small, table);
+
+    for (int y = 0; y < 12; y++) {
+        for (int x = 0; x < 15; x++) {
+            int sum = 0;
+
+            for (int ky = 0; ky < 9; ky++) {
+                for (int kx = 0; kx < 9; kx++) {
+                    const int iy = y - 4 + ky;
+                    const int ix = x - 4 + kx;
+
+                    if (iy >= 0 && iy < 12 && ix >= 0 && ix < 15) {
+                        sum += t->data[iy * 15 + ix] * 2;
+                    }
+                }
+            }
+
+            testSuite_assertEquals(dest->data[y * 15 + x], sum);
+        }
+    }
+
+    int expectedTable[] = {1, 3, 6, 10, 6, 14, 24, 36, 15, 33, 54, 78};
+
+    for (int i = 0; i < 12; i++) {
+        testSuite_assertEquals(table->data[i], expectedTable[i]);
+    }
+
+    printf("> Pass\n\n");
+
+    freeIntegerTensor(table);
+    freeIntegerTensor(small);
+    freeIntegerTensor(dest);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(t);
+}
+
+void testTensorConvolveBatch_001() {
+    printf("TestTensorConvolveBatch_001...\n");
+    int shape[] = {3, 6, 7};
+    int frameShape[] = {6, 7};
+    int kernelShape[] = {3, 3};
+    int destShape[] = {3, 4, 5};
+    int frameDestShape[] = {4, 5};
+    int bankInputShape[] = {3, 2, 6, 7};
+    int bankFrameShape[] = {2, 6, 7};
+    int filtersShape[] = {2, 2, 3, 3};
+    int bankDestShape[] = {2, 4, 5};
+    IntegerTensor* batch = IntegerTensor_zeros(3, shape);
+    IntegerTensor* frame = IntegerTensor_zeros(2, frameShape);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, kernelShape);
+    IntegerTensor* dest = IntegerTensor_zeros(3, destShape);
+    IntegerTensor* frameDest = IntegerTensor_zeros(2, frameDestShape);
+    IntegerTensor* bankInput = IntegerTensor_zeros(4, bankInputShape);
+    IntegerTensor* bankFrame = IntegerTensor_zeros(3, bankFrameShape);
+    IntegerTensor* filters = IntegerTensor_zeros(4, filtersShape);
+    IntegerTensor* bankDest = IntegerTensor_zeros(3, bankDestShape);
+
+    for (int i = 0; i < 3 * 6 * 7; i++) {
+        batch->data[i] = (i * 13 + 5) % 17 - 8;
+    }
+
+    for (int i = 0; i < 3 * 2 * 6 * 7; i++) {
+        bankInput->data[i] = (i * 7 + 3) % 11 - 5;
+    }
+
+    for (int i = 0; i < 9; i++) {
+        kernel->data[i] = i % 4 - 1;
+    }
+
+    for (int i = 0; i < 2 * 2 * 9; i++) {
+        filters->data[i] = (i * 5) % 7 - 3;
+    }
+
+    IntegerTensor_convolve(batch, kernel, dest, 1);
+    ConvolutionLayer* layer = Integer_createFilterConvolutionLayer(filters, NULL, 1);
+    ConvolutionLayer_forward(layer, bankInput);
+    const IntegerTensor* result = (IntegerTensor*)layer->base->destination;
+    const ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+
+    testSuite_assertEquals(result->base->dimensions, 4);
+    testSuite_assertEquals(result->base->shape[0], 3);
+    testSuite_assertEquals(result->base->shape[1], 2);
+
+    for (int n = 0; n < 3; n++) {
+        for (int i = 0; i < 6 * 7; i++) {
+            frame->data[i] = batch->data[n * 6 * 7 + i];
+        }
+
+        for (int i = 0; i < 2 * 6 * 7; i++) {
+            bankFrame->data[i] = bankInput->data[n * 2 * 6 * 7 + i];
+        }
+
+        IntegerTensor_convolve(frame, kernel, frameDest, 1);
+        IntegerTensor_convolveFilters(bankFrame, filters, bankDest, &settings);
+
+        for (int i = 0; i < 4 * 5; i++) {
+            testSuite_assertEquals(dest->data[n * 4 * 5 + i], frameDest->data[i]);
+        }
+
+        for (int i = 0; i < 2 * 4 * 5; i++) {
+            testSuite_assertEquals(result->data[n * 2 * 4 * 5 + i], bankDest->data[i]);
+        }
+    }
+
+    printf("> Pass\n\n");
+
+    freeIntegerTensor((IntegerTensor*)result);
+    ConvolutionLayer_free(layer);
+    freeIntegerTensor(bankDest);
+    freeIntegerTensor(filters);
+    freeIntegerTensor(bankFrame);
+    freeIntegerTensor(bankInput);
+    freeIntegerTensor(frameDest);
+    freeIntegerTensor(dest);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(frame);
+    freeIntegerTensor(batch);
+}
+
+void testTensorConvolveTuned_001() {
+    printf("TestTensorConvolveTuned_001...\n");
+    int shape[] = {20, 24};
+    int kernelShape[] = {3, 3};
+    int destShape[] = {18, 22};
+    FloatTensor* t = FloatTensor_zeros(2, shape);
+    FloatTensor* kernel = FloatTensor_zeros(2, kernelShape);
+    FloatTensor* tuned = FloatTensor_zeros(2, destShape);
+    FloatTensor* direct = FloatTensor_zeros(2, destShape);
+    FloatTensor* loaded = FloatTensor_zeros(2, destShape);
+    const char* path = "TO-Core-tuning.tmp";
+
+    for (int i = 0; i < 20 * 24; i++) {
+        t->data[i] = (float)((i * 19 + 7) % 23) * 0.25f - 2.0f;
+    }
+
+    for (int i = 0; i < 9; i++) {
+        kernel->data[i] = (float)(i % 5) * 0.5f - 1.0f;
+    }
+
+    ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+    clearConvolutionTuning();
+    settings.algorithm = CONVOLUTION_ALGORITHM_TUNED;
+    FloatTensor_convolveWithSettings(t, kernel, tuned, &settings);
+    testSuite_assertEquals(getConvolutionTuningSize(), 1);
+    testSuite_assertEquals(saveConvolutionTuning(path), 1);
+
+    clearConvolutionTuning();
+    testSuite_assertEquals(getConvolutionTuningSize(), 0);
+    testSuite_assertEquals(loadConvolutionTuning("TO-Core-missing.tmp"), 0);
+    testSuite_assertEquals(loadConvolutionTuning(path), 1);
+    testSuite_assertEquals(getConvolutionTuningSize(), 1);
+
+    settings.algorithm = CONVOLUTION_ALGORITHM_AUTO;
+    FloatTensor_convolveWithSettings(t, kernel, loaded, &settings);
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    FloatTensor_convolveWithSettings(t, kernel, direct, &settings);
+
+    // Another pool size misses the stored choice and is tuned again.
+    const int workers = ThreadPool_getWorkerCount(getDefaultThreadPool());
+    configureDefaultThreadPool(workers + 1, 0);
+    settings.algorithm = CONVOLUTION_ALGORITHM_TUNED;
+    FloatTensor_convolveWithSettings(t, kernel, tuned, &settings);
+    testSuite_assertEquals(getConvolutionTuningSize(), 2);
+    configureDefaultThreadPool(workers, 0);
+
+    for (int i = 0; i < 18 * 22; i++) {
+        testSuite_assertInBetween(tuned->data[i], direct->data[i] - 1e-4, direct->data[i] + 1e-4);
+        testSuite_assertInBetween(loaded->data[i], direct->data[i] - 1e-4, direct->data[i] + 1e-4);
+    }
+
+    printf("> Pass\n\n");
+
+    (void)remove(path);
+    clearConvolutionTuning();
+    freeFloatTensor(loaded);
+    freeFloatTensor(direct);
+    freeFloatTensor(tuned);
+    freeFloatTensor(kernel);
+    freeFloatTensor(t);
+}
+
+void testTensorConvolveBackward_001() {
+    printf("TestTensorConvolveBackward_001...\n");
+    int shape[] = {7, 8};
+    int kernelShape[] = {3, 3};
+    int outputShape[] = {4, 4};
+    IntegerTensor* t = IntegerTensor_zeros(2, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, kernelShape);
+    IntegerTensor* gradient = IntegerTensor_zeros(2, outputShape);
+    IntegerTensor* inputGradient = IntegerTensor_zeros(2, shape);
+    IntegerTensor* kernelGradient = IntegerTensor_zeros(2, kernelShape);
+    int expectedInput[7 * 8] = {0};
+    int expectedKernel[9] = {0};
+
+    for (int i = 0; i < 7 * 8; i++) {
+        t->data[i] = (i * 5 + 3) % 11 - 5;
+    }
+
+    for (int i = 0; i < 9; i++) {
+        kernel->data[i] = i % 4 - 2;
+    }
+
+    for (int i = 0; i < 16; i++) {
+        gradient->data[i] = (i * 3) % 7 - 3;
+    }
+
+    // "Same" padding of 7x8 with stride 2 pads one row and no column before.
+    const ConvolutionSettings settings = getPaddedConvolutionSettings(2, CONVOLUTION_PADDING_ZERO,
+                                            CONVOLUTION_PADDING_SAME);
+    IntegerTensor_convolveBackwardData(gradient, kernel, inputGradient, &settings);
+    IntegerTensor_convolveBackwardWeights(t, gradient, kernelGradient, &settings);
+
+    for (int oy = 0; oy < 4; oy++) {
+        for (int ox = 0; ox < 4; ox++) {
+            for (int ky = 0; ky < 3; ky++) {
+                for (int kx = 0; kx < 3; kx++) {
+                    const int iy = oy * 2 - 1 + ky;
+                    const int ix = ox * 2 + kx;
+
+                    if (iy >= 0 && iy < 7 && ix >= 0 && ix < 8) {
+                        expectedInput[iy * 8 + ix] += gradient->data[oy * 4 + ox] * kernel->data[ky * 3 + kx];
+                        expectedKernel[ky * 3 + kx] += gradient->data[oy * 4 + ox] * t->data[iy * 8 + ix];
+                    }
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < 7 * 8; i++) {
+        testSuite_assertEquals(inputGradient->data[i], expectedInput[i]);
+    }
+
+    for (int i = 0; i < 9; i++) {
+        testSuite_assertEquals(kernelGradient->data[i], expectedKernel[i]);
+    }
+
+    printf("> Pass\n\n");
+
+    freeIntegerTensor(kernelGradient);
+    freeIntegerTensor(inputGradient);
+    freeIntegerTensor(gradient);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(t);
+}
+
+void testTensorPool_001() {
+    printf("TestTensorPool_001...\n");
+    int shape[] = {5, 6};
+    int shape_kernel[] = {2, 2};
+    int shape_max[] = {2, 3};
+    int shape_window[] = {3, 3};
+    int shape_average[] = {3, 4};
+    int shape_strided[] = {5, 2};
+    int kernel_strided[] = {1, 2};
+    int strides[] = {1, 3};
+    int shape_channels[] = {2, 3, 4};
+    int shape_global[] = {2, 1, 1};
+    FloatTensor* t = FloatTensor_zeros(2, shape);
+    FloatTensor* maximum = FloatTensor_zeros(2, shape_max);
+    FloatTensor* strided = FloatTensor_zeros(2, shape_strided);
+    IntegerTensor* values = IntegerTensor_zeros(2, shape);
+    IntegerTensor* average = IntegerTensor_zeros(2, shape_average);
+    DoubleTensor* channels = DoubleTensor_zeros(3, shape_channels);
+    DoubleTensor* global = DoubleTensor_zeros(3, shape_global);
+
+    for (int i = 0; i < 30; i++) {
+        t->data[i] = (float)i;
+        values->data[i] = i;
+    }
+
+    for (int i = 0; i < 24; i++) {
+        channels->data[i] = (double)i;
+    }
+
+    // Non-overlapping 2x2 windows, the last row is dropped
+    FloatTensor_maxPool(t, maximum, shape_kernel, NULL);
+    testSuite_assertEquals(7, (int)maximum->data[0]);
+    testSuite_assertEquals(9, (int)maximum->data[1]);
+    testSuite_assertEquals(11, (int)maximum->data[2]);
+    testSuite_assertEquals(19, (int)maximum->data[3]);
+    testSuite_assertEquals(23, (int)maximum->data[5]);
+
+    // Gaps between the windows
+    FloatTensor_maxPool(t, strided, kernel_strided, strides);
+    testSuite_assertEquals(1, (int)strided->data[0]);
+    testSuite_assertEquals(4, (int)strided->data[1]);
+    testSuite_assertEquals(28, (int)strided->data[9]);
+
+    // The mean of a window of linear values is its center
+    IntegerTensor_averagePool(values, average, shape_window, (int[]){1, 1});
+    testSuite_assertEquals(7, average->data[0]);
+    testSuite_assertEquals(10, average->data[3]);
+    testSuite_assertEquals(22, average->data[11]);
+
+    DoubleTensor_globalAveragePool(channels, global, 1);
+    testSuite_assertInBetween(global->data[0], 5.5 - 1e-12, 5.5 + 1e-12);
+    testSuite_assertInBetween(global->data[1], 17.5 - 1e-12, 17.5 + 1e-12);
+
+    freeFloatTensor(t);
+    freeFloatTensor(maximum);
+    freeFloatTensor(strided);
+    freeIntegerTensor(values);
+    freeIntegerTensor(average);
+    freeDoubleTensor(channels);
+    freeDoubleTensor(global);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveQuantized_001() {
+    printf("TestTensorConvolveQuantized_001...\n");
+    int shape_tensor[] = {1, 4, 21};
+    int shape_filters[] = {2, 1, 2, 3};
+    int shape_dest[] = {2, 3, 19};
+    FloatTensor* weights = FloatTensor_zeros(4, shape_filters);
+    FloatTensor* restored = FloatTensor_zeros(4, shape_filters);
+    Uint8Tensor* t = Uint8Tensor_zeros(3, shape_tensor, 0.5f, 10);
+    IntegerTensor* dest = IntegerTensor_zeros(3, shape_dest);
+    Uint8Tensor* requantized = Uint8Tensor_zeros(3, shape_dest, 4.0f, 0);
+
+    for (int i = 0; i < 84; i++) {
+        t->data[i] = (uint8_t)((i * 37) % 256);
+    }
+
+    // The second filter has a ten times larger range
+    for (int i = 0; i < 6; i++) {
+        weights->data[i] = (float)(i - 2) * 0.25f;
+        weights->data[6 + i] = (float)(3 - i) * 2.5f;
+    }
+
+    Int8Tensor* filters = Int8Tensor_quantize(weights, 1);
+    testSuite_assertEquals(2, filters->quantization.channels);
+    testSuite_assertEquals(127, filters->data[5]);
+    testSuite_assertEquals(127, filters->data[6]);
+
+    Int8Tensor_dequantize(filters, restored);
+    for (int i = 0; i < 12; i++) {
+        testSuite_assertInBetween(restored->data[i], weights->data[i] - 0.05, weights->data[i] + 0.05);
+    }
+
+    Uint8Tensor_convolveInt8(t, filters, dest, 1);
+    Uint8Tensor_convolveRequantized(t, filters, requantized, 1);
+
+    for (int f = 0; f < 2; f++) {
+        for (int y = 0; y < 3; y++) {
+            for (int x = 0; x < 19; x++) {
+                int sum = 0;
+
+                for (int ky = 0; ky < 2; ky++) {
+                    for (int kx = 0; kx < 3; kx++) {
+                        sum += (t->data[(y + ky) * 21 + x + kx] - 10) * filters->data[(f * 2 + ky) * 3 + kx];
+                    }
+                }
+
+                const int index = (f * 3 + y) * 19 + x;
+                const float real = (float)sum * 0.5f * filters->quantization.scales[f] / 4.0f;
+                const int expected = real <= 0.0f ? 0 : real >= 255.0f ? 255 : (int)(real + 0.5f);
+                testSuite_assertEquals(sum, dest->data[index]);
+                testSuite_assertInBetween(requantized->data[index], expected - 1, expected + 1);
+            }
+        }
+    }
+
+    freeFloatTensor(weights);
+    freeFloatTensor(restored);
+    freeInt8Tensor(filters);
+    freeUint8Tensor(t);
+    freeUint8Tensor(requantized);
+    freeIntegerTensor(dest);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveStream_001() {
+    printf("TestTensorConvolveStream_001...\n");
+    int shape_tensor[] = {11, 4};
+    int shape_kernel[] = {3, 2};
+    int shape_dest[] = {5, 2};
+    int chunks[] = {1, 4, 2, 4};
+    IntegerTensor* t = IntegerTensor_zeros(2, shape_tensor);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, shape_kernel);
+    IntegerTensor* expected = IntegerTensor_zeros(2, shape_dest);
+    IntegerTensor* dest = IntegerTensor_zeros(2, shape_dest);
+
+    for (int i = 0; i < 44; i++) {
+        t->data[i] = (i * 7) % 13 - 6;
+    }
+
+    for (int i = 0; i < 6; i++) {
+        kernel->data[i] = i - 2;
+    }
+
+    IntegerTensor_convolve(t, kernel, expected, 2);
+
+    // Push the time steps in chunks, every push emits only the new outputs
+    ConvolutionStream* stream = Integer_createConvolutionStream(kernel, 2);
+    int first = 0;
+    int emitted = 0;
+
+    for (int c = 0; c < 4; c++) {
+        int shape_chunk[] = {chunks[c], 4};
+        int shape_outputs[] = {3, 2};
+        IntegerTensor* chunk = IntegerTensor_zeros(2, shape_chunk);
+        IntegerTensor* outputs = IntegerTensor_zeros(2, shape_outputs);
+
+        for (int i = 0; i < chunks[c] * 4; i++) {
+            chunk->data[i] = t->data[first * 4 + i];
+        }
+
+        const int ready = ConvolutionStream_getReadyOutputs(stream, chunks[c]);
+        const int written = Integer_ConvolutionStream_push(stream, chunk, outputs);
+        testSuite_assertEquals(ready, written);
+
+        for (int i = 0; i < written * 2; i++) {
+            dest->data[emitted * 2 + i] = outputs->data[i];
+        }
+
+        first += chunks[c];
+        emitted += written;
+        freeIntegerTensor(chunk);
+        freeIntegerTensor(outputs);
+    }
+
+    testSuite_assertEquals(5, emitted);
+
+    for (int i = 0; i < 10; i++) {
+        testSuite_assertEquals(expected->data[i], dest->data[i]);
+    }
+
+    ConvolutionStream_free(stream);
+    freeIntegerTensor(t);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(expected);
+    freeIntegerTensor(dest);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveChanges_001() {
+    printf("TestTensorConvolveChanges_001...\n");
+    int shape[] = {40, 70};
+    int shape_kernel[] = {3, 3};
+    IntegerTensor* t = IntegerTensor_zeros(2, shape);
+    IntegerTensor* previous = IntegerTensor_zeros(2, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, shape_kernel);
+    IntegerTensor* expected = IntegerTensor_zeros(2, shape);
+    IntegerTensor* dest = IntegerTensor_zeros(2, shape);
+    ConvolutionSettings settings = getPaddedConvolutionSettings(1, CONVOLUTION_PADDING_REFLECT, CONVOLUTION_PADDING_SAME);
+
+    for (int i = 0; i < 2800; i++) {
+        t->data[i] = (i * 7) % 13 - 6;
+        previous->data[i] = t->data[i];
+    }
+
+    for (int i = 0; i < 9; i++) {
+        kernel->data[i] = i - 4;
+    }
+
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+
+    // A change at the border is read again by the mirrored padding
+    t->data[1 * 70 + 0] += 5;
+    t->data[35 * 70 + 65] -= 3;
+    testSuite_assertEquals(2, IntegerTensor_convolveChanges(t, previous, kernel, dest, &settings));
+    testSuite_assertEquals(0, IntegerTensor_convolveChanges(t, previous, kernel, dest, &settings));
+    IntegerTensor_convolveWithSettings(t, kernel, expected, &settings);
+
+    for (int i = 0; i < 2800; i++) {
+        testSuite_assertEquals(t->data[i], previous->data[i]);
+        testSuite_assertEquals(expected->data[i], dest->data[i]);
+    }
+
+    // Explicit regions skip the comparison
+    int start[] = {38, 10};
+    int end[] = {40, 12};
+    ConvolutionRegion region = {start, end};
+    t->data[39 * 70 + 11] = 100;
+    IntegerTensor_convolveRegions(t, kernel, dest, &settings, &region, 1);
+    IntegerTensor_convolveWithSettings(t, kernel, expected, &settings);
+
+    for (int i = 0; i < 2800; i++) {
+        testSuite_assertEquals(expected->data[i], dest->data[i]);
+    }
+
+    freeIntegerTensor(t);
+    freeIntegerTensor(previous);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(expected);
+    freeIntegerTensor(dest);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveDilated_001() {
+    printf("TestTensorConvolveDilated_001...\n");
+    int shape[] = {2, 20, 30};
+    int shape_kernel[] = {2, 3, 3};
+    int shape_dest[] = {1, 8, 10};
+    int strides[] = {1, 2, 3};
+    int dilations[] = {1, 2, 1};
+    IntegerTensor* t = IntegerTensor_zeros(3, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(3, shape_kernel);
+    IntegerTensor* direct = IntegerTensor_zeros(3, shape_dest);
+    IntegerTensor* gemm = IntegerTensor_zeros(3, shape_dest);
+    ConvolutionSettings settings = getDilatedConvolutionSettings(strides, dilations, CONVOLUTION_PADDING_VALID, 0);
+
+    for (int i = 0; i < 1200; i++) {
+        t->data[i] = (i * 7) % 13 - 6;
+    }
+
+    for (int i = 0; i < 18; i++) {
+        kernel->data[i] = i - 9;
+    }
+
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+    IntegerTensor_convolveWithSettings(t, kernel, direct, &settings);
+    settings.algorithm = CONVOLUTION_ALGORITHM_GEMM;
+    IntegerTensor_convolveWithSettings(t, kernel, gemm, &settings);
+
+    ConvolutionLayer* layer = Integer_createConvolutionLayer(kernel, NULL, 1);
+    ConvolutionLayer_setStrides(layer, strides, dilations);
+    ConvolutionLayer_forward(layer, t);
+    IntegerTensor* output = (IntegerTensor*)layer->base->destination;
+
+    testSuite_assertEquals(80, output->base->dataPoints);
+
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 10; x++) {
+            int expected = 0;
+
+            for (int c = 0; c < 2; c++) {
+                for (int ky = 0; ky < 3; ky++) {
+                    for (int kx = 0; kx < 3; kx++) {
+                        expected += t->data[c * 600 + (y * 2 + ky * 2) * 30 + x * 3 + kx]
+                                    * kernel->data[c * 9 + ky * 3 + kx];
+                    }
+                }
+            }
+
+            testSuite_assertEquals(expected, direct->data[y * 10 + x]);
+            testSuite_assertEquals(expected, gemm->data[y * 10 + x]);
+            testSuite_assertEquals(expected, output->data[y * 10 + x]);
+        }
+    }
+
+    freeIntegerTensor(output);
+    ConvolutionLayer_free(layer);
+    freeIntegerTensor(t);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(direct);
+    freeIntegerTensor(gemm);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveDepthwise_001() {
+    printf("TestTensorConvolveDepthwise_001...\n");
+    int shape[] = {3, 12, 21};
+    int shape_kernel[] = {3, 3, 3};
+    int shape_pointwise[] = {5, 3, 1, 1};
+    int shape_depthwise[] = {3, 10, 19};
+    int shape_dest[] = {5, 10, 19};
+    IntegerTensor* t = IntegerTensor_zeros(3, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(3, shape_kernel);
+    IntegerTensor* pointwise = IntegerTensor_zeros(4, shape_pointwise);
+    IntegerTensor* depthwise = IntegerTensor_zeros(3, shape_depthwise);
+    IntegerTensor* separable = IntegerTensor_zeros(3, shape_dest);
+    ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+
+    for (int i = 0; i < 756; i++) {
+        t->data[i] = (i * 5) % 11 - 5;
+    }
+
+    for (int i = 0; i < 27; i++) {
+        kernel->data[i] = i % 7 - 3;
+    }
+
+    for (int i = 0; i < 15; i++) {
+        pointwise->data[i] = i - 7;
+    }
+
+    IntegerTensor_convolveDepthwise(t, kernel, depthwise, &settings);
+    IntegerTensor_convolveDepthwiseSeparable(t, kernel, pointwise, separable, &settings);
+
+    ConvolutionLayer* layer = Integer_createDepthwiseSeparableLayer(kernel, pointwise, NULL, 1);
+    ConvolutionLayer_forward(layer, t);
+    IntegerTensor* output = (IntegerTensor*)layer->base->destination;
+
+    testSuite_assertEquals(950, output->base->dataPoints);
+
+    for (int y = 0; y < 10; y++) {
+        for (int x = 0; x < 19; x++) {
+            int channels[3];
+
+            for (int c = 0; c < 3; c++) {
+                channels[c] = 0;
+
+                for (int ky = 0; ky < 3; ky++) {
+                    for (int kx = 0; kx < 3; kx++) {
+                        channels[c] += t->data[c * 252 + (y + ky) * 21 + x + kx] * kernel->data[c * 9 + ky * 3 + kx];
+                    }
+                }
+
+                testSuite_assertEquals(channels[c], depthwise->data[c * 190 + y * 19 + x]);
+            }
+
+            for (int f = 0; f < 5; f++) {
+                int expected = 0;
+
+                for (int c = 0; c < 3; c++) {
+                    expected += channels[c] * pointwise->data[f * 3 + c];
+                }
+
+                testSuite_assertEquals(expected, separable->data[f * 190 + y * 19 + x]);
+                testSuite_assertEquals(expected, output->data[f * 190 + y * 19 + x]);
+            }
+        }
+    }
+
+    freeIntegerTensor(output);
+    ConvolutionLayer_free(layer);
+    freeIntegerTensor(t);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(pointwise);
+    freeIntegerTensor(depthwise);
+    freeIntegerTensor(separable);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveTiled_001() {
+    printf("TestTensorConvolveTiled_001...\n");
+    int shape[] = {40, 2100};
+    int shape_kernel[] = {3, 3};
+    IntegerTensor* t = IntegerTensor_zeros(2, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(2, shape_kernel);
+    IntegerTensor* dest = IntegerTensor_zeros(2, shape);
+    ConvolutionSettings settings = getPaddedConvolutionSettings(1, CONVOLUTION_PADDING_ZERO, CONVOLUTION_PADDING_SAME);
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+
+    for (int i = 0; i < 84000; i++) {
+        t->data[i] = (i * 3) % 17 - 8;
+    }
+
+    for (int i = 0; i < 9; i++) {
+        kernel->data[i] = i - 4;
+    }
+
+    // The kernel rows (25 kB) do not fit into this cache, so the output is split into tiles.
+    configureCacheSizes(0, 16 * 1024, 0);
+    IntegerTensor_convolveWithSettings(t, kernel, dest, &settings);
+    configureCacheSizes(0, 0, 0);
+
+    for (int y = 0; y < 40; y++) {
+        for (int x = 0; x < 2100; x++) {
+            int expected = 0;
+
+            for (int ky = 0; ky < 3; ky++) {
+                for (int kx = 0; kx < 3; kx++) {
+                    const int ty = y + ky - 1;
+                    const int tx = x + kx - 1;
+
+                    if (ty >= 0 && ty < 40 && tx >= 0 && tx < 2100) {
+                        expected += t->data[ty * 2100 + tx] * kernel->data[ky * 3 + kx];
+                    }
+                }
+            }
+
+            testSuite_assertEquals(expected, dest->data[y * 2100 + x]);
+        }
+    }
+
+    freeIntegerTensor(t);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(dest);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveDilated_002() {
+    printf("TestTensorConvolveDilated_002...\n");
+    int shape[] = {3, 10, 12};
+    int shape_filters[] = {2, 3, 3, 3};
+    int shape_dest[] = {2, 6, 5};
+    // The entries of the channel dimension are ignored, the filters span all channels.
+    int strides[] = {5, 1, 2};
+    int dilations[] = {2, 2, 1};
+    IntegerTensor* t = IntegerTensor_zeros(3, shape);
+    IntegerTensor* filters = IntegerTensor_zeros(4, shape_filters);
+    IntegerTensor* dest = IntegerTensor_zeros(3, shape_dest);
+    ConvolutionSettings settings = getDilatedConvolutionSettings(strides, dilations, CONVOLUTION_PADDING_VALID, 0);
+
+    for (int i = 0; i < 360; i++) {
+        t->data[i] = (i * 5) % 9 - 4;
+    }
+
+    for (int i = 0; i < 54; i++) {
+        filters->data[i] = i % 7 - 3;
+    }
+
+    IntegerTensor_convolveFilters(t, filters, dest, &settings);
+
+    for (int f = 0; f < 2; f++) {
+        for (int y = 0; y < 6; y++) {
+            for (int x = 0; x < 5; x++) {
+                int expected = 0;
+
+                for (int c = 0; c < 3; c++) {
+                    for (int ky = 0; ky < 3; ky++) {
+                        for (int kx = 0; kx < 3; kx++) {
+                            expected += t->data[c * 120 + (y + ky * 2) * 12 + x * 2 + kx]
+                                        * filters->data[f * 27 + c * 9 + ky * 3 + kx];
+                        }
+                    }
+                }
+
+                testSuite_assertEquals(expected, dest->data[f * 30 + y * 5 + x]);
+            }
+        }
+    }
+
+    freeIntegerTensor(t);
+    freeIntegerTensor(filters);
+    freeIntegerTensor(dest);
+    printf("> Pass\n\n");
+}
+
+void testTensorConvolveDepthwise_002() {
+    printf("TestTensorConvolveDepthwise_002...\n");
+    int shape[] = {4, 8};
+    int shape_kernel[] = {4, 3};
+    int shape_dest[] = {4, 4};
+    // The channel entries are ignored, only the rows are dilated.
+    int strides[] = {3, 1};
+    int dilations[] = {2, 2};
+    DoubleTensor* t = DoubleTensor_zeros(2, shape);
+    DoubleTensor* kernel = DoubleTensor_zeros(2, shape_kernel);
+    DoubleTensor* dest = DoubleTensor_zeros(2, shape_dest);
+    ConvolutionSettings settings = getDilatedConvolutionSettings(strides, dilations, CONVOLUTION_PADDING_VALID, 0);
+
+    for (int i = 0; i < 32; i++) {
+        t->data[i] = i % 5 - 2;
+    }
+
+    for (int i = 0; i < 12; i++) {
+        kernel->data[i] = i - 6;
+    }
+
+    DoubleTensor_convolveDepthwise(t, kernel, dest, &settings);
+
+    for (int c = 0; c < 4; c++) {
+        for (int x = 0; x < 4; x++) {
+            double expected = 0;
+
+            for (int k = 0; k < 3; k++) {
+                expected += t->data[c * 8 + x + k * 2] * kernel->data[c * 3 + k];
+            }
+
+            testSuite_assertEquals((int)expected, (int)dest->data[c * 4 + x]);
+        }
+    }
+
+    freeDoubleTensor(t);
+    freeDoubleTensor(kernel);
+    freeDoubleTensor(dest);
+    printf("> Pass\n\n");
 }
\ No newline at end of file
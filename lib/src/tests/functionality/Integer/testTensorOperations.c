@@ -21,9 +21,14 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 
 #include "Tensor/tensor.h"
 #include "Operations/baseOperations.h"
+#include "Operations/simd.h"
+#include "Operations/utils.h"
+#include "Tensor/arena.h"
 
 #include "Tests/testTensorOperations.h"
 #include "testSuite.h"
@@ -161,4 +166,210 @@ void testTensorSubtract_001() {
     freeIntegerTensor(tensor_b);
     freeIntegerTensor(tensor_c);
     printf("> Pass\n\n");
+}
+
+void testTensorSimdKernels_001() {
+    printf("TestTensorSimdKernels_001...\n");
+    const int N = 37;
+    int shape[1] = {N};
+    int dimensions = 1;
+
+    IntegerTensor* int_a = IntegerTensor_zeros(dimensions, shape);
+    IntegerTensor* int_b = IntegerTensor_zeros(dimensions, shape);
+    IntegerTensor* int_c = IntegerTensor_zeros(dimensions, shape);
+    DoubleTensor* double_a = DoubleTensor_zeros(dimensions, shape);
+    DoubleTensor* double_b = DoubleTensor_zeros(dimensions, shape);
+    DoubleTensor* double_c = DoubleTensor_zeros(dimensions, shape);
+
+    for (int i = 0; i < N; i++) {
+        int_a->data[i] = (i - 18) * 1234567;
+        int_b->data[i] = i % 2 == 0 ? -(i + 3) : (i + 1);
+        double_a->data[i] = (i - 18) * 0.75;
+        double_b->data[i] = i + 0.5;
+    }
+
+    const SimdLevel detected = getSimdLevel();
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= (int)detected; level++) {
+        setSimdLevel((SimdLevel)level);
+
+        IntegerTensor_divide(int_a, int_b, int_c);
+
+        for (int i = 0; i < N; i++) {
+            testSuite_assertEquals(int_a->data[i] / int_b->data[i], int_c->data[i]);
+        }
+
+        IntegerTensor_multiply(int_b, int_b, int_c);
+
+        for (int i = 0; i < N; i++) {
+            testSuite_assertEquals(int_b->data[i] * int_b->data[i], int_c->data[i]);
+        }
+
+        IntegerTensor_scalarMultiply(int_b, -7, int_c);
+
+        for (int i = 0; i < N; i++) {
+            testSuite_assertEquals(-7 * int_b->data[i], int_c->data[i]);
+        }
+
+        DoubleTensor_subtract(double_a, double_b, double_c);
+
+        for (int i = 0; i < N; i++) {
+            testSuite_assertInBetween(double_c->data[i], double_a->data[i] - double_b->data[i], double_a->data[i] - double_b->data[i]);
+        }
+
+        DoubleTensor_divide(double_a, double_b, double_c);
+
+        for (int i = 0; i < N; i++) {
+            testSuite_assertInBetween(double_c->data[i], double_a->data[i] / double_b->data[i], double_a->data[i] / double_b->data[i]);
+        }
+    }
+
+    setSimdLevel(detected);
+
+    freeIntegerTensor(int_a);
+    freeIntegerTensor(int_b);
+    freeIntegerTensor(int_c);
+    freeDoubleTensor(double_a);
+    freeDoubleTensor(double_b);
+    freeDoubleTensor(double_c);
+    printf("> Pass\n\n");
+}
+
+void testTensorSimdKernels_002() {
+    printf("TestTensorSimdKernels_002...\n");
+    const int N = 37;
+    int shape[1] = {N};
+    int dimensions = 1;
+    // Index 3 lies in a vector lane on every SIMD level, index 36 in the scalar tail.
+    const int positions[2] = {3, N - 1};
+
+    IntegerTensor* a = IntegerTensor_zeros(dimensions, shape);
+    IntegerTensor* b = IntegerTensor_zeros(dimensions, shape);
+    IntegerTensor* c = IntegerTensor_zeros(dimensions, shape);
+    const SimdLevel detected = getSimdLevel();
+
+    for (int level = SIMD_LEVEL_SCALAR; level <= (int)detected; level++) {
+        setSimdLevel((SimdLevel)level);
+
+        for (int p = 0; p < 2; p++) {
+            for (int overflow = 0; overflow < 2; overflow++) {
+                for (int i = 0; i < N; i++) {
+                    a->data[i] = 7 * i;
+                    b->data[i] = i + 1;
+                    c->data[i] = 42;
+                }
+
+                a->data[positions[p]] = overflow ? INT_MIN : 7;
+                b->data[positions[p]] = overflow ? -1 : 0;
+                IntegerTensor_divide(a, b, c);
+
+                for (int i = 0; i < N; i++) {
+                    testSuite_assertEquals(42, c->data[i]);
+                }
+            }
+        }
+    }
+
+    setSimdLevel(detected);
+
+    freeIntegerTensor(a);
+    freeIntegerTensor(b);
+    freeIntegerTensor(c);
+    printf("> Pass\n\n");
+}
+
+void testTensorAllocation_001() {
+    printf("TestTensorAllocation_001...\n");
+    const int N = 37;
+    int shape[2] = {N, 3};
+    int dimensions = 2;
+
+    const TensorAllocation previous = getTensorAllocationMode();
+    setTensorAllocationMode(TENSOR_ALLOCATION_SINGLE_BLOCK);
+
+    IntegerTensor* int_a = IntegerTensor_ones(dimensions, shape);
+    IntegerTensor* int_b = IntegerTensor_zeros(dimensions, shape);
+    FloatTensor* float_a = FloatTensor_zeros(dimensions, shape);
+    DoubleTensor* double_a = DoubleTensor_ones(dimensions, shape);
+
+    testSuite_assertEquals(TENSOR_ALLOCATION_SINGLE_BLOCK, int_a->base->allocation);
+    testSuite_assertEquals(0, (int)((uintptr_t)int_a->data % TENSOR_DATA_ALIGNMENT));
+    testSuite_assertEquals(0, (int)((uintptr_t)int_b->data % TENSOR_DATA_ALIGNMENT));
+    testSuite_assertEquals(0, (int)((uintptr_t)float_a->data % TENSOR_DATA_ALIGNMENT));
+    testSuite_assertEquals(0, (int)((uintptr_t)double_a->data % TENSOR_DATA_ALIGNMENT));
+    testSuite_assertEquals(N, int_a->base->shape[0]);
+    testSuite_assertEquals(3, int_a->base->shape[1]);
+
+    IntegerTensor_add(int_a, int_a, int_b);
+
+    for (int i = 0; i < N * 3; i++) {
+        testSuite_assertEquals(2, int_b->data[i]);
+        testSuite_assertInBetween(double_a->data[i], 1, 1);
+        testSuite_assertInBetween(float_a->data[i], 0, 0);
+    }
+
+    int newShape[3] = {3, N, 1};
+    IntegerTensor_reshape(int_b, newShape, 3);
+    testSuite_assertEquals(3, int_b->base->dimensions);
+    testSuite_assertEquals(N, int_b->base->shape[1]);
+
+    DoubleTensor_flatten(double_a);
+    testSuite_assertEquals(1, double_a->base->dimensions);
+    testSuite_assertEquals(N * 3, double_a->base->shape[0]);
+
+    setTensorAllocationMode(previous);
+
+    IntegerTensor* separate = IntegerTensor_zeros(dimensions, shape);
+    testSuite_assertEquals(TENSOR_ALLOCATION_SEPARATE, separate->base->allocation);
+
+    freeIntegerTensor(int_a);
+    freeIntegerTensor(int_b);
+    freeFloatTensor(float_a);
+    freeDoubleTensor(double_a);
+    freeIntegerTensor(separate);
+    printf("> Pass\n\n");
+}
+
+void testTensorArena_001() {
+    printf("TestTensorArena_001...\n");
+    const int N = 37;
+    int shape[2] = {N, 3};
+    int dimensions = 2;
+
+    TensorArena* arena = createTensorArena(4096);
+
+    for (int round = 0; round < 3; round++) {
+        IntegerTensor* int_a = IntegerTensor_arenaZeros(arena, dimensions, shape);
+        IntegerTensor* int_b = IntegerTensor_arenaZeros(arena, dimensions, shape);
+        DoubleTensor* double_a = DoubleTensor_arenaZeros(arena, dimensions, shape);
+
+        testSuite_assertEquals(TENSOR_ALLOCATION_ARENA, int_a->base->allocation);
+        testSuite_assertEquals(0, (int)((uintptr_t)int_a->data % TENSOR_DATA_ALIGNMENT));
+        testSuite_assertEquals(0, (int)((uintptr_t)int_b->data % TENSOR_DATA_ALIGNMENT));
+        testSuite_assertEquals(0, (int)((uintptr_t)double_a->data % TENSOR_DATA_ALIGNMENT));
+
+        for (int i = 0; i < N * 3; i++) {
+            testSuite_assertEquals(0, int_b->data[i]);
+            int_a->data[i] = i;
+        }
+
+        IntegerTensor_add(int_a, int_a, int_b);
+
+        for (int i = 0; i < N * 3; i++) {
+            testSuite_assertEquals(2 * i, int_b->data[i]);
+        }
+
+        int newShape[1] = {N * 3};
+        IntegerTensor_reshape(int_b, newShape, 1);
+        testSuite_assertEquals(1, int_b->base->dimensions);
+        freeIntegerTensor(int_b);
+
+        testSuite_assertEquals(1, TensorArena_getUsedBytes(arena) <= 4096);
+        (void)TensorArena_reset(arena);
+        testSuite_assertEquals(0, (int)TensorArena_getUsedBytes(arena));
+    }
+
+    testSuite_assertEquals(1, TensorArena_getPeakBytes(arena) > 0);
+    TensorArena_free(arena);
+    printf("> Pass\n\n");
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Tests/testTensorOperations.h"
+#include "Tensor/tensor.h"
+#include "Tensor/view.h"
+#include "Operations/baseOperations.h"
+#include "Operations/activation.h"
+#include "Operations/statistics.h"
+#include "Operations/convolution.h"
+
+#include "testSuite.h"
+
+void testTensorView_001() {
+    printf("TestTensorView_001...\n");
+    int shape[3] = {4, 5, 6};
+    IntegerTensor* t = IntegerTensor_zeros(3, shape);
+
+    for (int i = 0; i < 4 * 5 * 6; i++) {
+        t->data[i] = i;
+    }
+
+    IntegerTensor* frame = IntegerTensor_select(t, 0, 2);
+    testSuite_assertEquals(2, frame->base->dimensions);
+    testSuite_assertEquals(5, frame->base->shape[0]);
+    testSuite_assertEquals(6, frame->base->shape[1]);
+    testSuite_assertEquals(60, (int)frame->base->offset);
+    testSuite_assertEquals(60 + 3 * 6 + 4, frame->data[3 * 6 + 4]);
+
+    IntegerTensor* crop = IntegerTensor_narrow(frame, 1, 1, 3);
+    testSuite_assertEquals(0, Tensor_isContiguous(crop->base));
+    testSuite_assertEquals(3, (int)Tensor_getContiguousLength(crop->base));
+    testSuite_assertEquals(61 + 2 * 6 + 1, crop->data[Tensor_getElementOffset(crop->base, 2 * 3 + 1)]);
+
+    IntegerTensor* stepped = IntegerTensor_slice(t, 2, 1, 6, 2);
+    testSuite_assertEquals(3, stepped->base->shape[2]);
+    testSuite_assertEquals(2, stepped->base->strides[2]);
+    testSuite_assertEquals(6 + 5, stepped->data[Tensor_getElementOffset(stepped->base, 5)]);
+
+    IntegerTensor* transposed = IntegerTensor_transpose(t, 0, 2);
+    testSuite_assertEquals(6, transposed->base->shape[0]);
+    testSuite_assertEquals(4, transposed->base->shape[2]);
+    testSuite_assertEquals(1 * 30 + 2 * 6 + 3, transposed->data[Tensor_getElementOffset(transposed->base, 3 * 20 + 2 * 4 + 1)]);
+
+    IntegerTensor* copy = IntegerTensor_contiguous(transposed);
+
+    for (int z = 0; z < 6; z++) {
+        for (int y = 0; y < 5; y++) {
+            for (int x = 0; x < 4; x++) {
+                testSuite_assertEquals(x * 30 + y * 6 + z, copy->data[z * 20 + y * 4 + x]);
+            }
+        }
+    }
+
+    freeIntegerTensor(copy);
+    freeIntegerTensor(transposed);
+    freeIntegerTensor(stepped);
+    freeIntegerTensor(crop);
+    freeIntegerTensor(frame);
+    freeIntegerTensor(t);
+    printf("> Pass\n\n");
+}
+
+void testTensorView_002() {
+    printf("TestTensorView_002...\n");
+    int shape[3] = {3, 6, 7};
+    int cropShape[2] = {4, 5};
+    int kernelShape[2] = {3, 3};
+    int destShape[2] = {2, 3};
+    DoubleTensor* batch = DoubleTensor_zeros(3, shape);
+    DoubleTensor* kernel = DoubleTensor_zeros(2, kernelShape);
+    DoubleTensor* sum = DoubleTensor_zeros(2, cropShape);
+    DoubleTensor* dest = DoubleTensor_zeros(2, destShape);
+    DoubleTensor* expected = DoubleTensor_zeros(2, destShape);
+
+    for (int i = 0; i < 3 * 6 * 7; i++) {
+        batch->data[i] = (i % 11) - 5.5;
+    }
+
+    for (int i = 0; i < 9; i++) {
+        kernel->data[i] = (i % 3) - 1.25;
+    }
+
+    DoubleTensor* frame = DoubleTensor_select(batch, 0, 1);
+    DoubleTensor* rows = DoubleTensor_narrow(frame, 0, 1, 4);
+    DoubleTensor* crop = DoubleTensor_narrow(rows, 1, 2, 5);
+    DoubleTensor* dense = DoubleTensor_contiguous(crop);
+
+    DoubleTensor_convolve(crop, kernel, dest, 1);
+    DoubleTensor_convolve(dense, kernel, expected, 1);
+
+    for (int i = 0; i < 6; i++) {
+        testSuite_assertInBetween(dest->data[i], expected->data[i], expected->data[i]);
+    }
+
+    DoubleTensor_add(crop, crop, sum);
+
+    for (int i = 0; i < 20; i++) {
+        testSuite_assertInBetween(sum->data[i], 2 * dense->data[i], 2 * dense->data[i]);
+    }
+
+    const double mean = DoubleTensor_getMean(dense);
+    testSuite_assertInBetween(DoubleTensor_getMean(crop), mean - 1e-9, mean + 1e-9);
+
+    DoubleTensor_ReLU(crop);
+
+    for (int y = 0; y < 6; y++) {
+        for (int x = 0; x < 7; x++) {
+            const int inside = y >= 1 && y < 5 && x >= 2 && x < 7;
+            const double value = ((42 + y * 7 + x) % 11) - 5.5;
+            const double result = inside && value < 0 ? 0 : value;
+            testSuite_assertInBetween(frame->data[y * 7 + x], result, result);
+        }
+    }
+
+    freeDoubleTensor(dense);
+    freeDoubleTensor(crop);
+    freeDoubleTensor(rows);
+    freeDoubleTensor(frame);
+    freeDoubleTensor(batch);
+    freeDoubleTensor(kernel);
+    freeDoubleTensor(sum);
+    freeDoubleTensor(dest);
+    freeDoubleTensor(expected);
+    printf("> Pass\n\n");
+}
\ No newline at end of file
@@ -24,6 +24,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "testSuite.h"
 #include "Operations/convolution.h"
 #include "Operations/activation.h"
+#include "Operations/pooling.h"
 #include "Network/sequentialNetwork.h"
 #include "Network/layer.h"
 #include "Tensor/tensor.h"
@@ -170,4 +171,41 @@ void test_SN_Activation_002() {
     freeDoubleTensor(tensor);
     freeDoubleTensor(kernel);
     printf("> Pass\n\n");
+}
+
+void test_SN_Pooling_001() {
+    printf("Test_SN_Pooling_001...\n");
+    int shape_tensor[] = {4, 4};
+    int shape_kernel[] = {2, 2};
+    IntegerTensor* tensor = IntegerTensor_zeros(2, shape_tensor);
+
+    for (int i = 0; i < 16; i++) {
+        tensor->data[i] = i;
+    }
+
+    SequentialNetwork* net = createSequentialNetwork();
+
+    PoolingLayer* layer_1 = Integer_createPoolingLayer(POOLING_MAX, 2, shape_kernel, NULL, NULL);
+    PoolingLayer* layer_2 = Integer_createGlobalPoolingLayer(0, NULL);
+
+    SequentialNetwork_addLayer(net, layer_1, POOLING);
+    SequentialNetwork_addLayer(net, layer_2, POOLING);
+
+    IntegerTensor* result = Integer_SequentialNetwork_forward(net, tensor);
+    IntegerTensor* pooled = (IntegerTensor*)layer_1->base->destination;
+
+    testSuite_assertEquals(2, pooled->base->shape[0]);
+    testSuite_assertEquals(2, pooled->base->shape[1]);
+    testSuite_assertEquals(5, pooled->data[0]);
+    testSuite_assertEquals(7, pooled->data[1]);
+    testSuite_assertEquals(13, pooled->data[2]);
+    testSuite_assertEquals(15, pooled->data[3]);
+    testSuite_assertEquals(1, result->base->dataPoints);
+    testSuite_assertEquals(10, result->data[0]);
+
+    SequentialNetwork_free(net);
+    freeIntegerTensor(pooled);
+    freeIntegerTensor(result);
+    freeIntegerTensor(tensor);
+    printf("> Pass\n\n");
 }
\ No newline at end of file
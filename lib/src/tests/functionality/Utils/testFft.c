@@ -0,0 +1,82 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "testSuite.h"
+#include "Utils/fft.h"
+
+#include "Tests/testUtil.h"
+
+void testFft_001() {
+    printf("TestFft_001...\n");
+    const size_t N = 64;
+    double* signal = (double*)malloc(N * sizeof(double));
+    double* spectrum = (double*)malloc((N + 2) * sizeof(double));
+    double* restored = (double*)malloc(N * sizeof(double));
+    double* complex = (double*)malloc(2 * N * sizeof(double));
+    FftPlan* plan = createFftPlan(N);
+
+    for (size_t i = 0; i < N; i++) {
+        signal[i] = (double)((i * 13 + 5) % 17) - 8.0;
+        complex[2 * i] = signal[i];
+        complex[2 * i + 1] = 0.0;
+    }
+
+    Fft_realForward(plan, signal, spectrum);
+
+    for (size_t k = 0; k <= N / 2; k += 7) {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (size_t i = 0; i < N; i++) {
+            re += signal[i] * cos(-2.0 * 3.14159265358979323846 * k * i / N);
+            im += signal[i] * sin(-2.0 * 3.14159265358979323846 * k * i / N);
+        }
+
+        testSuite_assertInBetween(spectrum[2 * k], re - 1e-9, re + 1e-9);
+        testSuite_assertInBetween(spectrum[2 * k + 1], im - 1e-9, im + 1e-9);
+    }
+
+    Fft_complex(plan, complex, 0);
+
+    for (size_t k = 0; k <= N / 2; k++) {
+        testSuite_assertInBetween(complex[2 * k], spectrum[2 * k] - 1e-9, spectrum[2 * k] + 1e-9);
+        testSuite_assertInBetween(complex[2 * k + 1], spectrum[2 * k + 1] - 1e-9, spectrum[2 * k + 1] + 1e-9);
+    }
+
+    Fft_realInverse(plan, spectrum, restored);
+
+    for (size_t i = 0; i < N; i++) {
+        testSuite_assertInBetween(restored[i] / N, signal[i] - 1e-9, signal[i] + 1e-9);
+    }
+
+    testSuite_assertEquals(64, (int)FftPlan_getLength(plan));
+    printf("> Pass\n\n");
+
+    FftPlan_free(plan);
+    free(signal);
+    free(spectrum);
+    free(restored);
+    free(complex);
+}
\ No newline at end of file
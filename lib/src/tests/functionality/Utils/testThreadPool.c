@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////
+///////////////////////    LICENSE    ///////////////////////
+/////////////////////////////////////////////////////////////
+/*
+The TO-Core library for basic Tensor Operations.
+Copyright (C) 2025  Lukas Nian En Lampl
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "testSuite.h"
+#include "Utils/threadPool.h"
+#include "Tensor/tensor.h"
+#include "Operations/baseOperations.h"
+#include "Operations/convolution.h"
+
+#include "Tests/testUtil.h"
+
+static void markVisited(const size_t start, const size_t end, void* context) {
+    int* visited = (int*)context;
+
+    for (size_t i = start; i < end; i++) {
+        visited[i]++;
+    }
+}
+
+void testThreadPool_001() {
+    printf("TestThreadPool_001...\n");
+    const int N = 100003;
+    int* visited = (int*)calloc(N, sizeof(int));
+    ThreadPool* pool = createThreadPool(4, 0);
+
+    for (int run = 0; run < 8; run++) {
+        ThreadPool_parallelFor(pool, 0, N, 97, markVisited, visited);
+    }
+
+    int wrong = 0;
+
+    for (int i = 0; i < N; i++) {
+        wrong += visited[i] != 8 ? 1 : 0;
+    }
+
+    testSuite_assertEquals(0, wrong);
+    testSuite_assertEquals(4, ThreadPool_getWorkerCount(pool));
+
+    ThreadPool_free(pool);
+    free(visited);
+    printf("> Pass\n\n");
+}
+
+void testThreadPool_002() {
+    printf("TestThreadPool_002...\n");
+    configureDefaultThreadPool(4, 1);
+
+    int shape[] = {3, 256, 300};
+    int kernelShape[] = {3, 3, 3};
+    int outputShape[] = {1, 254, 298};
+    IntegerTensor* a = IntegerTensor_ones(3, shape);
+    IntegerTensor* b = IntegerTensor_zeros(3, shape);
+    IntegerTensor* kernel = IntegerTensor_ones(3, kernelShape);
+    IntegerTensor* dest = IntegerTensor_zeros(3, outputShape);
+
+    for (int i = 0; i < a->base->dataPoints; i++) {
+        b->data[i] = i % 7;
+    }
+
+    IntegerTensor_add(a, b, b);
+    IntegerTensor_convolve(a, kernel, dest, 1);
+
+    int wrong = 0;
+
+    for (int i = 0; i < b->base->dataPoints; i++) {
+        wrong += b->data[i] != (i % 7) + 1 ? 1 : 0;
+    }
+
+    for (int i = 0; i < dest->base->dataPoints; i++) {
+        wrong += dest->data[i] != 27 ? 1 : 0;
+    }
+
+    testSuite_assertEquals(0, wrong);
+
+    freeIntegerTensor(a);
+    freeIntegerTensor(b);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(dest);
+    configureDefaultThreadPool(0, 0);
+    printf("> Pass\n\n");
+}
\ No newline at end of file
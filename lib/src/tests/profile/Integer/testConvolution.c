@@ -21,14 +21,118 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include <time.h>
 
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "Tests/testTensorOperations.h"
 #include "Tensor/tensor.h"
 #include "Operations/convolution.h"
+#include "Utils/cpu.h"
+#include "Utils/threadPool.h"
 
 #include "testSuite.h"
 
+/**
+ * Opens a hardware counter of the calling thread, that is started and
+ * stopped with ioctl. Threads of the pool are not counted, so the
+ * profiles, that read counters, run on a single thread.
+ * 
+ * @param misses    Whether the cache misses or the cache references are counted.
+ * 
+ * @return The file descriptor of the counter, `-1` when it is not available.
+ */
+static int openCacheCounter(const int misses) {
+#ifdef __linux__
+    struct perf_event_attr attributes;
+    (void)memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.config = misses ? PERF_COUNT_HW_CACHE_MISSES : PERF_COUNT_HW_CACHE_REFERENCES;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Starts or stops a hardware counter.
+ * 
+ * @param counter   The file descriptor of the counter, `-1` is ignored.
+ * @param enable    Whether the counter is started or stopped.
+ */
+static void toggleCacheCounter(const int counter, const int enable) {
+#ifdef __linux__
+    if (counter >= 0) {
+        (void)ioctl(counter, enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+    }
+#endif
+}
+
+/**
+ * Reads and closes a hardware counter.
+ * 
+ * @param counter   The file descriptor of the counter.
+ * 
+ * @return The counted events, `-1` when the counter is not available.
+ */
+static long long closeCacheCounter(const int counter) {
+    long long count = -1;
+
+#ifdef __linux__
+    if (counter >= 0) {
+        if (read(counter, &count, sizeof(count)) != sizeof(count)) {
+            count = -1;
+        }
+
+        (void)close(counter);
+    }
+#endif
+
+    return count;
+}
+
+/**
+ * Convolves the tensor once and reports the wall-clock time and, when the
+ * counters are available, the last-level cache references and misses.
+ */
+static void profileCachedConvolution(const char* name, const IntegerTensor* t,
+    const IntegerTensor* kernel, const IntegerTensor* dest, const ConvolutionSettings* settings) {
+    const int references = openCacheCounter(0);
+    const int misses = openCacheCounter(1);
+
+    toggleCacheCounter(references, 1);
+    toggleCacheCounter(misses, 1);
+    struct timespec start;
+    struct timespec end;
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    IntegerTensor_convolveWithSettings(t, kernel, dest, settings);
+    (void)clock_gettime(CLOCK_MONOTONIC, &end);
+    toggleCacheCounter(references, 0);
+    toggleCacheCounter(misses, 0);
+
+    const long long referenceCount = closeCacheCounter(references);
+    const long long missCount = closeCacheCounter(misses);
+
+    printf(" > %s: %f seconds", name, (double)(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+
+    if (referenceCount >= 0 && missCount >= 0) {
+        printf(", %lld last-level cache references, %lld last-level cache misses\n", referenceCount, missCount);
+    } else {
+        printf(", cache counters not available\n");
+    }
+}
+
 void profileTensorConvolve3D_001() {
     int shape[] = {3, 1920, 1080};
     int kernelShape[] = {3, 3, 3};
@@ -61,4 +165,46 @@ void profileTensorConvolve3D_001() {
 
     testSuite_assertEquals(shape[0] * shape[1] * shape[2], sum);
     printf(" > Sum: %ld\n", sum);
+}
+
+void profileTensorConvolveTiled_001() {
+    int shape[] = {64, 270, 1920};
+    int kernelShape[] = {64, 5, 5};
+    int outputShape[] = {1, 266, 1916};
+    IntegerTensor* t = IntegerTensor_zeros(3, shape);
+    IntegerTensor* kernel = IntegerTensor_zeros(3, kernelShape);
+    IntegerTensor* rows = IntegerTensor_zeros(3, outputShape);
+    IntegerTensor* tiles = IntegerTensor_zeros(3, outputShape);
+    ConvolutionSettings settings = getDefaultConvolutionSettings(1);
+    settings.algorithm = CONVOLUTION_ALGORITHM_DIRECT;
+
+    printf("\nPreparing tiled convolution 3D of %ld elements (L2: %zu bytes, 1 thread).\n",
+        t->base->dataPoints, getCacheSizes()->l2);
+
+    for (int i = 0; i < t->base->dataPoints; i++) {
+        t->data[i] = i % 7 - 3;
+    }
+
+    for (int i = 0; i < kernel->base->dataPoints; i++) {
+        kernel->data[i] = i % 5 - 2;
+    }
+
+    // The counters only follow the calling thread, which runs every chunk of a single-threaded pool.
+    configureDefaultThreadPool(1, 0);
+
+    // A cache, that holds every row, turns the spatial tiles off.
+    configureCacheSizes(0, SIZE_MAX / 2, 0);
+    profileCachedConvolution("Whole rows", t, kernel, rows, &settings);
+    configureCacheSizes(0, 0, 0);
+    profileCachedConvolution("Tiles", t, kernel, tiles, &settings);
+    configureDefaultThreadPool(0, 0);
+
+    for (int i = 0; i < rows->base->dataPoints; i++) {
+        testSuite_assertEquals(rows->data[i], tiles->data[i]);
+    }
+
+    freeIntegerTensor(t);
+    freeIntegerTensor(kernel);
+    freeIntegerTensor(rows);
+    freeIntegerTensor(tiles);
 }
\ No newline at end of file
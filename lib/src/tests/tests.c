@@ -63,11 +63,44 @@ int main() {
     testTensorClamp_002();
     testTensorClamp_003();*/
 
+    testTensorSimdKernels_001();
+    testTensorSimdKernels_002();
+    testTensorAllocation_001();
+    testTensorArena_001();
+    testTensorView_001();
+    testTensorView_002();
+    testTensorConvolveDirect_001();
+    testTensorConvolveDirect_002();
+    testTensorConvolveGemm_001();
+    testTensorConvolveWinograd_001();
+    testTensorConvolveFft_001();
+    testTensorConvolvePadding_001();
+    testTensorConvolveFilters_001();
+    testTensorConvolveFixed_001();
+    testTensorConvolveSeparable_001();
+    testTensorConvolveBox_001();
+    testTensorConvolveBatch_001();
+    testTensorConvolveTuned_001();
+    testTensorConvolveBackward_001();
+    testTensorPool_001();
+    testTensorConvolveQuantized_001();
+    testTensorConvolveStream_001();
+    testTensorConvolveChanges_001();
+    testTensorConvolveDilated_001();
+    testTensorConvolveDilated_002();
+    testTensorConvolveDepthwise_001();
+    testTensorConvolveDepthwise_002();
+    testTensorConvolveTiled_001();
+
     testList_001();
+    testThreadPool_001();
+    testThreadPool_002();
+    testFft_001();
     test_SN_Convolution_001();
     test_SN_Convolution_002();
     test_SN_Activation_001();
     test_SN_Activation_002();
+    test_SN_Pooling_001();
 
     if (ENV_PROFILE_TESTING) {
         /*profileTensorAdd_001();
@@ -75,6 +108,7 @@ int main() {
         profileTensorMultiply_001();
         profileTensorSubtract_001();
         
-        profileTensorConvolve3D_001();*/
+        profileTensorConvolve3D_001();
+        profileTensorConvolveTiled_001();*/
     }
 }
\ No newline at end of file